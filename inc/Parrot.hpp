@@ -38,6 +38,46 @@
  *    returns a \c Parrot::Filecontent object.
  * * \c Parrot::FileContent -- the parsed content of a file, together with state
  *    variables indicating missing or malformed expressions.
+ * * \c Parrot::ParseStats -- optional timing information on the individual
+ *    steps of a parsing process.
+ * * \c Parrot::DiagnosticSink -- receives warnings emitted while parsing; may
+ *    print them immediately, buffer them or write them from a background
+ *    thread.
+ * * \c Parrot::ParseResult -- the outcome of a non-throwing parse, listing all
+ *    errors that occurred.
+ * * \c Parrot::RealRange -- evenly spaced reals, written as
+ *    <tt>start:stop:count</tt> and computed on access.
+ * * \c Parrot::Expression -- an arithmetic expression like \c 2PI, which a
+ *    \c Parrot::Reader may accept in place of a number.
+ * * \c Parrot::AlignedVector -- the storage of numeric lists that are to be
+ *    handed to vectorized code without copying.
+ * * \c Parrot::BooleanVocabulary -- the words a \c Parrot::Reader
+ *    recognizes as \c true or \c false.
+ * * \c Parrot::KeywordTable -- the keyword names of a \c Parrot::Reader,
+ *    each stored once and identified by an integer ID.
+ * * \c Parrot::KeyHandle -- a keyword resolved once by
+ *    \c Parrot::Reader::handle(), for reading its value from many file
+ *    contents without lookup.
+ * * \c Parrot::KeywordIndex -- the byte offsets of all keywords in a file.
+ * * \c Parrot::LazyFileContent -- a file content that parses each keyword
+ *    only on first access.
+ * * \c Parrot::LayeredFileContent -- several file contents stacked on top of
+ *    each other, e.g. defaults, site and job settings and overrides.
+ * * \c Parrot::Schema -- keyword descriptions read from a schema file.
+ * * \c Parrot::FunctionRegistry -- user functions bound by name when loading
+ *    a binary schema image.
+ * * \c Parrot::CodeGenerator -- C++ settings struct and parser generated for
+ *    a fixed schema.
+ * * \c Parrot::Executor -- runs asynchronous parsing processes, which can
+ *    be awaited in coroutines (\c Parrot::ParseAwaitable) and cancelled
+ *    before they start (\c Parrot::CancellationToken).
+ * * \c Parrot::FileLoader -- reads many files at once for a batch parse, via
+ *    \c io_uring where available.
+ * * \c Parrot::DirectoryParseResult -- the results and messages of all files
+ *    in a directory tree, as returned by \c Parrot::Reader::parseDirectory().
+ * * \c Parrot::FragmentCache -- keeps files included via
+ *    \c Parrot::Reader::setIncludeKeyword() parsed, so that a base file
+ *    shared by many files is only parsed once.
  *
  * @todo quick guide to using Parrot
  * @todo link to the quick guide from main
@@ -55,9 +95,29 @@
 #define SETTINGS_HPP
 
 #include "Parrot/Definitions.hpp"
+#include "Parrot/Range.hpp"
+#include "Parrot/AlignedAllocator.hpp"
+#include "Parrot/Expression.hpp"
 #include "Parrot/Restriction.hpp"
 #include "Parrot/Descriptor.hpp"
 #include "Parrot/Reader.hpp"
 #include "Parrot/FileContent.hpp"
+#include "Parrot/ParseStats.hpp"
+#include "Parrot/Diagnostics.hpp"
+#include "Parrot/ParseResult.hpp"
+#include "Parrot/KeywordTable.hpp"
+#include "Parrot/KeyHandle.hpp"
+#include "Parrot/BooleanVocabulary.hpp"
+#include "Parrot/KeywordIndex.hpp"
+#include "Parrot/LazyFileContent.hpp"
+#include "Parrot/LayeredFileContent.hpp"
+#include "Parrot/Schema.hpp"
+#include "Parrot/FunctionRegistry.hpp"
+#include "Parrot/CodeGenerator.hpp"
+#include "Parrot/Executor.hpp"
+#include "Parrot/ParseAwaitable.hpp"
+#include "Parrot/FileLoader.hpp"
+#include "Parrot/DirectoryParseResult.hpp"
+#include "Parrot/FragmentCache.hpp"
 
 #endif
@@ -0,0 +1,58 @@
+/* Over-aligned storage for numeric lists.
+ *
+ */
+
+#ifndef PARROT_ALIGNEDALLOCATOR_HPP
+#define PARROT_ALIGNEDALLOCATOR_HPP
+
+// ========================================================================== //
+// dependencies
+
+// STL
+#include <cstddef>
+#include <new>
+#include <vector>
+
+// ========================================================================== //
+
+namespace Parrot {
+
+  //! @brief alignment in bytes of numeric lists stored by a \c Parrot::Reader with \c setAlignNumericLists(true)
+  constexpr size_t numericListAlignment = 64;
+
+  // ======================================================================== //
+  // class
+
+  /**
+   * @brief a standard allocator that places every block on an \c Alignment
+   *    byte boundary.
+   *
+   * Used for numeric lists that are meant to be handed to vectorized code
+   *    directly; see \c Parrot::AlignedVector.
+   */
+  template<typename T, size_t Alignment = numericListAlignment>
+  struct AlignedAllocator {
+    static_assert(Alignment >= alignof(T) && (Alignment & (Alignment - 1)) == 0, "alignment must be a power of two not below alignof(T)");
+
+    using value_type = T;
+
+    template<typename U> struct rebind {using other = AlignedAllocator<U, Alignment>;};
+
+    AlignedAllocator() noexcept = default;
+    template<typename U> AlignedAllocator(const AlignedAllocator<U, Alignment> &) noexcept {}
+
+    T *   allocate  (size_t n)          {return static_cast<T *>( ::operator new(n * sizeof(T), std::align_val_t(Alignment)) );}
+    void  deallocate(T * p, size_t n)   {::operator delete(p, n * sizeof(T), std::align_val_t(Alignment));}
+
+    template<typename U> bool operator== (const AlignedAllocator<U, Alignment> &) const noexcept {return true ;}
+    template<typename U> bool operator!= (const AlignedAllocator<U, Alignment> &) const noexcept {return false;}
+  };
+
+  //! @brief a \c std::vector whose data are aligned to \c Parrot::numericListAlignment bytes
+  template<typename T>
+  using AlignedVector = std::vector<T, AlignedAllocator<T>>;
+}
+
+// ========================================================================== //
+
+#endif
@@ -0,0 +1,99 @@
+/* The words a Parrot::Reader accepts as true or false.
+ *
+ */
+
+#ifndef PARROT_BOOLEANVOCABULARY_HPP
+#define PARROT_BOOLEANVOCABULARY_HPP
+
+// ========================================================================== //
+// dependencies
+
+// STL
+#include <string>
+#include <string_view>
+#include <vector>
+#include <optional>
+
+// ========================================================================== //
+
+namespace Parrot {
+
+  // ======================================================================== //
+  // class
+
+  /**
+   * @brief recognizes the textual representations of boolean values.
+   *
+   * The words are compiled once on construction and cannot be changed
+   *    afterwards, so a vocabulary can be shared by any number of threads.
+   *    Each \c Parrot::Reader holds its own vocabulary (see
+   *    <tt>Parrot::Reader::setBooleanVocabulary()</tt>); the default one is
+   *    built from \c Parrot::defaultBooleanTextTrue and
+   *    \c Parrot::defaultBooleanTextFalse when the reader is reset.
+   *
+   * Words are grouped by their length, so \c recognize() only compares a
+   *    token against the few words of the same length and never allocates.
+   *    Unless the vocabulary is case sensitive, words and tokens are compared
+   *    with ASCII case folding.
+   */
+  class BooleanVocabulary {
+  private:
+    struct Word {
+      std::string text;                                                         // folded unless caseSensitive
+      bool        value;
+    };
+
+    std::vector<std::string>        wordsTrue;
+    std::vector<std::string>        wordsFalse;
+    bool                            caseSensitive = false;
+    std::vector<std::vector<Word>>  byLength;                                   // index: length of the word
+
+    void add(const std::string & word, bool value);
+
+  public:
+    // ---------------------------------------------------------------------- //
+    // CTors
+
+    //! compiles the words currently in \c Parrot::defaultBooleanTextTrue and \c Parrot::defaultBooleanTextFalse
+    BooleanVocabulary();
+    /**
+     * @brief compiles the given words.
+     *
+     * @throws std::invalid_argument if a word is empty or occurs in both
+     *    lists (after case folding, unless \c caseSensitive is set)
+     */
+    BooleanVocabulary(const std::vector<std::string> & wordsTrue,
+                      const std::vector<std::string> & wordsFalse,
+                      bool                             caseSensitive = false);
+
+    // ---------------------------------------------------------------------- //
+    // Getters
+
+    //! returns the words evaluated as \c true as given on construction
+    const std::vector<std::string> &  getWordsTrue      () const;
+    //! returns the words evaluated as \c false as given on construction
+    const std::vector<std::string> &  getWordsFalse     () const;
+    //! returns whether the words are compared case sensitively
+    bool                              isCaseSensitive   () const;
+
+    // ---------------------------------------------------------------------- //
+    // Recognition
+
+    /**
+     * @brief returns the value represented by \c token or \c std::nullopt if
+     *    \c token is not in the vocabulary.
+     *
+     * \c token is expected to be trimmed.
+     */
+    std::optional<bool>               recognize         (std::string_view token) const;
+
+    // ---------------------------------------------------------------------- //
+    // Representation
+
+    std::string                       to_string         () const;
+  };
+}
+
+// ========================================================================== //
+
+#endif
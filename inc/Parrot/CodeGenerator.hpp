@@ -0,0 +1,142 @@
+/* C++ source emitted for a fixed keyword schema.
+ *
+ */
+
+#ifndef PARROT_CODEGENERATOR_HPP
+#define PARROT_CODEGENERATOR_HPP
+
+// ========================================================================== //
+// dependencies
+
+// STL
+#include <string>
+#include <vector>
+
+// own
+#include "Parrot/Definitions.hpp"
+#include "Parrot/Descriptor.hpp"
+#include "Parrot/Schema.hpp"
+
+// ========================================================================== //
+
+namespace Parrot {
+
+  // ======================================================================== //
+  // class
+
+  /**
+   * @brief writes a header and a source file holding a settings struct and a
+   *    parser specialized for exactly one \c Parrot::Schema.
+   *
+   * The generated struct has one member of the matching C++ type per keyword,
+   *    initialized with its default value. Its static member \c load() reads a
+   *    .ini file like a \c Parrot::Reader with default settings would, but
+   *    without any of the runtime machinery:
+   *
+   * * keywords are dispatched by a \c switch over a hash of their name that
+   *   is computed when generating the code,
+   * * values are converted by inline functions straight into the members,
+   * * restrictions are checked as plain comparisons against literals.
+   *
+   * The generated files only depend on the standard library. Errors are
+   *    reported as \c std::runtime_error with the messages the
+   *    \c Parrot::Reader would use, warnings are written to a
+   *    \c std::ostream (\c std::cerr unless told otherwise).
+   *
+   * Differences to a \c Parrot::Reader are:
+   *
+   * * numbers are converted strictly, i.e. trailing characters and
+   *   expressions are not accepted,
+   * * unexpected keywords are reported but not stored,
+   * * keywords of type \c RealRange, \c Complex and \c ComplexList, user
+   *   preparsers and user defined validation functions are not supported.
+   *
+   * Member names are the keyword names qualified by their section, with all
+   *    characters that are not allowed in C++ identifiers replaced by
+   *    underscores, e.g. <tt>optics.mode</tt> becomes \c optics_mode.
+   *
+   * Example:
+   * @code
+   * Parrot::CodeGenerator generator(Parrot::Schema::load("schema.ini"), "Settings");
+   * generator.write("gen/Settings");                                   // gen/Settings.hpp and gen/Settings.cpp
+   *
+   * // in the application:
+   * auto settings = Settings::load("run.ini");
+   * @endcode
+   */
+  class CodeGenerator {
+  private:
+    struct Keyword {
+      const Descriptor *  descriptor;
+      std::string         name;                                                 // qualified key as matched in the file
+      std::string         member;                                               // C++ identifier in the struct
+    };
+
+    Schema                schema;
+    std::string           structName;
+    std::string           nameSpace;
+    std::vector<Keyword>  keywords;
+
+    void makeKeywords();
+
+  public:
+    // ---------------------------------------------------------------------- //
+    // CTors
+
+    /**
+     * @brief prepares the code for all keywords in \c schema
+     *
+     * @throws Parrot::ValueTypeError if a keyword has a type that cannot be
+     *    generated
+     * @throws Parrot::InvalidFunctionError if a keyword uses a user function
+     * @throws Parrot::RestrictionTypeError if a restriction cannot be
+     *    generated for the type of its keyword
+     * @throws Parrot::InvalidDescriptorError if \c structName is not a valid
+     *    identifier or two keywords map to the same member name
+     */
+    CodeGenerator(const Schema & schema, const std::string & structName = "Settings");
+
+    // ---------------------------------------------------------------------- //
+    // Getters
+
+    //! returns the name of the generated struct
+    const std::string & getStructName() const;
+    //! returns the namespace of the generated struct; empty for the global namespace
+    const std::string & getNamespace () const;
+    //! returns the member names of the generated struct in the order of the schema
+    std::vector<std::string> getMemberNames() const;
+
+    // ---------------------------------------------------------------------- //
+    // Setters
+
+    /**
+     * @brief puts the generated struct into \c newVal, e.g. \c app::config
+     *
+     * @throws Parrot::InvalidDescriptorError if \c newVal is not a valid
+     *    (possibly nested) namespace name
+     */
+    void setNamespace(const std::string & newVal);
+
+    // ---------------------------------------------------------------------- //
+    // Generation
+
+    //! returns the text of the header
+    std::string header() const;
+    //! returns the text of the source file, which includes the header as \c headerName
+    std::string source(const std::string & headerName) const;
+
+    /**
+     * @brief writes <tt>basename.hpp</tt> and <tt>basename.cpp</tt>
+     *
+     * The source file includes the header by its file name only, i.e. both
+     *    are expected to be found in the same directory.
+     *
+     * @throws std::runtime_error if a file cannot be written
+     */
+    void write(const std::string & basename) const;
+  };
+}
+
+// ========================================================================== //
+
+#endif
@@ -20,8 +20,13 @@
 #include <vector>
 #include <string>
 #include <any>
+#include <complex>
+#include <cstdint>
 #include <initializer_list>
 
+// own
+#include "Parrot/Range.hpp"
+
 // ========================================================================== //
 
 namespace Parrot {
@@ -78,6 +83,13 @@ namespace Parrot {
   PARROT_ERROR(KeywordParseError);
   // ........................................................................ //
 
+  /**
+   * @brief Error type thrown if a numeric expression cannot be compiled or
+   *    evaluated; see \c Parrot::Expression
+   */
+  PARROT_ERROR(ExpressionError);
+  // ........................................................................ //
+
 
   /**
    * @brief Error type thrown if a keyword was found where no Descriptor exists
@@ -108,6 +120,18 @@ namespace Parrot {
    *    to a specified keyword fails
    */
   PARROT_ERROR(ValueAccessError);
+  // ........................................................................ //
+  /**
+   * @brief Error type delivered by an asynchronous parsing process that was
+   *    cancelled before it started; see \c Parrot::CancellationToken
+   */
+  PARROT_ERROR(ParseCancelledError);
+  // ........................................................................ //
+  /**
+   * @brief Error type thrown if an included file cannot be read or includes
+   *    itself, directly or indirectly
+   */
+  PARROT_ERROR(IncludeError);
 
   // ======================================================================== //
   // types
@@ -133,13 +157,22 @@ namespace Parrot {
    *  <tr><td>\c IntegerList  <td> <tt>std::vector&lt;long long int&gt;</tt>
    *  <tr><td>\c RealList     <td> \c std::vector<double>
    *  <tr><td>\c BooleanList  <td> \c std::vector<bool>
+   *  <tr><td>\c RealRange    <td> \c Parrot::RealRange
+   *  <tr><td>\c Int32        <td> \c std::int32_t
+   *  <tr><td>\c Float32      <td> \c float
+   *  <tr><td>\c Complex      <td> <tt>std::complex&lt;double&gt;</tt>
+   *  <tr><td>\c Int32List    <td> <tt>std::vector&lt;std::int32_t&gt;</tt>
+   *  <tr><td>\c Float32List  <td> \c std::vector<float>
+   *  <tr><td>\c ComplexList  <td> <tt>std::vector&lt;std::complex&lt;double&gt;&gt;</tt>
    * </table>
    *
    * The corresponding C++ types will be invoked by means of the
    * \c PARROT_TYPE() macro.
    *
-   * @todo include a Complex and ComplexList type in the entire project
-   * @todo split into int32 and int64 data types
+   * The narrow types \c Int32 and \c Float32 halve the memory of large lists
+   *    of small indices or single precision parameters. The elements of a
+   *    \c ComplexList are stored contiguously as interleaved pairs of real and
+   *    imaginary part, as expected by FFT libraries.
    */
   enum class ValueTypeID {
     None,
@@ -150,7 +183,14 @@ namespace Parrot {
     StringList,
     IntegerList,
     RealList,
-    BooleanList
+    BooleanList,
+    RealRange,
+    Int32,
+    Float32,
+    Complex,
+    Int32List,
+    Float32List,
+    ComplexList
   };
   // ........................................................................ //
 
@@ -178,6 +218,13 @@ namespace Parrot {
   template<> struct ValueType<Parrot::ValueTypeID::IntegerList> {using value_type = std::vector<long long int>;};
   template<> struct ValueType<Parrot::ValueTypeID::RealList   > {using value_type = std::vector<double>;};
   template<> struct ValueType<Parrot::ValueTypeID::BooleanList> {using value_type = std::vector<bool>;};
+  template<> struct ValueType<Parrot::ValueTypeID::RealRange  > {using value_type = Parrot::RealRange;};
+  template<> struct ValueType<Parrot::ValueTypeID::Int32      > {using value_type = std::int32_t;};
+  template<> struct ValueType<Parrot::ValueTypeID::Float32    > {using value_type = float;};
+  template<> struct ValueType<Parrot::ValueTypeID::Complex    > {using value_type = std::complex<double>;};
+  template<> struct ValueType<Parrot::ValueTypeID::Int32List  > {using value_type = std::vector<std::int32_t>;};
+  template<> struct ValueType<Parrot::ValueTypeID::Float32List> {using value_type = std::vector<float>;};
+  template<> struct ValueType<Parrot::ValueTypeID::ComplexList> {using value_type = std::vector<std::complex<double>>;};
   // ........................................................................ //
 
   /**
@@ -200,6 +247,14 @@ namespace Parrot {
   extern const std::string TypeIDString_IntegerList;
   extern const std::string TypeIDString_RealList;
   extern const std::string TypeIDString_BooleanList;
+  extern const std::string TypeIDString_RealRange;
+
+  extern const std::string TypeIDString_Int32;
+  extern const std::string TypeIDString_Float32;
+  extern const std::string TypeIDString_Complex;
+  extern const std::string TypeIDString_Int32List;
+  extern const std::string TypeIDString_Float32List;
+  extern const std::string TypeIDString_ComplexList;
 
   // ------------------------------------------------------------------------ //
   // Restriction Types
@@ -217,8 +272,9 @@ namespace Parrot {
    *                                              <td> Allow all values except
    *                                                    those which are in a
    *                                                    given list
-   *  <tr><td>\c Range          <td> \c Integer, \c Real, \c IntegerList and
-   *                                  \c RealList
+   *  <tr><td>\c Range          <td> \c Integer, \c Real, \c IntegerList,
+   *                                  \c RealList, \c RealRange and their
+   *                                  32 bit counterparts
    *                                              <td> Allow all values between
    *                                                    an upper and a lower
    *                                                    boundary.<br>
@@ -232,6 +288,9 @@ namespace Parrot {
    *
    * For \c AllowedList and \c ForbiddenList see also
    * Parrot::isTypeCompatibleWithValidityList()
+   *
+   * \c Complex and \c ComplexList values have no order and may only be
+   *    restricted by a \c Function.
    */
   enum class RestrictionType {
     None,
@@ -271,10 +330,12 @@ namespace Parrot {
    *  <tr><th>RestrictionValueTypeID  <th>Compatible <tt>Parrot::ValueTypeID</tt>s
    *  <tr><td>None                    <td>(all)
    *  <tr><td>String                  <td>\c String and \c StringList
-   *  <tr><td>Integer                 <td>\c Integer and \c IntegerList
-   *  <tr><td>Real                    <td>\c Real and \c RealList
-   *  <tr><td>Numeric                 <td>\c Integer, \c Real as well as
-   *                                        \c IntegerList and \c RealList
+   *  <tr><td>Integer                 <td>\c Integer, \c IntegerList, \c Int32
+   *                                        and \c Int32List
+   *  <tr><td>Real                    <td>\c Real, \c RealList, \c RealRange,
+   *                                        \c Float32 and \c Float32List
+   *  <tr><td>Numeric                 <td>all types listed for \c Integer and
+   *                                        \c Real
    *  <tr><td>Boolean                 <td>\c Boolean and \c BooleanList
    *  <tr><td>StringList              <td>\c StringList
    *  <tr><td>IntegerList             <td>\c IntegerList
@@ -327,9 +388,15 @@ namespace Parrot {
   // ======================================================================== //
   // lookups
   
-  //! @brief list of strings that are evaluated as \c true
+  /**
+   * @brief list of strings that are evaluated as \c true
+   *
+   * Read only when a \c Parrot::BooleanVocabulary is default constructed,
+   *    i.e. when a \c Parrot::Reader is created or reset. Readers that
+   *    already exist are not affected by later changes.
+   */
   extern std::vector<std::string> defaultBooleanTextTrue;
-  //! @brief list of strings that are evaluated as \c false
+  //! @brief list of strings that are evaluated as \c false; see \c defaultBooleanTextTrue
   extern std::vector<std::string> defaultBooleanTextFalse;
   
   /**
@@ -348,6 +415,13 @@ namespace Parrot {
    *  <tr><td>\c IntegerList  <td>list of integers
    *  <tr><td>\c RealList     <td>list of real values
    *  <tr><td>\c BooleanList  <td>list of booleans
+   *  <tr><td>\c RealRange    <td>range of real values
+   *  <tr><td>\c Int32        <td>32 bit integer
+   *  <tr><td>\c Float32      <td>single precision real value
+   *  <tr><td>\c Complex      <td>complex value
+   *  <tr><td>\c Int32List    <td>list of 32 bit integers
+   *  <tr><td>\c Float32List  <td>list of single precision real values
+   *  <tr><td>\c ComplexList  <td>list of complex values
    *  <tr><td>(otherwise)     <td>(invalid state)
    * </table>
    */
@@ -413,6 +487,11 @@ namespace Parrot {
    *  <tr><th>\c RealList      <td>\c false  <td>\c false   <td>\c\b true <td>\c false   <td>\c false      <td>\c false       <td>\c\b true    <td>\c false
    *  <tr><th>\c BooleanList   <td>\c false  <td>\c false   <td>\c false  <td>\c false   <td>\c false      <td>\c false       <td>\c false     <td>\c false
    * </table>
+   *
+   * A \c RealRange behaves like a \c RealList, i.e. it is compatible with a
+   *    \c RealList only. \c Int32 and \c Int32List are compatible with an
+   *    \c IntegerList, \c Float32 and \c Float32List with a \c RealList.
+   *    Complex types are not compatible with any list.
    */
   bool isTypeCompatibleWithValidityList(const ValueTypeID & valueType, const ValueTypeID & listType);
 
@@ -426,9 +505,9 @@ namespace Parrot {
    *  <tr><th>RestrictionValueTypeID <th>return value
    *  <tr><td>\c None                <td>no type restriction
    *  <tr><td>\c String              <td>only compatible with Strings and StringLists
-   *  <tr><td>\c Integer             <td>only compatible with Integers and IntegerLists
-   *  <tr><td>\c Real                <td>only compatible with Reals and RealLists
-   *  <tr><td>\c Numeric             <td>only compatible with Integers, Reals, IntegerLists and RealLists
+   *  <tr><td>\c Integer             <td>only compatible with Integers and IntegerLists of any width
+   *  <tr><td>\c Real                <td>only compatible with Reals and RealLists of any precision, and RealRanges
+   *  <tr><td>\c Numeric             <td>only compatible with Integers, Reals, their Lists and RealRanges
    *  <tr><td>\c Boolean             <td>only compatible with Booleans and BooleanLists
    *  <tr><td>\c StringList          <td>only compatible with StringLists
    *  <tr><td>\c IntegerList         <td>only compatible with IntegerLists
@@ -481,14 +560,25 @@ namespace Parrot {
    *                            \c std::vector<std::string> can be constructed
    *  <tr><td>IntegerList <td> Any type, from which a
    *                            <tt>std::vector&lt;long long int&gt;</tt> can be
-   *                            constructed
+   *                            constructed, and \c std::vector of any integral
+   *                            type
    *  <tr><td>RealList    <td> Any type, from which a \c std::vector<double> can
-   *                            be constructed
+   *                            be constructed, and \c std::vector of any
+   *                            floating point type
    *  <tr><td>BooleanList <td> Any type, from which a \c std::vector<bool> can
    *                            be constructed
+   *  <tr><td>Complex     <td> \c std::complex of any floating point type
+   *  <tr><td>ComplexList <td> Any type, from which a
+   *                            <tt>std::vector&lt;std::complex&lt;double&gt;&gt;</tt>
+   *                            can be constructed, and \c std::vector of
+   *                            \c std::complex of any floating point type
    * </table>
    *
-   * @throws Parrot::ValueTypeError for all types not in the table.
+   * \c Int32 and \c Float32 are never deduced, since any integral and floating
+   *    point type maps to \c Integer and \c Real; request them explicitly by
+   *    their \c Parrot::ValueTypeID() or store them in an \c std::any.
+   *
+   * Types not in the table are rejected at compile time.
    */
   template<typename T>
   constexpr ValueTypeID valueTypeIDOf(const T & x);
@@ -505,6 +595,19 @@ namespace Parrot {
   template<typename T>
   constexpr ValueTypeID valueTypeIDOf(const std::initializer_list<T> & x);
 
+  /**
+   * @brief returns \c x converted to the C++ type of the
+   *    \c Parrot::ValueTypeID() that \c valueTypeIDOf() deduces for it, e.g. a
+   *    \c std::vector<int> as a <tt>std::vector&lt;long long&gt;</tt>.
+   *
+   * The conversion is selected at compile time, so no run time type lookup is
+   *    involved.
+   *
+   * Types not supported by \c valueTypeIDOf() are rejected at compile time.
+   */
+  template<typename T>
+  std::any toParrotValue(const T & x);
+
   /**
    * @brief returns a textual representation of any compatible expression.
    *
@@ -525,7 +628,10 @@ namespace Parrot {
    *  <tr><td>\c RealList    <td> Output of \c BCG::vector_to_string()
    *  <tr><td>\c BooleanList <td> A string comprising of \c 1 for every \c true and
    *                           a \c o for every \c false
+   *  <tr><td>\c Complex     <td> <tt>re+imi</tt>, e.g. \c 1.000000-2.000000i
    * </table>
+   *
+   * The 32 bit types and lists are written like their wide counterparts.
    */
   const std::string getAnyText(const std::any & x, const ValueTypeID & T);
 
@@ -547,6 +653,9 @@ namespace Parrot {
   /**
    * @brief returns the \c Parrot::ValueTypeID() of an object stored in an std::any.
    *
+   * A \c Parrot::AlignedVector counts as the list type of its elements, e.g.
+   *    one of \c float as \c Float32List.
+   *
    * @throws Parrot::ValueTypeError if the the data type stored in \c x is not
    *    one specified by the \c Parrot::ValueTypeID() enum.
    */
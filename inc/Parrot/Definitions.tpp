@@ -2,34 +2,72 @@
 // dependencies
 
 // STL
-#include <stdexcept>
+#include <type_traits>
 
 // ========================================================================== //
-// local macro
+// local traits
 
-#define THROWTEXT(msg) (std::string("RUNTIME EXCEPTION IN ") + (__PRETTY_FUNCTION__) + "\n" + msg)
+namespace Parrot {
+  template<typename T>                    struct ListElement                          {using type = void;};
+  template<typename T, typename Allocator> struct ListElement<std::vector<T, Allocator>> {using type = T;};
+
+  template<typename T>                    struct IsComplex                   : std::false_type {};
+  template<typename T>                    struct IsComplex<std::complex<T>>  : std::true_type  {};
+}
 
 // ========================================================================== //
 // type interpreters
 
 template<typename T>
 constexpr Parrot::ValueTypeID Parrot::valueTypeIDOf([[maybe_unused]] const T & x) {
-  if      ( std::is_same          <PARROT_TYPE(Parrot::ValueTypeID::Boolean    ), T>::value ) {return Parrot::ValueTypeID::Boolean    ;}
-  else if ( std::is_integral      <                                               T>::value ) {return Parrot::ValueTypeID::Integer    ;}
-  else if ( std::is_floating_point<                                               T>::value ) {return Parrot::ValueTypeID::Real       ;}
-  else if ( std::is_constructible <PARROT_TYPE(Parrot::ValueTypeID::String     ), T>::value ) {return Parrot::ValueTypeID::String     ;}
-  else if ( std::is_constructible <PARROT_TYPE(Parrot::ValueTypeID::StringList ), T>::value ) {return Parrot::ValueTypeID::StringList ;}
-  else if ( std::is_constructible <std::vector<const char *>,                     T>::value ) {return Parrot::ValueTypeID::StringList ;}
-  else if ( std::is_constructible <PARROT_TYPE(Parrot::ValueTypeID::BooleanList), T>::value ) {return Parrot::ValueTypeID::BooleanList;}
-  else if ( std::is_constructible <PARROT_TYPE(Parrot::ValueTypeID::IntegerList), T>::value ) {return Parrot::ValueTypeID::IntegerList;}
-  else if ( std::is_constructible <PARROT_TYPE(Parrot::ValueTypeID::RealList   ), T>::value ) {return Parrot::ValueTypeID::RealList   ;}
-  else {throw Parrot::ValueTypeError(THROWTEXT("    Type not supported."));}
+  if      constexpr ( std::is_same          <PARROT_TYPE(Parrot::ValueTypeID::Boolean    ), T>::value ) {return Parrot::ValueTypeID::Boolean    ;}
+  else if constexpr ( std::is_same          <PARROT_TYPE(Parrot::ValueTypeID::RealRange  ), T>::value ) {return Parrot::ValueTypeID::RealRange  ;}
+  else if constexpr ( std::is_same          <PARROT_TYPE(Parrot::ValueTypeID::Complex    ), T>::value ) {return Parrot::ValueTypeID::Complex    ;}
+  else if constexpr ( Parrot::IsComplex     <                                               T>::value ) {return Parrot::ValueTypeID::Complex    ;}
+  else if constexpr ( std::is_integral      <                                               T>::value ) {return Parrot::ValueTypeID::Integer    ;}
+  else if constexpr ( std::is_floating_point<                                               T>::value ) {return Parrot::ValueTypeID::Real       ;}
+  else if constexpr ( std::is_constructible <PARROT_TYPE(Parrot::ValueTypeID::String     ), T>::value ) {return Parrot::ValueTypeID::String     ;}
+  else if constexpr ( std::is_constructible <PARROT_TYPE(Parrot::ValueTypeID::StringList ), T>::value ) {return Parrot::ValueTypeID::StringList ;}
+  else if constexpr ( std::is_constructible <std::vector<const char *>,                     T>::value ) {return Parrot::ValueTypeID::StringList ;}
+  else if constexpr ( std::is_constructible <PARROT_TYPE(Parrot::ValueTypeID::BooleanList), T>::value ) {return Parrot::ValueTypeID::BooleanList;}
+  else if constexpr ( std::is_constructible <PARROT_TYPE(Parrot::ValueTypeID::IntegerList), T>::value ) {return Parrot::ValueTypeID::IntegerList;}
+  else if constexpr ( std::is_constructible <PARROT_TYPE(Parrot::ValueTypeID::RealList   ), T>::value ) {return Parrot::ValueTypeID::RealList   ;}
+  else if constexpr ( std::is_constructible <PARROT_TYPE(Parrot::ValueTypeID::ComplexList), T>::value ) {return Parrot::ValueTypeID::ComplexList;}
+  else if constexpr ( std::is_integral      <typename Parrot::ListElement<T>::type        >::value ) {return Parrot::ValueTypeID::IntegerList;}
+  else if constexpr ( std::is_floating_point<typename Parrot::ListElement<T>::type        >::value ) {return Parrot::ValueTypeID::RealList   ;}
+  else if constexpr ( Parrot::IsComplex     <typename Parrot::ListElement<T>::type        >::value ) {return Parrot::ValueTypeID::ComplexList;}
+  else {static_assert(!sizeof(T *), "type not supported by Parrot::valueTypeIDOf()");}
 }
 // ........................................................................ //
 template<typename T>
 constexpr Parrot::ValueTypeID Parrot::valueTypeIDOf(const std::initializer_list<T> & x) {return valueTypeIDOf(std::vector<T>(x));}
 
+// -------------------------------------------------------------------------- //
 
-// ========================================================================== //
+template<typename T>
+std::any Parrot::toParrotValue(const T & x) {
+  using Element = typename ListElement<T>::type;
 
-#undef THROWTEXT
+  if      constexpr ( std::is_same_v          <PARROT_TYPE(ValueTypeID::Boolean    ), T> ) {return x;}
+  else if constexpr ( std::is_same_v          <PARROT_TYPE(ValueTypeID::RealRange  ), T> ) {return x;}
+  else if constexpr ( IsComplex               <                                       T>::value ) {return PARROT_TYPE(ValueTypeID::Complex)(x);}
+  else if constexpr ( std::is_integral_v      <                                       T> ) {return PARROT_TYPE(ValueTypeID::Integer)(x);}
+  else if constexpr ( std::is_floating_point_v<                                       T> ) {return PARROT_TYPE(ValueTypeID::Real   )(x);}
+  else if constexpr ( std::is_constructible_v <PARROT_TYPE(ValueTypeID::String     ), T> ) {return PARROT_TYPE(ValueTypeID::String    )(x);}
+  else if constexpr ( std::is_constructible_v <PARROT_TYPE(ValueTypeID::StringList ), T> ) {return PARROT_TYPE(ValueTypeID::StringList)(x);}
+  else if constexpr ( std::is_constructible_v <std::vector<const char *>,             T> ) {
+    const std::vector<const char *> list(x);
+    return PARROT_TYPE(ValueTypeID::StringList)(list.begin(), list.end());
+  }
+  else if constexpr ( std::is_constructible_v <PARROT_TYPE(ValueTypeID::BooleanList), T> ) {return PARROT_TYPE(ValueTypeID::BooleanList)(x);}
+  else if constexpr ( std::is_constructible_v <PARROT_TYPE(ValueTypeID::IntegerList), T> ) {return PARROT_TYPE(ValueTypeID::IntegerList)(x);}
+  else if constexpr ( std::is_constructible_v <PARROT_TYPE(ValueTypeID::RealList   ), T> ) {return PARROT_TYPE(ValueTypeID::RealList   )(x);}
+  else if constexpr ( std::is_constructible_v <PARROT_TYPE(ValueTypeID::ComplexList), T> ) {return PARROT_TYPE(ValueTypeID::ComplexList)(x);}
+  else if constexpr ( std::is_integral_v      <Element                                 > ) {return PARROT_TYPE(ValueTypeID::IntegerList)(x.begin(), x.end());}
+  else if constexpr ( std::is_floating_point_v<Element                                 > ) {return PARROT_TYPE(ValueTypeID::RealList   )(x.begin(), x.end());}
+  else if constexpr ( IsComplex               <Element                                 >::value ) {return PARROT_TYPE(ValueTypeID::ComplexList)(x.begin(), x.end());}
+  else {static_assert(!sizeof(T *), "type not supported by Parrot::toParrotValue()");}
+}
+
+
+// ========================================================================== //
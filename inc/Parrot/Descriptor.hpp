@@ -63,6 +63,7 @@ namespace Parrot {
   class Descriptor {
   private:
     std::string   key;
+    std::string   section;                                                      // empty for keywords before the first [section] header
     std::any      value;                                                        // default value, if 'key' is not in file
     ValueTypeID   valueTypeID = ValueTypeID::None;
     
@@ -86,15 +87,7 @@ namespace Parrot {
     // ---------------------------------------------------------------------- //
     // Rectifyers
 
-    void rectify();                                                             // make sure an arbitrary input type gets mapped to the corresponding Parrot type.
-    void rectify_String     ();
-    void rectify_Integer    ();
-    void rectify_Real       ();
-    void rectify_Boolean    ();
-    void rectify_StringList ();
-    void rectify_IntegerList();
-    void rectify_RealList   ();
-    void rectify_BooleanList();
+    void rectify();                                                             // hand over aligned lists from setValueAny() as plain Parrot lists
 
   public:
     // ---------------------------------------------------------------------- //
@@ -119,6 +112,10 @@ namespace Parrot {
     
     //! returns the name of the keyword
     const std::string getKey          () const;
+    //! returns the name of the section the keyword belongs to (empty for the global section)
+    const std::string getSection      () const;
+    //! returns <tt>section.key</tt>, or only \c key for the global section
+    const std::string getQualifiedKey () const;
     //! returns the default value for the keyword
     std::any          getValue        () const;
     //! returns the \c ValueTypeID() of the keyword
@@ -178,7 +175,7 @@ namespace Parrot {
     
     //! restores the state as if initialized by the empty CTor
     void reset ();
-    //! sets the keyword to emtpy
+    //! sets the keyword and the section to emtpy
     void resetKey();
     //! removes the default value and value type
     void resetValue();
@@ -189,6 +186,14 @@ namespace Parrot {
 
     //! sets the keyword name
     void setKey (const std::string & newVal);
+    /**
+     * @brief sets the section in which the keyword is expected
+     *
+     * A section starts with a line <tt>[name]</tt> and extends up to the next
+     *    such line. Keywords before the first section header belong to the
+     *    global section, denoted by the empty string.
+     */
+    void setSection (const std::string & newVal);
 
     /**
      * @brief sets a new default value
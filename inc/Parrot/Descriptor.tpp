@@ -49,12 +49,14 @@ Parrot::Descriptor::Descriptor(
 
 template<typename T>
 void Parrot::Descriptor::setValue(const T & newVal, bool resetMetaData) {
-  valueTypeID = valueTypeIDOf(newVal);
-  value = newVal;
-  rectify();
+  if constexpr ( std::is_same_v<T, std::any> ) {setValueAny(newVal, resetMetaData);}   // no type to deduce from
+  else {
+    valueTypeID = valueTypeIDOf(newVal);
+    value       = toParrotValue(newVal);
 
-  resetParsing();
-  if (resetMetaData) {this->resetMetaData();}
+    resetParsing();
+    if (resetMetaData) {this->resetMetaData();}
+  }
 }
 // ........................................................................ //
 template<typename T>
@@ -202,9 +204,12 @@ void Parrot::Descriptor::makeUserboundAftParse(const std::string &
                                        const std::string &                                                    restrictionViolationText,
                                        bool                                                                   M
 ) {
-  if ( T != valueTypeIDOf( AT() ) ) {
+  auto rst = Restriction(policy, restrictionViolationText);
+  rst.setAftParseValidationFunction(uFunc);
+
+  if ( T != rst.getAftParseValidator().getValueTypeID() ) {
     throw Parrot::RestrictionTypeError(THROWTEXT(
-      "    Type "s + valueTypeName(T) + " not compatible type of user validation argument (" + valueTypeName(valueTypeIDOf( AT() )) + ")"
+      "    Type "s + valueTypeName(T) + " not compatible type of user validation argument (" + valueTypeName(rst.getAftParseValidator().getValueTypeID()) + ")"
     ));
   }
 
@@ -213,8 +218,6 @@ void Parrot::Descriptor::makeUserboundAftParse(const std::string &
   valueTypeID = T;
   setMandatory(M);
 
-  auto rst = Restriction(policy, restrictionViolationText);
-  rst.setAftParseValidationFunction(uFunc);
   addRestriction(rst);
 
 }
@@ -0,0 +1,211 @@
+/* Structured diagnostic messages emitted by a Parrot::Reader and the sinks
+ * that receive them.
+ *
+ */
+
+#ifndef PARROT_DIAGNOSTICS_HPP
+#define PARROT_DIAGNOSTICS_HPP
+
+// ========================================================================== //
+// dependencies
+
+// STL
+#include <string>
+#include <vector>
+#include <deque>
+#include <map>
+#include <memory>
+
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+
+// ========================================================================== //
+
+namespace Parrot {
+
+  // ======================================================================== //
+  // types
+
+  /**
+   * @brief categorizes the events a \c Parrot::Reader reports during a
+   *    parsing process.
+   *
+   * To get a human-readable representation of a \c Parrot::DiagnosticKind, use
+   *  \c Parrot::diagnosticKindName()
+   */
+  enum class DiagnosticKind {
+    MissingKeyword,
+    UnexpectedKeyword,
+    DuplicateKeyword,
+    ConversionError,
+    RestrictionViolation,
+    MalformedLine,
+    InconsistentState,
+    FileAccess,
+    IncludeCycle,
+    Summary
+  };
+
+  /**
+   * @brief returns a human readable string to a \c Parrot::DiagnosticKind()
+   *
+   * Implements a simple lookup.
+   */
+  const std::string diagnosticKindName(const DiagnosticKind & T);
+
+  /**
+   * @brief one message of a parsing process, together with the state of the
+   *    parser at the time it was emitted.
+   *
+   * \c line is -1 if the message does not refer to a specific line, e.g. for
+   *    missing keywords or the summary of verbose mode. \c keyword is empty if
+   *    not applicable.
+   */
+  struct DiagnosticRecord {
+    DiagnosticKind  kind    = DiagnosticKind::Summary;
+    std::string     file;
+    int             line    = -1;
+    std::string     keyword;
+    std::string     message;
+  };
+
+  // ======================================================================== //
+  // sinks
+
+  /**
+   * @brief receives the <tt>Parrot::DiagnosticRecord</tt>s of a
+   *    \c Parrot::Reader.
+   *
+   * A \c Parrot::Reader forwards all warnings and the verbose mode summary to
+   *    its sink (see \c Parrot::Reader::setDiagnosticSink()). \c beginParse and
+   *    \c endParse bracket each call to the \c Parrot::Reader; \c endParse is
+   *    also called if the parsing process is aborted by an exception.
+   *
+   * Sinks may be shared among several readers; implementations of \c write
+   *    should hence be thread safe.
+   */
+  class DiagnosticSink {
+  public:
+    virtual ~DiagnosticSink() = default;
+
+    //! called once per message
+    virtual void write      (const DiagnosticRecord & record) = 0;
+    //! called before the first line of \c source is read
+    virtual void beginParse (const std::string & source) {(void) source;}
+    //! called after the parsing process has finished or was aborted
+    virtual void endParse   () {}
+  };
+
+  // ------------------------------------------------------------------------ //
+
+  /**
+   * @brief writes warnings via \c BCG::writeWarning and the verbose summary to
+   *    \c stdout, as soon as they are emitted.
+   *
+   * This is the default sink of a \c Parrot::Reader.
+   */
+  class StderrDiagnosticSink : public DiagnosticSink {
+  private:
+    std::mutex  mtx;
+
+  public:
+    void write (const DiagnosticRecord & record) override;
+  };
+
+  // ------------------------------------------------------------------------ //
+
+  /**
+   * @brief collects all messages of a parsing process and forwards them to a
+   *    target sink in one go when the parse is done.
+   *
+   * Each parse is buffered separately, keyed by the thread that called
+   *    \c beginParse, so the sink may be shared by concurrent parses, e.g.
+   *    those of \c Parrot::Reader::parseBatch(). \c endParse forwards only
+   *    the records of the parse of the calling thread, and no two parses are
+   *    forwarded at the same time; the records of a parse hence arrive at
+   *    the target as one block.
+   *
+   * If no target is given, the records of finished parses are retained until
+   *    \c clear() is called and can be inspected with \c getRecords(). This
+   *    allows to process the diagnostics programmatically instead of printing
+   *    them. Records written outside of a parse are retained the same way.
+   */
+  class BufferedDiagnosticSink : public DiagnosticSink {
+  private:
+    struct ParseBuffer {
+      size_t                        depth = 0;                                  // nested beginParse calls
+      std::vector<DiagnosticRecord> records;
+    };
+
+    mutable std::mutex                      mtx;
+    std::vector<DiagnosticRecord>           records;                            // of finished parses
+    std::map<std::thread::id, ParseBuffer>  open;                               // of parses in progress, by thread
+    std::shared_ptr<DiagnosticSink>         target;
+    std::mutex                              targetMtx;                          // keeps forwarded parses apart
+
+    void forward(const std::vector<DiagnosticRecord> & pending);
+
+  public:
+    BufferedDiagnosticSink(std::shared_ptr<DiagnosticSink> target = nullptr);
+
+    void write      (const DiagnosticRecord & record) override;
+    //! opens the buffer of the calling thread
+    void beginParse (const std::string & source) override;
+    //! forwards the records of the calling thread to the target sink if any, or retains them
+    void endParse   () override;
+
+    //! returns a copy of the records of finished parses
+    std::vector<DiagnosticRecord> getRecords () const;
+    //! returns the number of records of finished parses
+    size_t                        size       () const;
+    //! forwards the records of finished parses to the target sink, if any, and discards them
+    void                          flush      ();
+    //! discards the records of finished parses without forwarding them
+    void                          clear      ();
+  };
+
+  // ------------------------------------------------------------------------ //
+
+  /**
+   * @brief forwards messages to a target sink from a background thread.
+   *
+   * \c write only enqueues the record, so the parsing process never waits for
+   *    terminal or file output. The order of the messages is preserved.
+   *    \c flush() blocks until the queue is empty; the destructor drains the
+   *    queue before joining the background thread.
+   *
+   * Messages are delivered in order, though asynchronously: output of the
+   *    sink may appear after output of the calling thread.
+   */
+  class AsyncDiagnosticSink : public DiagnosticSink {
+  private:
+    std::mutex                      mtx;
+    std::condition_variable         cvQueue;                                    // signals new records or shutdown
+    std::condition_variable         cvDrained;                                  // signals an empty queue
+    std::deque<DiagnosticRecord>    queue;
+    std::shared_ptr<DiagnosticSink> target;
+    bool                            busy     = false;                           // background thread is writing a record
+    bool                            stopping = false;
+    std::thread                     worker;
+
+    void drain();
+
+  public:
+    //! uses a \c Parrot::StderrDiagnosticSink if \c target is \c nullptr
+    AsyncDiagnosticSink(std::shared_ptr<DiagnosticSink> target = nullptr);
+    ~AsyncDiagnosticSink();
+
+    AsyncDiagnosticSink(const AsyncDiagnosticSink &)             = delete;
+    AsyncDiagnosticSink & operator=(const AsyncDiagnosticSink &) = delete;
+
+    void write    (const DiagnosticRecord & record) override;
+
+    //! blocks until all enqueued records have been written to the target sink
+    void flush();
+  };
+}
+
+// ========================================================================== //
+
+#endif
@@ -0,0 +1,76 @@
+/* Results of parsing all matching files in a directory tree.
+ *
+ */
+
+#ifndef PARROT_DIRECTORYPARSERESULT_HPP
+#define PARROT_DIRECTORYPARSERESULT_HPP
+
+// ========================================================================== //
+// dependencies
+
+// STL
+#include <string>
+#include <vector>
+#include <map>
+
+// own
+#include "Parrot/Definitions.hpp"
+#include "Parrot/Diagnostics.hpp"
+#include "Parrot/ParseResult.hpp"
+
+// ========================================================================== //
+
+namespace Parrot {
+
+  // ======================================================================== //
+  // class
+
+  /**
+   * @brief the outcome of <tt>Parrot::Reader::parseDirectory()</tt>.
+   *
+   * Holds one \c Parrot::ParseResult per file, keyed by its path, and all
+   *    messages the files produced on the diagnostic sink. Since the files
+   *    are parsed without throwing, a failure in one file does not affect the
+   *    others; \c ok() tells whether all of them were parsed without error.
+   */
+  class DirectoryParseResult {
+  private:
+    std::map<std::string, ParseResult>  files;
+    std::vector<DiagnosticRecord>       diagnostics;
+
+  public:
+    // ---------------------------------------------------------------------- //
+    // CTors
+
+    DirectoryParseResult() = default;
+    DirectoryParseResult(std::map<std::string, ParseResult> && files, std::vector<DiagnosticRecord> && diagnostics);
+
+    // ---------------------------------------------------------------------- //
+    // Getters
+
+    //! returns true if no error occurred in any file
+    bool                                        ok              () const;
+    //! returns the number of files parsed
+    size_t                                      size            () const;
+    //! returns whether \c path was parsed
+    bool                                        contains        (const std::string & path) const;
+
+    /**
+     * @brief returns the result of \c path, spelled as in \c getFiles()
+     *
+     * @throws Parrot::ValueAccessError if \c path was not parsed
+     */
+    const ParseResult &                         operator[]      (const std::string & path) const;
+
+    //! returns the results of all files, ordered by path
+    const std::map<std::string, ParseResult> &  getFiles        () const;
+    //! returns the paths of all files with errors, ordered by path
+    std::vector<std::string>                    getFailedFiles  () const;
+    //! returns the messages of all files, grouped by file in the order of \c getFiles()
+    const std::vector<DiagnosticRecord> &       getDiagnostics  () const;
+  };
+}
+
+// ========================================================================== //
+
+#endif
@@ -0,0 +1,143 @@
+/* Executors running the asynchronous parsing processes of a Parrot::Reader,
+ * and the token that cancels them.
+ *
+ */
+
+#ifndef PARROT_EXECUTOR_HPP
+#define PARROT_EXECUTOR_HPP
+
+// ========================================================================== //
+// dependencies
+
+// STL
+#include <deque>
+#include <vector>
+#include <memory>
+#include <functional>
+
+#include <atomic>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+
+// ========================================================================== //
+
+namespace Parrot {
+
+  // ======================================================================== //
+  // executors
+
+  /**
+   * @brief runs the tasks of asynchronous parsing processes.
+   *
+   * A \c Parrot::Reader hands each call to \c Parrot::Reader::parseAsync() to
+   *    its executor (see \c Parrot::Reader::setExecutor()) as one or two
+   *    tasks. Implementations decide where and when the tasks run; they must
+   *    run each task exactly once. Executors may be shared among several
+   *    readers; implementations of \c submit should hence be thread safe.
+   *
+   * Tasks do not throw; errors of the parsing process are delivered through
+   *    the future or awaitable.
+   */
+  class Executor {
+  public:
+    virtual ~Executor() = default;
+
+    //! schedules \c task for execution
+    virtual void submit(std::function<void ()> task) = 0;
+  };
+
+  // ------------------------------------------------------------------------ //
+
+  /**
+   * @brief runs each task immediately in the calling thread.
+   *
+   * With this executor, \c Parrot::Reader::parseAsync() returns a future that
+   *    is already ready, which makes asynchronous code deterministic in tests.
+   */
+  class InlineExecutor : public Executor {
+  public:
+    void submit(std::function<void ()> task) override;
+  };
+
+  // ------------------------------------------------------------------------ //
+
+  /**
+   * @brief runs tasks on a fixed number of background threads in the order
+   *    they were submitted.
+   *
+   * The destructor runs all tasks still enqueued before joining the threads.
+   *
+   * This is the default executor of a \c Parrot::Reader; see
+   *    \c Parrot::defaultExecutor().
+   */
+  class ThreadPoolExecutor : public Executor {
+  private:
+    std::mutex                          mtx;
+    std::condition_variable             cvQueue;                                // signals new tasks or shutdown
+    std::deque<std::function<void ()>>  queue;
+    bool                                stopping = false;
+    std::vector<std::thread>            workers;
+
+    void work();
+
+  public:
+    //! starts \c threads threads; 0 selects the number of hardware threads
+    ThreadPoolExecutor(size_t threads = 0);
+    ~ThreadPoolExecutor();
+
+    ThreadPoolExecutor(const ThreadPoolExecutor &)             = delete;
+    ThreadPoolExecutor & operator=(const ThreadPoolExecutor &) = delete;
+
+    void   submit (std::function<void ()> task) override;
+
+    //! returns the number of threads
+    size_t size   () const;
+  };
+
+  // ------------------------------------------------------------------------ //
+
+  /**
+   * @brief returns the thread pool shared by all readers that have no
+   *    executor of their own.
+   *
+   * The pool has one thread per hardware thread and is only started on the
+   *    first call.
+   */
+  const std::shared_ptr<Executor> & defaultExecutor();
+
+  // ======================================================================== //
+  // cancellation
+
+  /**
+   * @brief allows to withdraw asynchronous parsing processes that have not
+   *    started yet.
+   *
+   * Copies of a token share their state, i.e. cancelling one copy cancels
+   *    all of them. A parsing process checks its token before reading the
+   *    file and again before parsing; once it is parsing, it runs to
+   *    completion. A cancelled process delivers a
+   *    \c Parrot::ParseCancelledError instead of its result.
+   *
+   * Example:
+   * @code
+   * Parrot::CancellationToken token;
+   * auto result = reader.parseAsync("run.ini", token);
+   * token.cancel();                                                     // result.get() throws unless parsing already began
+   * @endcode
+   */
+  class CancellationToken {
+  private:
+    std::shared_ptr<std::atomic<bool>> cancelled = std::make_shared<std::atomic<bool>>(false);
+
+  public:
+    //! marks all processes sharing this token as cancelled
+    void cancel      () const;
+    //! returns whether \c cancel() was called on this token or a copy of it
+    bool isCancelled () const;
+  };
+}
+
+// ========================================================================== //
+
+#endif
@@ -0,0 +1,170 @@
+/* Compiled arithmetic expressions for numeric keyword values.
+ *
+ */
+
+#ifndef PARROT_EXPRESSION_HPP
+#define PARROT_EXPRESSION_HPP
+
+// ========================================================================== //
+// dependencies
+
+// STL
+#include <string>
+#include <vector>
+#include <map>
+#include <unordered_map>
+#include <memory>
+#include <functional>
+#include <shared_mutex>
+
+// own
+#include "Parrot/Definitions.hpp"
+
+// ========================================================================== //
+
+namespace Parrot {
+
+  // ======================================================================== //
+  // class
+
+  /**
+   * @brief an arithmetic expression compiled to a postfix program.
+   *
+   * Understood are decimal numbers (including exponents like \c 1E-6), the
+   *    binary operators <tt>+ - * / ^</tt>, unary signs, parentheses and
+   *    names. A number directly followed by a name or a parenthesis is a
+   *    product, e.g. \c 2PI. Implicit products bind like \c *, and \c ^ is
+   *    right associative and binds stronger than a unary sign, i.e.
+   *    <tt>-2^2</tt> is \c -4.
+   *
+   * Names found in the table of constants passed to \c compile() are
+   *    replaced by their values, and all operations on constants are carried
+   *    out at compile time. Any other name is kept as a reference that is
+   *    looked up on each evaluation, e.g. the value of a keyword parsed
+   *    earlier. An expression without references thus evaluates to a stored
+   *    number.
+   */
+  class Expression {
+  public:
+    //! the instructions of the postfix program
+    enum class OpCode {
+      Push,                                                                     // push value
+      Load,                                                                     // push the value of name
+      Add,
+      Sub,
+      Mul,
+      Div,
+      Pow,
+      Neg
+    };
+
+    //! one step of the postfix program
+    struct Instruction {
+      OpCode      op;
+      double      value = 0;
+      std::string name;
+
+      Instruction(OpCode op, double value = 0, const std::string & name = "") : op(op), value(value), name(name) {}
+    };
+
+    //! returns the value of a referenced name or throws \c Parrot::ExpressionError
+    using Resolver = std::function<double (const std::string & name)>;
+
+  private:
+    std::string               text;
+    std::vector<Instruction>  program;
+    size_t                    depth = 0;                                        // stack size needed by evaluate()
+
+  public:
+    // ---------------------------------------------------------------------- //
+    // CTors
+
+    /**
+     * @brief compiles \c text, replacing the names in \c constants by their
+     *    values.
+     *
+     * Names are compared with the keys of \c constants ignoring case; the
+     *    keys are expected in upper case. References to other names keep
+     *    their spelling.
+     *
+     * @throws Parrot::ExpressionError if \c text is not a valid expression
+     */
+    static Expression compile(const std::string & text, const std::map<std::string, double> & constants = {});
+
+    // ---------------------------------------------------------------------- //
+    // Getters
+
+    //! returns the compiled text
+    const std::string &               getText     () const;
+    //! returns the postfix program
+    const std::vector<Instruction> &  getProgram  () const;
+    //! returns whether the expression does not reference any names
+    bool                              isConstant  () const;
+    //! returns the names referenced by the expression
+    std::vector<std::string>          getReferences() const;
+
+    // ---------------------------------------------------------------------- //
+    // Evaluation
+
+    /**
+     * @brief runs the program, looking up referenced names with \c resolve.
+     *
+     * @throws Parrot::ExpressionError if a name is referenced and \c resolve
+     *    is empty, as well as anything thrown by \c resolve
+     */
+    double                            evaluate    (const Resolver & resolve = nullptr) const;
+
+    // ---------------------------------------------------------------------- //
+    // Representation
+
+    //! returns the program in postfix notation
+    std::string                       to_string   () const;
+  };
+
+  // ======================================================================== //
+  // class
+
+  /**
+   * @brief compiles each expression text once and keeps the result.
+   *
+   * The cache belongs to a \c Parrot::Reader and is shared by its copies and
+   *    by all threads parsing with it, so it is safe for concurrent use. Since
+   *    constants are folded into the programs, a cache is bound to one table
+   *    of constants; changing the constants of a reader gives it a new cache.
+   */
+  class ExpressionCache {
+  private:
+    std::map<std::string, double>                                                 constants;
+    mutable std::shared_mutex                                                     mutex;
+    mutable std::unordered_map<std::string, std::shared_ptr<const Expression>>    programs;
+
+  public:
+    // ---------------------------------------------------------------------- //
+    // CTors
+
+    //! a cache with the constants \c PI and \c E
+    ExpressionCache();
+    //! a cache with the given constants; names are expected in upper case
+    ExpressionCache(const std::map<std::string, double> & constants);
+
+    // ---------------------------------------------------------------------- //
+    // Getters
+
+    //! returns the constants folded into all programs
+    const std::map<std::string, double> & getConstants() const;
+    //! returns the number of compiled expressions
+    size_t                                size        () const;
+
+    /**
+     * @brief returns the compiled form of \c text, compiling it on first use
+     *
+     * @throws Parrot::ExpressionError if \c text is not a valid expression;
+     *    invalid texts are not cached
+     */
+    std::shared_ptr<const Expression>     get         (const std::string & text) const;
+  };
+}
+
+// ========================================================================== //
+
+#endif
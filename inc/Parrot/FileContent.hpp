@@ -10,14 +10,22 @@
 
 // STL
 #include <string>
+#include <string_view>
 #include <any>
 
 #include <vector>
 #include <map>
 #include <tuple>
+#include <optional>
+#include <memory>
+#include <memory_resource>
+#include <span>
 
 // own
 #include "Parrot/Definitions.hpp"
+#include "Parrot/KeywordTable.hpp"
+#include "Parrot/AlignedAllocator.hpp"
+#include "Parrot/KeyHandle.hpp"
 
 // ========================================================================== //
 
@@ -31,6 +39,22 @@ namespace Parrot {
    *    correctly-typed automated access
    *
    * Instances of this class are returned by the \c Parrot::Reader class
+   *
+   * Keywords known to the \c Parrot::KeywordTable of the reader are stored
+   *    in slots indexed by their ID, so the keyword names are kept only once
+   *    per reader rather than once per file. All other keywords (e.g.
+   *    unexpected keywords or keywords added by the user) are stored by name.
+   *
+   * The slots, the map nodes and the names of keywords not in the table can
+   *    be allocated from a caller-supplied \c std::pmr::memory_resource, e.g.
+   *    a \c std::pmr::monotonic_buffer_resource that is released in one step
+   *    once the content is no longer needed. The values themselves are held
+   *    in \c std::any objects, which allocate larger payloads (strings,
+   *    lists) from the global heap; these are outside of the resource.
+   *    Moving a \c Parrot::FileContent keeps its resource; copies use the
+   *    default resource.
+   *
+   * Each keyword also records the line it was read from (see \c getLine()).
    */
 
   class FileContent {
@@ -38,8 +62,9 @@ namespace Parrot {
     /**
      * @brief a container holding all data associated with a keyword
      *
-     * This type is used internally and returned by the member function
-     *    \c FileContent::get() and \c FileContent::getContent().
+     * This type is used internally and returned by the member functions
+     *    \c FileContent::get() and \c FileContent::toMap(), and passed to
+     *    the visitor of \c FileContent::forEach().
      *
      * For convenience, the indices are labelled in the enum
      *    \c FileContent::FileContentElements()
@@ -63,13 +88,36 @@ namespace Parrot {
   };
 
   private:
+    struct Entry {
+      ContentType data;
+      int         line = -1;                                                    // -1 if not read from a file
+    };
+
+    struct KeyLess {                                                            // finds std::pmr::string keys by std::string
+      using is_transparent = void;
+      bool operator() (std::string_view lhs, std::string_view rhs) const {return lhs < rhs;}
+    };
+
     std::string                        source = "<user defined>";
-    std::map<std::string, ContentType> content;
+    std::shared_ptr<const KeywordTable>       keywords;                         // may be nullptr
+    std::pmr::vector<std::optional<Entry>>    slots;                            // indexed with the IDs of keywords
+    std::pmr::map<std::pmr::string, Entry, KeyLess> others;                     // keywords not in the table
+    size_t                                    slotsUsed = 0;
 
     // ---------------------------------------------------------------------- //
     // safe getter
 
-    ContentType getSafe (const std::string & key) const;
+    const ContentType & getSafe (const std::string & key) const;
+    const ContentType * find    (const std::string & key) const;                // nullptr if key does not exist
+    const Entry *       entry   (const std::string & key) const;                // nullptr if key does not exist
+    Entry *             entry   (const std::string & key);
+    void                store   (const std::string & key, ContentType && data);
+    void                store   (KeywordTable::ID  id , ContentType && data);
+
+    [[noreturn]] void   throwMissing(KeywordTable::ID id) const;                // throws ValueAccessError
+    void                checkTable  (const std::shared_ptr<const KeywordTable> & table, KeywordTable::ID id) const;  // throws ValueAccessError unless id names the same keyword in keywords
+
+    friend class LayeredFileContent;
 
   public:
     // ---------------------------------------------------------------------- //
@@ -97,6 +145,12 @@ namespace Parrot {
       operator PARROT_TYPE(ValueTypeID::IntegerList) ();
       operator PARROT_TYPE(ValueTypeID::RealList   ) ();
       operator PARROT_TYPE(ValueTypeID::BooleanList) ();
+      operator PARROT_TYPE(ValueTypeID::RealRange  ) ();
+      operator PARROT_TYPE(ValueTypeID::Int32      ) ();
+      operator PARROT_TYPE(ValueTypeID::Float32    ) ();
+      operator PARROT_TYPE(ValueTypeID::Int32List  ) ();
+      operator PARROT_TYPE(ValueTypeID::Float32List) ();
+      operator PARROT_TYPE(ValueTypeID::ComplexList) ();
     };
 
     // ---------------------------------------------------------------------- //
@@ -105,6 +159,23 @@ namespace Parrot {
     FileContent() = default;
     //! Constructs an empty \c Parrot::FileContent object and sets the source tag
     FileContent(const std::string & source);
+    /**
+     * @brief Constructs an empty \c Parrot::FileContent object that allocates
+     *    its elements from \c resource
+     *
+     * \c resource must outlive the object.
+     */
+    FileContent(const std::string & source, std::pmr::memory_resource * resource);
+    /**
+     * @brief Constructs an empty \c Parrot::FileContent object with one slot
+     *    per keyword in \c keywords
+     *
+     * The table must not change while it is shared; \c Parrot::Reader copies
+     *    its table before adding keywords if results still refer to it.
+     */
+    FileContent(const std::string &                   source,
+                std::shared_ptr<const KeywordTable>   keywords,
+                std::pmr::memory_resource *           resource = std::pmr::get_default_resource());
 
     // ---------------------------------------------------------------------- //
     // Getters
@@ -126,8 +197,28 @@ namespace Parrot {
     //! returns all keyword names as a \c std::vector
     std::vector<std::string>                    getKeywords() const;
 
-    //! returns the \c std::map underlying the \c Parrot::FileContent object
-    const std::map<std::string, ContentType> &  getContent() const;
+    /**
+     * @brief returns a copy of all keywords and their data as a \c std::map
+     *
+     * Keywords of the \c Parrot::KeywordTable are stored in slots rather than
+     *    in a map, so there is no map to refer to. The map is built on each
+     *    call, copying every name and value; use \c forEach() to inspect all
+     *    keywords without copies.
+     */
+    std::map<std::string, ContentType>          toMap     () const;
+    /**
+     * @brief calls <tt>visit(std::string_view key, const ContentType & data)</tt>
+     *    for each keyword, without copying its name or data
+     *
+     * The keywords of the \c Parrot::KeywordTable come first, in the order
+     *    of their IDs, followed by all other keywords in alphabetical order.
+     */
+    template <typename F>
+    void                                        forEach   (F && visit) const;
+    //! returns the memory resource from which the elements are allocated
+    std::pmr::memory_resource *                 getResource() const;
+    //! returns the table of interned keywords, or nullptr if there is none
+    const std::shared_ptr<const KeywordTable> & getKeywordTable() const;
     // ...................................................................... //
 
     /**
@@ -138,6 +229,15 @@ namespace Parrot {
      *    recorded data
      */
     ContentType                                 get                 (const std::string & key) const;
+    /**
+     * @brief @overload looks up the keyword by its ID in the
+     *    \c Parrot::KeywordTable, without hashing its name
+     *
+     * @throws Parrot::ValueAccessError if there is no such keyword
+     */
+    ContentType                                 get                 (KeywordTable::ID    id ) const;
+    //! returns \c true if the keyword with ID \c id is part of the recorded data
+    bool                                        hasKeyword          (KeywordTable::ID    id ) const;
     /**
      * @brief returns the keyword value as a std::any object
      *
@@ -168,6 +268,14 @@ namespace Parrot {
      *    recorded data
      */
     bool                                        getTriggeredWarning (const std::string & key) const;
+    /**
+     * @brief returns the number of the line from which the keyword value was
+     *    read, or -1 if it was not read from a file (e.g. a default value)
+     *
+     * @throws Parrot::ValueAccessError if the requested keyword is not part
+     *    of the recorded data
+     */
+    int                                         getLine             (const std::string & key) const;
 
 
     // ---------------------------------------------------------------------- //
@@ -261,6 +369,68 @@ namespace Parrot {
      *    recorded data
      */
     PARROT_TYPE(ValueTypeID::BooleanList)       get_BooleanList     (const std::string & key) const;
+    /**
+     * @brief get the value associated with a keyword and explicitly cast it to
+     *    a \c Parrot::RealRange
+     *
+     * The range is not materialized; use \c Parrot::RealRange::materialize()
+     *    to obtain a list.
+     *
+     * @throws Parrot::ValueAccessError if the requested keyword is not part of
+     *    the recorded data
+     */
+    PARROT_TYPE(ValueTypeID::RealRange  )       get_RealRange       (const std::string & key) const;
+    //! @overload returns the value of a \c Int32 keyword; see \c get_Integer()
+    PARROT_TYPE(ValueTypeID::Int32      )       get_Int32           (const std::string & key) const;
+    //! @overload returns the value of a \c Float32 keyword; see \c get_Real()
+    PARROT_TYPE(ValueTypeID::Float32    )       get_Float32         (const std::string & key) const;
+    /**
+     * @brief get the value associated with a keyword and explicitly cast it to
+     *    a *Parrot* complex value
+     *
+     * Unlike the other types, complex values are not available through the
+     *    automatic cast of <tt>operator[]</tt>, since
+     *    <tt>std::complex&lt;double&gt;</tt> can also be constructed from a
+     *    \c double.
+     *
+     * @throws Parrot::ValueAccessError if the requested keyword is not part of
+     *    the recorded data
+     */
+    PARROT_TYPE(ValueTypeID::Complex    )       get_Complex         (const std::string & key) const;
+    //! @overload returns the value of a \c Int32List keyword; see \c get_IntegerList()
+    PARROT_TYPE(ValueTypeID::Int32List  )       get_Int32List       (const std::string & key) const;
+    //! @overload returns the value of a \c Float32List keyword; see \c get_RealList()
+    PARROT_TYPE(ValueTypeID::Float32List)       get_Float32List     (const std::string & key) const;
+    //! @overload returns the value of a \c ComplexList keyword; see \c get_RealList()
+    PARROT_TYPE(ValueTypeID::ComplexList)       get_ComplexList     (const std::string & key) const;
+
+    /**
+     * @brief returns a view of the integer list associated with a keyword
+     *    without copying it
+     *
+     * The view remains valid until the keyword is updated or the object is
+     *    destroyed. If the list was stored by a \c Parrot::Reader with
+     *    <tt>setAlignNumericLists(true)</tt>, its data are aligned to
+     *    \c Parrot::numericListAlignment bytes.
+     *
+     * @throws Parrot::ValueAccessError if the requested keyword is not part of
+     *    the recorded data
+     * @throws std::bad_any_cast if the value is not an integer list
+     */
+    std::span<const PARROT_TYPE(ValueTypeID::Integer)> getSpan_IntegerList (const std::string & key) const;
+    //! @overload returns a view of a real list; see \c getSpan_IntegerList()
+    std::span<const PARROT_TYPE(ValueTypeID::Real   )> getSpan_RealList    (const std::string & key) const;
+    //! @overload returns a view of a 32 bit integer list; see \c getSpan_IntegerList()
+    std::span<const PARROT_TYPE(ValueTypeID::Int32  )> getSpan_Int32List   (const std::string & key) const;
+    //! @overload returns a view of a single precision real list; see \c getSpan_IntegerList()
+    std::span<const PARROT_TYPE(ValueTypeID::Float32)> getSpan_Float32List (const std::string & key) const;
+    /**
+     * @overload returns a view of a complex list; see \c getSpan_IntegerList()
+     *
+     * The elements are pairs of real and imaginary part, so the view can be
+     *    handed to FFT libraries as an array of <tt>2 * size()</tt> doubles.
+     */
+    std::span<const PARROT_TYPE(ValueTypeID::Complex)> getSpan_ComplexList (const std::string & key) const;
 
 
     /**
@@ -313,6 +483,25 @@ namespace Parrot {
     template <typename T>
     T getValue (const std::string & key) const;
 
+    /**
+     * @brief returns a reference to the value of the keyword referred to by
+     *    \c handle (see \c Parrot::Reader::handle())
+     *
+     * The keyword and its type were checked when the handle was created, so
+     *    for contents sharing the \c Parrot::KeywordTable of the handle this
+     *    is a bounds checked array access: no keyword is hashed and nothing
+     *    is copied. The reference remains valid until the keyword is updated
+     *    or the object is destroyed.
+     *
+     * @throws Parrot::ValueAccessError if the keyword is not part of the
+     *    recorded data, or if the handle was created for another
+     *    \c Parrot::KeywordTable in which the keyword has a different ID
+     * @throws std::bad_any_cast if the value was replaced by one of another
+     *    type, e.g. via \c setElement()
+     */
+    template <typename T>
+    const T & get (const KeyHandle<T> & handle) const;
+
     // ---------------------------------------------------------------------- //
     // Setters
 
@@ -421,6 +610,32 @@ namespace Parrot {
                         bool                foundInFile      = false,
                         bool                triggeredWarning = false);
 
+    // ...................................................................... //
+
+    //! @overload addresses the keyword by its ID in the \c Parrot::KeywordTable
+    void addElement    (KeywordTable::ID    id,
+                        const std::any &    value,
+                        bool                foundInFile      = false,
+                        bool                triggeredWarning = false);
+    //! @overload addresses the keyword by its ID in the \c Parrot::KeywordTable
+    void updateElement (KeywordTable::ID    id,
+                        const std::any &    value,
+                        bool                foundInFile      = false,
+                        bool                triggeredWarning = false);
+
+    // ...................................................................... //
+
+    /**
+     * @brief sets the number of the line from which the keyword value was
+     *    read. \c addElement() and \c setElement() reset it to -1, while
+     *    \c updateElement() keeps it.
+     *
+     * @throws Parrot::ValueAccessError if keyword does not exist
+     */
+    void setLine       (const std::string & key, int line);
+    //! @overload addresses the keyword by its ID in the \c Parrot::KeywordTable
+    void setLine       (KeywordTable::ID    id,  int line);
+
     // ---------------------------------------------------------------------- //
     // Representation
 
@@ -456,6 +671,25 @@ namespace Parrot {
 
 template <typename T>
 T Parrot::FileContent::getValue (const std::string & key) const {return std::any_cast<T>(getAny(key));}
+// .......................................................................... //
+template <typename F>
+void Parrot::FileContent::forEach (F && visit) const {
+  for (auto id = 0u; id < slots.size(); ++id) {
+    if (slots[id]) {visit(keywords->name(id), slots[id]->data);}
+  }
+  for (const auto & [key, entry] : others) {visit(key, entry.data);}
+}
+// .......................................................................... //
+template <typename T>
+const T & Parrot::FileContent::get (const KeyHandle<T> & handle) const {
+  auto id = handle.getID();
+  if (handle.getKeywordTable() != keywords) {checkTable(handle.getKeywordTable(), id);}
+  if (id >= slots.size() || !slots[id]) {throwMissing(id);}
+
+  auto value = std::any_cast<T>( &std::get<Value>(slots[id]->data) );
+  if (!value) {throw std::bad_any_cast();}
+  return *value;
+}
 
 // ========================================================================== //
 
@@ -0,0 +1,116 @@
+/* Loaders reading many files into memory at once for Parrot::Reader::parseBatch.
+ *
+ */
+
+#ifndef PARROT_FILELOADER_HPP
+#define PARROT_FILELOADER_HPP
+
+// ========================================================================== //
+// dependencies
+
+// STL
+#include <string>
+#include <vector>
+#include <memory>
+#include <functional>
+#include <exception>
+
+// ========================================================================== //
+
+namespace Parrot {
+
+  // ======================================================================== //
+  // loaders
+
+  /**
+   * @brief reads the complete text of a list of files.
+   *
+   * \c load() hands each file to \c done as soon as it has been read, in the
+   *    order the reads complete, and returns when all files have been handed
+   *    over. Files that cannot be read are handed over with an empty text and
+   *    the error. Files without a known size, such as pipes or the files in
+   *    \c /proc, are read until their end. Implementations may call \c done
+   *    from several threads at the same time.
+   *
+   * A \c Parrot::Reader uses its loader in \c Parrot::Reader::parseBatch();
+   *    see \c Parrot::Reader::setFileLoader().
+   */
+  class FileLoader {
+  public:
+    //! receives the index of a file in the list, its text and the error, if any
+    using Completion = std::function<void (size_t index, std::string && text, std::exception_ptr error)>;
+
+    virtual ~FileLoader() = default;
+
+    //! reads all of \c files, calling \c done once per file
+    virtual void load(const std::vector<std::string> & files, const Completion & done) = 0;
+  };
+
+  // ------------------------------------------------------------------------ //
+
+  /**
+   * @brief reads each file with one \c open, \c fstat, \c pread and
+   *    \c close, on a number of threads started for each call to \c load().
+   *    Files without a known size are read with \c read until their end.
+   *
+   * Unlike a \c std::fstream, the text is read into its final buffer
+   *    without intermediate buffering. Works on all POSIX systems; \c done is
+   *    called from the loading threads.
+   */
+  class PreadFileLoader : public FileLoader {
+  private:
+    size_t threads;
+
+  public:
+    //! uses \c threads threads; 0 selects the number of hardware threads
+    PreadFileLoader(size_t threads = 0);
+
+    void load(const std::vector<std::string> & files, const Completion & done) override;
+  };
+
+  // ------------------------------------------------------------------------ //
+
+  /**
+   * @brief reads files through an \c io_uring (Linux 5.6 and newer).
+   *
+   * Opening, measuring, reading and closing the files is submitted to the
+   *    kernel in batches of up to \c depth files, with one system call per
+   *    batch rather than four per file. \c done is called from the thread
+   *    that called \c load().
+   *
+   * Use \c isAvailable() to check whether the running kernel supports this;
+   *    \c Parrot::defaultFileLoader() does so and falls back to a
+   *    \c Parrot::PreadFileLoader otherwise.
+   */
+  class IoUringFileLoader : public FileLoader {
+  private:
+    unsigned depth;
+
+  public:
+    //! keeps up to \c depth files in flight
+    IoUringFileLoader(unsigned depth = 64);
+
+    //! returns whether an \c io_uring with the required operations can be set up
+    static bool isAvailable();
+
+    /**
+     * @brief reads all of \c files, calling \c done once per file
+     *
+     * @throws std::runtime_error if the \c io_uring cannot be set up
+     */
+    void load(const std::vector<std::string> & files, const Completion & done) override;
+  };
+
+  // ------------------------------------------------------------------------ //
+
+  /**
+   * @brief returns the loader used by all readers that have none of their
+   *    own: a \c Parrot::IoUringFileLoader if available, else a
+   *    \c Parrot::PreadFileLoader.
+   */
+  const std::shared_ptr<FileLoader> & defaultFileLoader();
+}
+
+// ========================================================================== //
+
+#endif
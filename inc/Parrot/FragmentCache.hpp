@@ -0,0 +1,92 @@
+/* Included files, parsed once and spliced into every file that includes them.
+ *
+ */
+
+#ifndef PARROT_FRAGMENTCACHE_HPP
+#define PARROT_FRAGMENTCACHE_HPP
+
+// ========================================================================== //
+// dependencies
+
+// STL
+#include <string>
+#include <map>
+#include <tuple>
+#include <memory>
+#include <filesystem>
+#include <shared_mutex>
+
+// ========================================================================== //
+
+namespace Parrot {
+
+  // ======================================================================== //
+  // class
+
+  /**
+   * @brief keeps the parsed form of each file included via the include
+   *    directive of a \c Parrot::Reader (see
+   *    \c Parrot::Reader::setIncludeKeyword()).
+   *
+   * A fragment is the record of everything parsing the file did: values
+   *    stored, messages and errors. Splicing it into an including file
+   *    replays that record, so a base file shared by many configurations is
+   *    read, split and converted only once.
+   *
+   * Fragments are stored by path, the section in effect at the directive and
+   *    whether errors were collected (see \c Parrot::Reader::tryParse()).
+   *    They are only used while the modification time and size of the file
+   *    are the same as when it was parsed.
+   *
+   * Like the \c Parrot::ExpressionCache, the cache belongs to a
+   *    \c Parrot::Reader and is shared by its copies and by all threads
+   *    parsing with it, so it is safe for concurrent use. Since fragments
+   *    hold values converted by the keywords and settings of the reader,
+   *    changing any of these gives the reader a new cache.
+   */
+  class FragmentCache {
+  public:
+    //! the parsed form of one file; defined by the parser
+    struct Fragment;
+
+  private:
+    using Key = std::tuple<std::string, std::string, bool>;                     // path, section, errors collected
+
+    struct Entry {
+      std::filesystem::file_time_type   modified;
+      std::uintmax_t                    size;
+      std::shared_ptr<const Fragment>   fragment;
+    };
+
+    mutable std::shared_mutex     mutex;
+    mutable std::map<Key, Entry>  entries;
+
+  public:
+    // ---------------------------------------------------------------------- //
+    // Getters
+
+    //! returns the number of fragments
+    size_t                          size () const;
+
+    /**
+     * @brief returns the fragment of \c path parsed in \c section, or
+     *    \c nullptr if there is none or the file has changed since
+     */
+    std::shared_ptr<const Fragment> find (const std::string & path, const std::string & section, bool collectErrors,
+                                          std::filesystem::file_time_type modified, std::uintmax_t size) const;
+
+    // ---------------------------------------------------------------------- //
+    // Setters
+
+    //! stores \c fragment, replacing an older version of the same file
+    void                            store(const std::string & path, const std::string & section, bool collectErrors,
+                                          std::filesystem::file_time_type modified, std::uintmax_t size,
+                                          std::shared_ptr<const Fragment> fragment) const;
+    //! discards all fragments
+    void                            clear() const;
+  };
+}
+
+// ========================================================================== //
+
+#endif
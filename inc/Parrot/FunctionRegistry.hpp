@@ -0,0 +1,121 @@
+/* User functions bound by name to the keywords of a loaded schema image.
+ *
+ */
+
+#ifndef PARROT_FUNCTIONREGISTRY_HPP
+#define PARROT_FUNCTIONREGISTRY_HPP
+
+// ========================================================================== //
+// dependencies
+
+// STL
+#include <string>
+#include <vector>
+#include <map>
+#include <functional>
+
+// own
+#include "Parrot/Definitions.hpp"
+#include "Parrot/Restriction.hpp"
+
+// ========================================================================== //
+
+namespace Parrot {
+
+  // ======================================================================== //
+  // class
+
+  /**
+   * @brief the user functions of a schema, stored by keyword name.
+   *
+   * Preparsers and user defined validation functions cannot be written to a
+   *    schema image (see \c Parrot::Schema::saveImage()); the image only
+   *    records where they were. On loading the image, they are taken from a
+   *    \c Parrot::FunctionRegistry under the qualified name of their keyword,
+   *    e.g. <tt>section.key</tt>. If a keyword has several restrictions with
+   *    a function of the same kind, the functions registered for that keyword
+   *    are bound in order.
+   *
+   * Names are compared ignoring case. As everywhere in \c Parrot, validation
+   *    functions applied after parsing must be plain functions.
+   *
+   * Example:
+   * @code
+   * bool isEven(const PARROT_TYPE(Parrot::ValueTypeID::Integer) & n) {return n % 2 == 0;}
+   *
+   * Parrot::FunctionRegistry registry;
+   * registry.addAftParseFunction("N_photons", std::function(isEven));
+   * reader.loadSchemaImage("schema.img", registry);
+   * @endcode
+   */
+  class FunctionRegistry {
+  public:
+    //! a function transforming the text read for a keyword; see \c Parrot::Descriptor::setUserPreParser()
+    using PreParser         = std::function<PARROT_TYPE(ValueTypeID::String) (const PARROT_TYPE(ValueTypeID::String) &)>;
+    //! a validation function applied before parsing
+    using PreParseFunction  = std::function<bool (const PARROT_TYPE(ValueTypeID::String) &)>;
+    //! installs a typed validation function applied after parsing in a \c Parrot::Restriction
+    using Binder            = std::function<void (Restriction &)>;
+
+  private:
+    std::map<std::string, PreParser>                      preParsers;
+    std::map<std::string, std::vector<PreParseFunction>>  preParseFunctions;
+    std::map<std::string, std::vector<Binder>>            aftParseFunctions;
+
+    static std::string normalize(const std::string & keyword);
+
+  public:
+    // ---------------------------------------------------------------------- //
+    // Getters
+
+    //! returns the preparser of \c keyword or an empty function
+    PreParser         getPreParser        (const std::string & keyword) const;
+
+    /**
+     * @brief returns the <tt>index</tt><sup>th</sup> pre-parse validation
+     *    function of \c keyword
+     *
+     * @throws Parrot::InvalidFunctionError if there is no such function
+     */
+    PreParseFunction  getPreParseFunction (const std::string & keyword, size_t index) const;
+
+    /**
+     * @brief returns the <tt>index</tt><sup>th</sup> after-parse validation
+     *    function of \c keyword, ready to be installed in a
+     *    \c Parrot::Restriction
+     *
+     * @throws Parrot::InvalidFunctionError if there is no such function
+     */
+    const Binder &    getAftParseFunction (const std::string & keyword, size_t index) const;
+
+    // ---------------------------------------------------------------------- //
+    // Setters
+
+    //! sets the preparser of \c keyword
+    void setPreParser         (const std::string & keyword, const PreParser & uFunc);
+    //! appends a validation function applied to the text of \c keyword before parsing
+    void addPreParseFunction  (const std::string & keyword, const PreParseFunction & uFunc);
+
+    /**
+     * @brief appends a validation function applied to the value of
+     *    \c keyword after parsing
+     *
+     * \c T is the C++ type of a \c Parrot::ValueTypeID(), as in
+     *    \c Parrot::Restriction::setAftParseValidationFunction().
+     */
+    template<typename T>
+    void addAftParseFunction  (const std::string & keyword, const std::function<bool (const T &)> & uFunc);
+
+    //! removes all functions
+    void clear();
+  };
+}
+
+// ========================================================================== //
+// template implementations
+
+#include "Parrot/FunctionRegistry.tpp"
+
+// ========================================================================== //
+
+#endif
@@ -0,0 +1,17 @@
+// ========================================================================= //
+// dependencies
+
+// STL
+#include <functional>
+#include <string>
+
+// own
+#include "Parrot/Restriction.hpp"
+
+// ========================================================================== //
+// Setters
+
+template<typename T>
+void Parrot::FunctionRegistry::addAftParseFunction(const std::string & keyword, const std::function<bool (const T &)> & uFunc) {
+  aftParseFunctions[normalize(keyword)].push_back([uFunc] (Restriction & restriction) {restriction.setAftParseValidationFunction(uFunc);});
+}
@@ -0,0 +1,118 @@
+/* A typed reference to a keyword, resolved once and read without lookup.
+ *
+ */
+
+#ifndef PARROT_KEYHANDLE_HPP
+#define PARROT_KEYHANDLE_HPP
+
+// ========================================================================== //
+// dependencies
+
+// STL
+#include <type_traits>
+#include <memory>
+
+// own
+#include "Parrot/Definitions.hpp"
+#include "Parrot/KeywordTable.hpp"
+
+// ========================================================================== //
+
+namespace Parrot {
+  class Reader;
+
+  // ======================================================================== //
+  // class
+
+  /**
+   * @brief the ID of a keyword registered with a \c Parrot::Reader, together
+   *    with the C++ type of its value.
+   *
+   * Handles are created by \c Parrot::Reader::handle(), which looks up the
+   *    keyword and checks \c T against its \c Parrot::ValueTypeID once.
+   *    Reading a value through a handle with
+   *    <tt>Parrot::FileContent::get(const KeyHandle<T> &)</tt> then indexes
+   *    the slots of the content directly and returns a reference, without
+   *    hashing the keyword or copying the value:
+   * @code
+   * auto epsilon = reader.handle<PARROT_TYPE(Parrot::ValueTypeID::Real)>("epsilon_convergence");
+   * ...
+   * while (residual > content.get(epsilon)) { ... }
+   * @endcode
+   *
+   * \c T must be one of the types named by \c PARROT_TYPE(), e.g. \c double
+   *    for \c Real and \c float for \c Float32.
+   *
+   * A handle shares the \c Parrot::KeywordTable of its reader. Contents
+   *    created with the same table are read with a single comparison more.
+   *    For contents parsed after further keywords were added, the keyword of
+   *    the handle is compared by name, since the reader then works on a copy
+   *    of the table. Handles of other readers, or from before
+   *    \c Parrot::Reader::resetKeywords(), are rejected unless the keyword
+   *    has the same ID in the content. Create handles after registering all
+   *    keywords to stay on the fast path.
+   */
+  template <typename T>
+  class KeyHandle {
+  public:
+    //! the C++ type of the value
+    using value_type = T;
+
+  private:
+    static constexpr ValueTypeID typeOf();                                      // the ValueTypeID whose PARROT_TYPE is exactly T
+
+    std::shared_ptr<const KeywordTable> table;                                  // of the reader at creation
+    KeywordTable::ID                    id = KeywordTable::npos;
+
+    KeyHandle(std::shared_ptr<const KeywordTable> table, KeywordTable::ID id) : table(std::move(table)), id(id) {}
+
+    friend class Reader;
+
+  public:
+    //! the \c Parrot::ValueTypeID of the value
+    static constexpr ValueTypeID valueTypeID = typeOf();
+
+    // ---------------------------------------------------------------------- //
+    // CTors
+
+    //! creates a handle that refers to no keyword
+    KeyHandle() = default;
+
+    // ---------------------------------------------------------------------- //
+    // Getters
+
+    //! returns the ID of the keyword in the \c Parrot::KeywordTable of the reader
+    KeywordTable::ID                            getID          () const {return id;}
+    //! returns the table in which \c getID() was assigned, or \c nullptr for default constructed handles
+    const std::shared_ptr<const KeywordTable> & getKeywordTable() const {return table;}
+    //! returns \c false for default constructed handles
+    bool                                        valid          () const {return id != KeywordTable::npos;}
+  };
+}
+
+// ========================================================================== //
+// template implementations
+
+template <typename T>
+constexpr Parrot::ValueTypeID Parrot::KeyHandle<T>::typeOf() {
+  if      constexpr ( std::is_same_v<PARROT_TYPE(ValueTypeID::String     ), T> ) {return ValueTypeID::String     ;}
+  else if constexpr ( std::is_same_v<PARROT_TYPE(ValueTypeID::Integer    ), T> ) {return ValueTypeID::Integer    ;}
+  else if constexpr ( std::is_same_v<PARROT_TYPE(ValueTypeID::Real       ), T> ) {return ValueTypeID::Real       ;}
+  else if constexpr ( std::is_same_v<PARROT_TYPE(ValueTypeID::Boolean    ), T> ) {return ValueTypeID::Boolean    ;}
+  else if constexpr ( std::is_same_v<PARROT_TYPE(ValueTypeID::StringList ), T> ) {return ValueTypeID::StringList ;}
+  else if constexpr ( std::is_same_v<PARROT_TYPE(ValueTypeID::IntegerList), T> ) {return ValueTypeID::IntegerList;}
+  else if constexpr ( std::is_same_v<PARROT_TYPE(ValueTypeID::RealList   ), T> ) {return ValueTypeID::RealList   ;}
+  else if constexpr ( std::is_same_v<PARROT_TYPE(ValueTypeID::BooleanList), T> ) {return ValueTypeID::BooleanList;}
+  else if constexpr ( std::is_same_v<PARROT_TYPE(ValueTypeID::RealRange  ), T> ) {return ValueTypeID::RealRange  ;}
+  else if constexpr ( std::is_same_v<PARROT_TYPE(ValueTypeID::Int32      ), T> ) {return ValueTypeID::Int32      ;}
+  else if constexpr ( std::is_same_v<PARROT_TYPE(ValueTypeID::Float32    ), T> ) {return ValueTypeID::Float32    ;}
+  else if constexpr ( std::is_same_v<PARROT_TYPE(ValueTypeID::Complex    ), T> ) {return ValueTypeID::Complex    ;}
+  else if constexpr ( std::is_same_v<PARROT_TYPE(ValueTypeID::Int32List  ), T> ) {return ValueTypeID::Int32List  ;}
+  else if constexpr ( std::is_same_v<PARROT_TYPE(ValueTypeID::Float32List), T> ) {return ValueTypeID::Float32List;}
+  else if constexpr ( std::is_same_v<PARROT_TYPE(ValueTypeID::ComplexList), T> ) {return ValueTypeID::ComplexList;}
+  else {static_assert(!std::is_same_v<T, T>, "KeyHandle: T must be a Parrot value type, see PARROT_TYPE()");}
+}
+
+// ========================================================================== //
+
+#endif
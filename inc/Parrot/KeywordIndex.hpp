@@ -0,0 +1,135 @@
+/* Byte offsets of the keywords in a file, used to parse keywords on demand.
+ *
+ */
+
+#ifndef PARROT_KEYWORDINDEX_HPP
+#define PARROT_KEYWORDINDEX_HPP
+
+// ========================================================================== //
+// dependencies
+
+// STL
+#include <string>
+#include <vector>
+#include <map>
+
+#include <ios>
+#include <cstdint>
+
+// ========================================================================== //
+
+namespace Parrot {
+
+  // ======================================================================== //
+  // class
+
+  /**
+   * @brief maps each keyword of a file to the location of its logical line(s).
+   *
+   * A \c Parrot::KeywordIndex is created by
+   *    <tt>Parrot::Reader::indexKeywords()</tt>. The scan only determines the
+   *    keyword name of each logical line (including line continuations) and
+   *    records byte offset, length and line number; values are neither
+   *    trimmed nor converted nor validated. A \c Parrot::LazyFileContent uses
+   *    the index to parse a keyword only when it is first requested.
+   *
+   * Keywords are stored in the form used by the \c Parrot::FileContent, i.e.
+   *    qualified with their section and in upper case unless the
+   *    \c Parrot::Reader treats keywords case sensitively.
+   *
+   * The index can be saved next to the file. It records size and
+   *    modification time of the file as well as the markers of the
+   *    \c Parrot::Reader that created it, so a stale index can be detected
+   *    with \c isCurrent().
+   */
+  class KeywordIndex {
+  public:
+    //! location of one logical line
+    struct Span {
+      std::streamoff  offset    = 0;                                            // first byte of the line
+      size_t          length    = 0;                                            // bytes up to and including the last line break
+      int             firstLine = 0;                                            // number of lines before the span
+    };
+
+    //! all occurrences of one keyword; more than one span indicates duplicates
+    struct Entry {
+      std::string       section;
+      std::vector<Span> spans;
+    };
+
+  private:
+    std::map<std::string, Entry>  entries;
+
+    std::string                   source;
+    std::uintmax_t                fileSize  = 0;
+    std::int64_t                  fileTime  = 0;
+    std::string                   signature;                                    // settings of the Reader that determine keyword names
+
+  public:
+    // ---------------------------------------------------------------------- //
+    // CTors
+
+    KeywordIndex() = default;
+
+    /**
+     * @brief loads an index previously written with \c save()
+     *
+     * @throws std::runtime_error if the file cannot be read or is not an index
+     */
+    static KeywordIndex load(const std::string & filename);
+
+    // ---------------------------------------------------------------------- //
+    // Getters
+
+    //! returns the file the index was built from
+    const std::string &                   getSource    () const;
+    //! returns the settings of the \c Parrot::Reader that created the index
+    const std::string &                   getSignature () const;
+    //! returns the number of distinct keywords
+    size_t                                size         () const;
+    //! returns whether \c keyword occurs in the file
+    bool                                  hasKeyword   (const std::string & keyword) const;
+    //! returns the entry of \c keyword or \c nullptr if it does not occur in the file
+    const Entry *                         find         (const std::string & keyword) const;
+    //! returns all keywords found in the file
+    std::vector<std::string>              getKeywords  () const;
+    //! returns all entries
+    const std::map<std::string, Entry> &  getEntries   () const;
+
+    /**
+     * @brief returns true if \c source still has the size and modification
+     *    time it had when the index was built, and \c signature matches.
+     */
+    bool isCurrent(const std::string & source, const std::string & signature) const;
+
+    // ---------------------------------------------------------------------- //
+    // Setters
+
+    //! removes all entries and the file information
+    void reset();
+
+    /**
+     * @brief sets the file the index pertains to and records its current
+     *    size and modification time.
+     *
+     * @throws std::runtime_error if the file does not exist
+     */
+    void setSource    (const std::string & source, const std::string & signature);
+    //! appends an occurrence of \c keyword
+    void add          (const std::string & keyword, const std::string & section, const Span & span);
+
+    // ---------------------------------------------------------------------- //
+    // I/O
+
+    /**
+     * @brief writes the index to \c filename
+     *
+     * @throws std::runtime_error if the file cannot be written
+     */
+    void save(const std::string & filename) const;
+  };
+}
+
+// ========================================================================== //
+
+#endif
@@ -0,0 +1,86 @@
+/* Interned keyword names shared by a Parrot::Reader and its results.
+ *
+ */
+
+#ifndef PARROT_KEYWORDTABLE_HPP
+#define PARROT_KEYWORDTABLE_HPP
+
+// ========================================================================== //
+// dependencies
+
+// STL
+#include <string>
+#include <string_view>
+#include <deque>
+#include <unordered_map>
+
+// ========================================================================== //
+
+namespace Parrot {
+
+  // ======================================================================== //
+  // class
+
+  /**
+   * @brief stores each keyword name once and assigns it a dense integer ID.
+   *
+   * A \c Parrot::Reader interns the qualified key of every registered
+   *    \c Parrot::Descriptor, so the ID of a keyword equals the index of its
+   *    descriptor. The <tt>Parrot::FileContent</tt>s created by the reader
+   *    share the table and store their values in slots indexed by ID instead
+   *    of keeping a copy of each keyword name.
+   *
+   * IDs are never reused or invalidated; names are only stored, not
+   *    normalized, i.e. the caller is responsible for case folding.
+   */
+  class KeywordTable {
+  public:
+    //! the type of the keyword IDs
+    using ID = size_t;
+    //! returned by \c find() for unknown keywords
+    static constexpr ID npos = static_cast<ID>(-1);
+
+  private:
+    std::deque<std::string>                   names;                            // deque: the views in ids stay valid
+    std::unordered_map<std::string_view, ID>  ids;
+
+  public:
+    // ---------------------------------------------------------------------- //
+    // CTors
+
+    KeywordTable() = default;
+    KeywordTable(const KeywordTable & other);
+    KeywordTable(KeywordTable &&) = default;
+
+    KeywordTable & operator= (const KeywordTable & other);
+    KeywordTable & operator= (KeywordTable &&) = default;
+
+    // ---------------------------------------------------------------------- //
+    // Getters
+
+    //! returns the number of interned keywords
+    size_t              size    () const;
+    //! returns whether \c keyword has been interned
+    bool                contains(std::string_view keyword) const;
+    //! returns the ID of \c keyword or \c npos if it has not been interned
+    ID                  find    (std::string_view keyword) const;
+    /**
+     * @brief returns the name associated with \c id
+     *
+     * @throws std::out_of_range if \c id was not assigned by this table
+     */
+    const std::string & name    (ID id) const;
+
+    // ---------------------------------------------------------------------- //
+    // Setters
+
+    //! returns the ID of \c keyword, adding it to the table if necessary
+    ID                  intern  (const std::string & keyword);
+    //! removes all keywords
+    void                clear   ();
+  };
+}
+
+// ========================================================================== //
+
+#endif
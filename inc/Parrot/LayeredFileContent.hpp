@@ -0,0 +1,172 @@
+/* Several FileContents stacked on top of each other, e.g. defaults, site and
+ * job settings and command line overrides.
+ *
+ */
+
+#ifndef PARROT_LAYEREDFILECONTENT_HPP
+#define PARROT_LAYEREDFILECONTENT_HPP
+
+// ========================================================================== //
+// dependencies
+
+// STL
+#include <string>
+#include <any>
+#include <vector>
+#include <memory>
+#include <unordered_map>
+
+// own
+#include "Parrot/Definitions.hpp"
+#include "Parrot/FileContent.hpp"
+
+// ========================================================================== //
+
+namespace Parrot {
+
+  // ======================================================================== //
+  // class
+
+  /**
+   * @brief a read-only view of several \c Parrot::FileContent objects, where
+   *    each keyword takes its value from the topmost layer that holds it.
+   *
+   * Typical layers are a system default file, a site file, a job file and a
+   *    \c Parrot::FileContent filled with command line overrides via
+   *    \c Parrot::FileContent::setElement(). Keywords are spelled as in the
+   *    layers, i.e. in upper case unless the \c Parrot::Reader treats
+   *    keywords case sensitively.
+   *
+   * Since the \c Parrot::Reader fills in defaults for keywords missing in a
+   *    file, an entry that was not found in its file only counts if no layer
+   *    holds the keyword with the found in file flag set (see
+   *    \c Parrot::FileContent::getFoundInFile()). Overrides should hence be
+   *    set with that flag, e.g. <tt>setElement("EPSILON", 1E-8, true)</tt>.
+   *
+   * The layers are not copied: they are moved into the view or shared with
+   *    the caller, and must not be modified afterwards. Adding a layer
+   *    updates an index that points each keyword directly to the entry it
+   *    is taken from, so a lookup costs one hash map access, no matter
+   *    how many layers there are, and returns a reference into the layer.
+   *    Use \c flatten() to obtain an independent \c Parrot::FileContent.
+   *
+   * \c getProvenance() tells which layer and line a value came from.
+   */
+  class LayeredFileContent {
+  public:
+    //! the origin of the value of a keyword
+    struct Provenance {
+      size_t      layer = 0;                                                    // index into getLayers(), 0 is the bottom layer
+      std::string source;                                                       // getSource() of that layer
+      int         line  = -1;                                                   // see FileContent::getLine()
+    };
+
+  private:
+    struct Location {
+      size_t                          layer;
+      const FileContent::ContentType * data;                                    // points into layers[layer]
+    };
+
+    std::vector<std::shared_ptr<const FileContent>>  layers;                    // bottom first
+    std::unordered_map<std::string, Location>        index;                     // keyword -> topmost layer holding it, found in file if possible
+
+    const Location & locate (const std::string & key) const;                    // throws ValueAccessError
+
+  public:
+    // ---------------------------------------------------------------------- //
+    // CTors
+
+    LayeredFileContent() = default;
+    //! stacks \c layers, the first one at the bottom
+    LayeredFileContent(std::vector<FileContent> && layers);
+
+    // ---------------------------------------------------------------------- //
+    // Getters
+
+    //! returns the number of layers
+    size_t                                        getLayerCount () const;
+    //! returns all layers, the bottom one first
+    const std::vector<std::shared_ptr<const FileContent>> & getLayers () const;
+    /**
+     * @brief returns the layer with index \c idx, counted from the bottom
+     *
+     * @throws Parrot::ValueAccessError if there is no such layer
+     */
+    const FileContent &                           getLayer      (size_t idx) const;
+
+    //! returns \c true if no layer holds any keyword
+    bool                                          empty         () const;
+    //! returns the number of distinct keywords in all layers
+    size_t                                        size          () const;
+    //! returns \c true if any layer holds \c key
+    bool                                          hasKeyword    (const std::string & key) const;
+    //! returns the names of all keywords in all layers, sorted
+    std::vector<std::string>                      getKeywords   () const;
+
+    /**
+     * @brief returns the entire content associated with a keyword in the
+     *    layer it is taken from, as in \c Parrot::FileContent::get()
+     *
+     * @throws Parrot::ValueAccessError if no layer holds \c key
+     */
+    const FileContent::ContentType &              get           (const std::string & key) const;
+    //! @overload returns only the value; same as <tt>std::get<Value>(get(key))</tt>
+    const std::any &                              getAny        (const std::string & key) const;
+    //! returns the \c Parrot::ValueTypeID of \c key in the layer it is taken from
+    ValueTypeID                                   getValueType  (const std::string & key) const;
+    /**
+     * @brief returns the layer and line from which the value of \c key was
+     *    taken. For keywords of an included file, \c line refers to that
+     *    file (see \c Parrot::Reader::setIncludeKeyword()).
+     *
+     * @throws Parrot::ValueAccessError if no layer holds \c key
+     */
+    Provenance                                    getProvenance (const std::string & key) const;
+
+    // ---------------------------------------------------------------------- //
+    // Value Access
+
+    //! the result is implicitly cast to the target type; see \c Parrot::FileContent::operator[]()
+    FileContent::TypeConverterClass               operator[]    (const std::string & key) const;
+
+    /**
+     * @brief returns a reference to the value of \c key, which must be of
+     *    type \c T
+     *
+     * @throws Parrot::ValueAccessError if no layer holds \c key
+     * @throws std::bad_any_cast if T does not match the content
+     */
+    template <typename T>
+    const T & getValue (const std::string & key) const;
+
+    // ---------------------------------------------------------------------- //
+    // Setters
+
+    //! puts \c layer on top of all other layers
+    void addLayer (FileContent && layer);
+    //! @overload shares \c layer with the caller, who must not modify it any more
+    void addLayer (std::shared_ptr<const FileContent> layer);
+
+    /**
+     * @brief copies the value of each keyword from the layer it is taken from
+     *    into a new \c Parrot::FileContent, lines included
+     *
+     * If all layers use the same \c Parrot::KeywordTable, so does the result.
+     */
+    FileContent flatten (const std::string & source = "<layered>") const;
+  };
+}
+
+// ========================================================================== //
+// template implementations
+
+template <typename T>
+const T & Parrot::LayeredFileContent::getValue (const std::string & key) const {
+  auto value = std::any_cast<T>( &getAny(key) );
+  if (!value) {throw std::bad_any_cast();}
+  return *value;
+}
+
+// ========================================================================== //
+
+#endif
@@ -0,0 +1,113 @@
+/* A FileContent whose keywords are parsed only when they are first accessed.
+ *
+ */
+
+#ifndef PARROT_LAZYFILECONTENT_HPP
+#define PARROT_LAZYFILECONTENT_HPP
+
+// ========================================================================== //
+// dependencies
+
+// STL
+#include <string>
+#include <vector>
+#include <set>
+#include <fstream>
+
+// own
+#include "Parrot/Definitions.hpp"
+#include "Parrot/FileContent.hpp"
+#include "Parrot/KeywordIndex.hpp"
+#include "Parrot/Reader.hpp"
+
+// ========================================================================== //
+
+namespace Parrot {
+
+  // ======================================================================== //
+  // class
+
+  /**
+   * @brief gives access to the content of a file, parsing each keyword only
+   *    when it is first requested.
+   *
+   * Created by <tt>Parrot::Reader::parseLazy()</tt>. The object keeps a copy
+   *    of the \c Parrot::Reader and an open handle to the file. On first
+   *    access to a keyword, its line(s) are read using the
+   *    \c Parrot::KeywordIndex and run through the same parsing steps as in
+   *    the call operator of the \c Parrot::Reader, including all policies and
+   *    restrictions. Keywords that are never accessed are never converted.
+   *
+   * Warnings and errors concerning a keyword hence occur on its first access,
+   *    not on creation of the object. Lines without an assignment are not
+   *    reported in lazy mode.
+   *
+   * Access is not thread safe.
+   */
+  class LazyFileContent {
+  private:
+    Reader                        reader;
+    KeywordIndex                  index;
+    mutable std::ifstream         hFile;
+    mutable FileContent           content;
+    mutable std::set<std::string> resolved;                                     // keywords that have been looked up
+
+    std::string normalize (const std::string & key) const;
+    void        resolve   (const std::string & key) const;
+
+  public:
+    // ---------------------------------------------------------------------- //
+    // CTors
+
+    /**
+     * @throws std::runtime_error if the file of \c index cannot be opened
+     */
+    LazyFileContent(const Reader & reader, const KeywordIndex & index);
+
+    // ---------------------------------------------------------------------- //
+    // Getters
+
+    //! returns the name of the parsed file
+    const std::string &           getSource         () const;
+    //! returns the index used to locate the keywords
+    const KeywordIndex &          getIndex          () const;
+    //! returns whether \c key occurs in the file or is expected by the \c Parrot::Reader
+    bool                          hasKeyword        (const std::string & key) const;
+    //! returns whether \c key has been parsed already
+    bool                          isParsed          (const std::string & key) const;
+    //! returns all keywords in the file and all keywords expected by the \c Parrot::Reader
+    std::vector<std::string>      getKeywords       () const;
+
+    /**
+     * @brief parses \c key if necessary and returns its tuple as in
+     *    \c Parrot::FileContent::get()
+     *
+     * @throws Parrot::ValueAccessError if \c key does not exist, as well as
+     *    any error the call operator of the \c Parrot::Reader may throw
+     */
+    FileContent::ContentType      get               (const std::string & key) const;
+    //! @overload returns only the value; same as <tt>std::get<Value>(get(key))</tt>
+    std::any                      getAny            (const std::string & key) const;
+    //! parses \c key if necessary and returns its \c Parrot::ValueTypeID
+    ValueTypeID                   getValueType      (const std::string & key) const;
+
+    /**
+     * @brief returns all keywords parsed so far
+     */
+    const FileContent &           getParsed         () const;
+    /**
+     * @brief parses all remaining keywords and returns the complete content
+     */
+    const FileContent &           materialize       () const;
+
+    // ---------------------------------------------------------------------- //
+    // Value Access
+
+    //! parses \c key if necessary; the result is implicitly cast to the target type
+    FileContent::TypeConverterClass operator[]      (const std::string & key) const;
+  };
+}
+
+// ========================================================================== //
+
+#endif
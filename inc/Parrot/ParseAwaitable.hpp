@@ -0,0 +1,80 @@
+/* The result of an asynchronous parsing process, awaitable in a coroutine.
+ *
+ */
+
+#ifndef PARROT_PARSEAWAITABLE_HPP
+#define PARROT_PARSEAWAITABLE_HPP
+
+// ========================================================================== //
+// dependencies
+
+// STL
+#include <string>
+#include <exception>
+#include <coroutine>
+
+// own
+#include "Parrot/Definitions.hpp"
+#include "Parrot/FileContent.hpp"
+#include "Parrot/Executor.hpp"
+
+// ========================================================================== //
+
+namespace Parrot {
+  class Reader;
+
+  // ======================================================================== //
+  // class
+
+  /**
+   * @brief lets a C++20 coroutine wait for a parsing process without
+   *    blocking a thread.
+   *
+   * Created by <tt>Parrot::Reader::parseAwaitable()</tt>. Nothing happens
+   *    before the object is awaited; \c co_await submits the parsing process
+   *    to the executor of the \c Parrot::Reader and suspends the coroutine.
+   *    The coroutine is resumed on the thread that finished the parse and
+   *    receives the \c Parrot::FileContent, or the exception the parse
+   *    ended with.
+   *
+   * Example:
+   * @code
+   * Task run(const Parrot::Reader & reader) {
+   *   auto content = co_await reader.parseAwaitable("run.ini");
+   *   ...
+   * }
+   * @endcode
+   *
+   * The \c Parrot::Reader must outlive the parsing process.
+   */
+  class ParseAwaitable {
+  private:
+    const Reader *      reader;
+    std::string         source;
+    CancellationToken   token;
+    FileContent         result;
+    std::exception_ptr  error;
+
+    ParseAwaitable(const Reader * reader, const std::string & source, const CancellationToken & token);
+
+    friend class Reader;
+
+  public:
+    //! always \c false: the file is never parsed in the awaiting thread
+    bool        await_ready   () const noexcept;
+    //! submits the parsing process, which resumes \c handle when done
+    void        await_suspend (std::coroutine_handle<> handle);
+    /**
+     * @brief returns the parsed content
+     *
+     * @throws Parrot::ParseCancelledError if the process was cancelled
+     *    before it started
+     * @throws anything thrown by the \c Parrot::Reader while parsing
+     */
+    FileContent await_resume  ();
+  };
+}
+
+// ========================================================================== //
+
+#endif
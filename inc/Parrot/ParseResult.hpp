@@ -0,0 +1,104 @@
+/* Result of a non-throwing parsing process: the parsed content together with
+ * all errors that would have aborted a regular parse.
+ *
+ */
+
+#ifndef PARROT_PARSERESULT_HPP
+#define PARROT_PARSERESULT_HPP
+
+// ========================================================================== //
+// dependencies
+
+// STL
+#include <string>
+#include <vector>
+
+// own
+#include "Parrot/Definitions.hpp"
+#include "Parrot/Diagnostics.hpp"
+#include "Parrot/FileContent.hpp"
+
+// ========================================================================== //
+
+namespace Parrot {
+
+  // ======================================================================== //
+  // types
+
+  /**
+   * @brief an error recorded by <tt>Parrot::Reader::tryParse()</tt> in place
+   *    of throwing an exception.
+   *
+   * The error stores the message template of the \c Parrot::Reader or the
+   *    \c Parrot::Restriction together with the parser state at the time the
+   *    error occurred. The text is only assembled when \c message() is called.
+   */
+  struct ParseError {
+    DiagnosticKind  kind            = DiagnosticKind::Summary;
+    std::string     file;                                                       // $F
+    int             line            = -1;                                       // $#
+    std::string     keyword;                                                    // $K
+    std::string     messageTemplate;
+    std::string     lineText;                                                   // $L
+    std::string     defaultValue;                                               // $D
+    std::string     readValue;                                                  // $V
+    std::string     typeName;                                                   // $T
+
+    //! returns \c messageTemplate with all $X placeholders substituted
+    std::string message() const;
+  };
+
+  // ======================================================================== //
+  // class
+
+  /**
+   * @brief the outcome of <tt>Parrot::Reader::tryParse()</tt>.
+   *
+   * Resembles \c std::expected: \c ok() indicates whether the file was parsed
+   *    without any error, \c value() gives access to the content of a
+   *    successful parse and \c getErrors() lists everything that went wrong.
+   *
+   * Unlike \c std::expected, the content is retained even if errors occurred.
+   *    Each error was handled as if the policy had been
+   *    \c ParsingErrorPolicy::Silent or
+   *    \c RestrictionViolationPolicy::WarningRevert, respectively, and can be
+   *    inspected with \c getContent().
+   */
+  class ParseResult {
+  private:
+    FileContent             content;
+    std::vector<ParseError> errors;
+
+  public:
+    // ---------------------------------------------------------------------- //
+    // CTors
+
+    ParseResult() = default;
+    ParseResult(FileContent && content, std::vector<ParseError> && errors);
+
+    // ---------------------------------------------------------------------- //
+    // Getters
+
+    //! returns true if no error occurred
+    bool                            ok          () const;
+    //! returns true if no error occurred
+    explicit                        operator bool () const;
+
+    /**
+     * @brief returns the parsed content of an error-free parse
+     *
+     * @throws Parrot::ValueAccessError if any error occurred
+     */
+    const FileContent &             value       () const;
+    //! returns the parsed content, regardless of errors
+    const FileContent &             getContent  () const;
+    //! returns all errors in the order of their occurrence
+    const std::vector<ParseError> & getErrors   () const;
+    //! returns the messages of all errors, in the order of their occurrence
+    std::vector<std::string>        getMessages () const;
+  };
+}
+
+// ========================================================================== //
+
+#endif
@@ -0,0 +1,163 @@
+/* Timing information collected while a Parrot::Reader parses a file.
+ *
+ */
+
+#ifndef PARROT_PARSESTATS_HPP
+#define PARROT_PARSESTATS_HPP
+
+// ========================================================================== //
+// dependencies
+
+// STL
+#include <string>
+#include <array>
+#include <map>
+
+#include <chrono>
+
+// ========================================================================== //
+
+namespace Parrot {
+
+  // ======================================================================== //
+  // types
+
+  /**
+   * @brief names the partial parsers a \c Parrot::Reader runs for each line
+   *    of a file, in the order in which they are applied.
+   *
+   * To get a human-readable representation of a \c Parrot::ParseStage, use
+   *  \c Parrot::parseStageName()
+   */
+  enum class ParseStage {
+    SplitLine,
+    IdentifyKeyword,
+    DuplicateCheck,
+    Preparse,
+    ApplyPreParseRestrictions,
+    ConvertToTargetType,
+    ApplyAftParseRestrictions
+  };
+
+  //! @brief number of enumerators in \c Parrot::ParseStage
+  constexpr size_t ParseStageCount = 7;
+
+  /**
+   * @brief returns a human readable string to a \c Parrot::ParseStage()
+   *
+   * Implements a simple lookup; the names match the partial parser functions.
+   */
+  const std::string parseStageName(const ParseStage & T);
+
+  // ======================================================================== //
+  // class
+
+  /**
+   * @brief collects the time spent in the individual steps of a parsing
+   *    process.
+   *
+   * A \c Parrot::ParseStats object is filled by passing it to
+   *    <tt>Parrot::Reader::operator()(const std::string &, ParseStats &) const</tt>.
+   *    Timing is opt-in: if the plain call operator is used, no clock is read.
+   *
+   * Values accumulate over several parses until \c reset() is called. This
+   *    allows to profile a whole batch of files with one object.
+   *
+   * Example:
+   * @code
+   * Parrot::ParseStats stats;
+   * auto fc = reader("settings.ini", stats);
+   * std::cout << stats.to_string() << std::endl;
+   * @endcode
+   */
+  class ParseStats {
+  public:
+    //! the clock used for all measurements
+    using Clock    = std::chrono::steady_clock;
+    //! the unit in which all times are recorded
+    using Duration = std::chrono::nanoseconds;
+
+    //! cumulative time and number of calls of one partial parser
+    struct StageRecord {
+      Duration time  = Duration::zero();
+      size_t   calls = 0;
+    };
+
+    //! time spent in user supplied functions for one keyword
+    struct KeywordRecord {
+      Duration userPreParserTime    = Duration::zero();
+      size_t   userPreParserCalls   = 0;
+      Duration userRestrictionTime  = Duration::zero();
+      size_t   userRestrictionCalls = 0;
+    };
+
+  private:
+    std::array<StageRecord, ParseStageCount> stages;
+    std::map<std::string, KeywordRecord>      keywords;
+
+    Duration  ioTime    = Duration::zero();                                     // opening the file and reading lines
+    Duration  totalTime = Duration::zero();                                     // entire call operator
+    size_t    files     = 0;
+    size_t    lines     = 0;
+
+  public:
+    // ---------------------------------------------------------------------- //
+    // CTors
+
+    ParseStats() = default;
+
+    // ---------------------------------------------------------------------- //
+    // Getters
+
+    //! returns the record for one partial parser
+    const StageRecord &                           getStage      (const ParseStage & stage) const;
+    //! returns the records of user preparsers and user restrictions, keyed by keyword
+    const std::map<std::string, KeywordRecord> &  getKeywords   () const;
+    //! returns the time spent opening the file and reading from it
+    Duration                                      getIOTime     () const;
+    //! returns the time spent in the call operator of the \c Parrot::Reader
+    Duration                                      getTotalTime  () const;
+    //! returns the sum of the times of all partial parsers
+    Duration                                      getParserTime () const;
+    //! returns the sum of the times of all user preparsers and user restrictions
+    Duration                                      getUserTime   () const;
+    //! returns the number of files parsed
+    size_t                                        getFileCount  () const;
+    //! returns the number of physical lines read
+    size_t                                        getLineCount  () const;
+
+    // ---------------------------------------------------------------------- //
+    // Setters
+
+    //! restores the state as if created by the empty CTor
+    void reset();
+
+    //! adds one call of the partial parser \c stage that took \c time
+    void addStageTime           (const ParseStage & stage, Duration time);
+    //! adds one call of the user preparser of \c keyword that took \c time
+    void addUserPreParserTime   (const std::string & keyword, Duration time);
+    //! adds one call of a user restriction function of \c keyword that took \c time
+    void addUserRestrictionTime (const std::string & keyword, Duration time);
+    //! adds time spent opening or reading the file
+    void addIOTime              (Duration time);
+    //! adds the time of one completed call to the \c Parrot::Reader
+    void addFile                (Duration time, size_t lines);
+    //! adds all times and counts of \c other, e.g. collected on another thread
+    void merge                  (const ParseStats & other);
+
+    // ---------------------------------------------------------------------- //
+    // Representation
+
+    /**
+     * @brief creates a string with a tabular representation of the collected
+     *    times.
+     *
+     * All times are given in microseconds.
+     */
+    std::string to_string() const;
+  };
+}
+
+// ========================================================================== //
+
+#endif
@@ -0,0 +1,153 @@
+/* An evenly spaced sequence of reals, stored as start, stop and count.
+ *
+ */
+
+#ifndef PARROT_RANGE_HPP
+#define PARROT_RANGE_HPP
+
+// ========================================================================== //
+// dependencies
+
+// STL
+#include <cstddef>
+#include <iterator>
+#include <string>
+#include <vector>
+
+// ========================================================================== //
+
+namespace Parrot {
+
+  // ======================================================================== //
+  // class
+
+  /**
+   * @brief \c count evenly spaced reals from \c start to \c stop, both
+   *    included.
+   *
+   * The elements are computed on access, so a range of any length occupies
+   *    the same few bytes. In a .ini file, a range is written as
+   *    <tt>start:stop:count</tt>, e.g. <tt>0:1:11</tt> for
+   *    <tt>0, 0.1, ..., 1</tt>.
+   *
+   * \c min() and \c max() are computed from the end points, so range
+   *    restrictions on a \c Parrot::RealRange are checked in constant time.
+   */
+  class RealRange {
+  private:
+    double  start = 0;
+    double  stop  = 0;
+    size_t  count = 0;
+
+  public:
+    // ---------------------------------------------------------------------- //
+    // Iterator
+
+    //! random access iterator over the elements of a \c Parrot::RealRange
+    class const_iterator {
+    private:
+      const RealRange * range = nullptr;
+      size_t            index = 0;
+
+    public:
+      using iterator_category = std::random_access_iterator_tag;
+      using value_type        = double;
+      using difference_type   = std::ptrdiff_t;
+      using pointer           = void;
+      using reference         = double;
+
+      const_iterator() = default;
+      const_iterator(const RealRange * range, size_t index) : range(range), index(index) {}
+
+      double            operator*  ()                   const {return (*range)[index];}
+      double            operator[] (difference_type n)  const {return (*range)[index + n];}
+
+      const_iterator &  operator++ ()                         {++index; return *this;}
+      const_iterator &  operator-- ()                         {--index; return *this;}
+      const_iterator    operator++ (int)                      {auto reVal = *this; ++index; return reVal;}
+      const_iterator    operator-- (int)                      {auto reVal = *this; --index; return reVal;}
+      const_iterator &  operator+= (difference_type n)        {index += n; return *this;}
+      const_iterator &  operator-= (difference_type n)        {index -= n; return *this;}
+      const_iterator    operator+  (difference_type n)  const {return const_iterator(range, index + n);}
+      const_iterator    operator-  (difference_type n)  const {return const_iterator(range, index - n);}
+      difference_type   operator-  (const const_iterator & other) const {return difference_type(index) - difference_type(other.index);}
+
+      bool operator== (const const_iterator & other) const {return index == other.index;}
+      bool operator!= (const const_iterator & other) const {return index != other.index;}
+      bool operator<  (const const_iterator & other) const {return index <  other.index;}
+      bool operator>  (const const_iterator & other) const {return index >  other.index;}
+      bool operator<= (const const_iterator & other) const {return index <= other.index;}
+      bool operator>= (const const_iterator & other) const {return index >= other.index;}
+
+      friend const_iterator operator+ (difference_type n, const const_iterator & it) {return it + n;}
+    };
+
+    // ---------------------------------------------------------------------- //
+    // CTors
+
+    //! an empty range
+    RealRange() = default;
+    //! \c count evenly spaced values from \c start to \c stop; a single value is \c start
+    RealRange(double start, double stop, size_t count);
+
+    /**
+     * @brief the values <tt>start, start + step, ...</tt> up to and including
+     *    \c stop, if \c stop is hit within rounding.
+     *
+     * @throws std::invalid_argument if \c step is zero or points away from
+     *    \c stop
+     */
+    static RealRange fromStep(double start, double stop, double step);
+
+    // ---------------------------------------------------------------------- //
+    // Getters
+
+    //! returns the first value
+    double          getStart() const;
+    //! returns the last value
+    double          getStop () const;
+    //! returns the distance between neighbouring values; zero for less than two values
+    double          getStep () const;
+
+    //! returns the number of values
+    size_t          size    () const;
+    //! returns whether the range has no values
+    bool            empty   () const;
+
+    /**
+     * @brief returns the smallest value in constant time
+     *
+     * @throws std::out_of_range if the range is empty
+     */
+    double          min     () const;
+    //! @overload returns the largest value; see \c min()
+    double          max     () const;
+
+    // ---------------------------------------------------------------------- //
+    // Element Access
+
+    //! returns the value at \c index without bounds check; the last value is exactly \c getStop()
+    double          operator[] (size_t index) const;
+    //! @overload \c operator[] with bounds check; throws \c std::out_of_range
+    double          at         (size_t index) const;
+
+    const_iterator  begin      () const;
+    const_iterator  end        () const;
+
+    //! returns all values as a list
+    std::vector<double> materialize() const;
+
+    // ---------------------------------------------------------------------- //
+    // Representation
+
+    //! returns the range in the form <tt>start:stop:count</tt>
+    std::string     to_string  () const;
+
+    bool            operator== (const RealRange & other) const;
+    bool            operator!= (const RealRange & other) const;
+  };
+}
+
+// ========================================================================== //
+
+#endif
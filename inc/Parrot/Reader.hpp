@@ -12,16 +12,38 @@
 #include <string>
 #include <vector>
 #include <tuple>
+#include <map>
+#include <memory>
+#include <memory_resource>
+#include <ios>
+#include <functional>
+#include <future>
 
 // own
 #include "Parrot/Definitions.hpp"
 #include "Parrot/Descriptor.hpp"
 #include "Parrot/FileContent.hpp"
+#include "Parrot/ParseStats.hpp"
+#include "Parrot/Diagnostics.hpp"
+#include "Parrot/ParseResult.hpp"
+#include "Parrot/KeywordIndex.hpp"
+#include "Parrot/KeywordTable.hpp"
+#include "Parrot/KeyHandle.hpp"
+#include "Parrot/BooleanVocabulary.hpp"
+#include "Parrot/Expression.hpp"
+#include "Parrot/FunctionRegistry.hpp"
+#include "Parrot/Executor.hpp"
+#include "Parrot/FileLoader.hpp"
+#include "Parrot/DirectoryParseResult.hpp"
+#include "Parrot/FragmentCache.hpp"
 
 // ========================================================================== //
 
 namespace Parrot {
 
+  class LazyFileContent;
+  class ParseAwaitable;
+
   // ======================================================================== //
   // class
 
@@ -39,6 +61,15 @@ namespace Parrot {
    *    accessible or the violation of a \c Parrot::Restriction causes an error
    *    to be thrown.
    *
+   * Lines of the form <tt>[name]</tt> start a section. Keywords within a
+   *    section are matched against descriptors with the same section (see
+   *    \c Parrot::Descriptor::setSection()) and appear as <tt>name.key</tt>
+   *    in the \c Parrot::FileContent. Selected sections can be parsed without
+   *    touching the rest of the file; see \c indexSections().
+   *
+   * Optionally, a line like <tt>include = base.ini</tt> splices another file
+   *    into the parse; see \c setIncludeKeyword().
+   *
    */
   class Reader {
   public:
@@ -48,6 +79,42 @@ namespace Parrot {
      */
     using MinimalDescriptor = std::tuple<std::string, Parrot::ValueTypeID, bool>;
 
+    /**
+     * @brief the location of one contiguous block of a section within a file.
+     *
+     * \c offset points to the section header (or to the begin of the file
+     *    for the global section), \c firstLine is the number of lines before
+     *    that position and \c lineCount the number of lines up to the next
+     *    section header.
+     */
+    struct SectionSpan {
+      std::streamoff  offset    = 0;
+      int             firstLine = 0;
+      size_t          lineCount = 0;
+    };
+
+    /**
+     * @brief maps section names to their locations within a file; the global
+     *    section is denoted by the empty string. A section may occur in
+     *    several places.
+     */
+    using SectionIndex = std::map<std::string, std::vector<SectionSpan>>;
+
+    /**
+     * @brief a rule relating the values of several keywords, e.g.
+     *    <tt>N_photons >= N_modes</tt>.
+     *
+     * \c check receives the complete \c Parrot::FileContent and returns
+     *    whether the values of \c keywords are consistent. See
+     *    \c addConstraint().
+     */
+    struct Constraint {
+      std::vector<std::string>                        keywords;
+      std::function<bool (const FileContent &)>       check;
+      RestrictionViolationPolicy                      policy = RestrictionViolationPolicy::Exception;
+      std::string                                     text;
+    };
+
   private:
     // ...................................................................... //
     // state variables. See function reset() for defaults.
@@ -57,6 +124,18 @@ namespace Parrot {
     char                            assignmentMarker                  ;
     bool                            keywordCaseSensitive              ;
     bool                            verbose                           ;
+    size_t                          threads                           ;
+    bool                            alignNumericLists                 ;
+    bool                            evaluateExpressions               ;
+    bool                            deferValidation                   ;
+    std::shared_ptr<DiagnosticSink> diagnosticSink                    ;
+    std::shared_ptr<Executor>       executor                          ;
+    std::shared_ptr<Executor>       ioExecutor                        ;
+    std::shared_ptr<FileLoader>     fileLoader                        ;
+    std::shared_ptr<const BooleanVocabulary> booleanVocabulary        ;
+    std::shared_ptr<ExpressionCache>         expressions              ;
+    std::string                              includeKeyword           ;
+    std::shared_ptr<FragmentCache>           fragments                ;   // replaced on every change that affects parsing
 
     ParsingErrorPolicy              missingKeywordPolicyNonMandatory  ;
     std::string                     missingKeywordTextNonMandatory    ;
@@ -70,6 +149,8 @@ namespace Parrot {
     std::string                     conversionErrorText               ;
 
     std::vector<Parrot::Descriptor> descriptors;
+    std::shared_ptr<KeywordTable>   keywordTable;                               // ID of a keyword == index of its descriptor; copied on write
+    std::vector<Constraint>         constraints;
 
     // ...................................................................... //
     // parsing metastate variables
@@ -87,13 +168,42 @@ namespace Parrot {
     // ...................................................................... //
     // parsing machinery
 
-    void        descriptorValidityCheck(const Parrot::Descriptor & descriptor) const;
+    void                descriptorValidityCheck(const Parrot::Descriptor & descriptor) const;
+    void                appendDescriptor       (const Parrot::Descriptor & descriptor);      // registers without checks; keywordTable must not be shared
+    void                resetFragments         ();                              // starts a new fragment cache; copies keep the old one
+    KeywordTable::ID    handleID               (std::string keyword, ValueTypeID valueType) const;   // checks keyword and type for handle()
+
+    struct ParseJob {                                                           // options of one call to parse()
+      ParseStats *                      stats    = nullptr;
+      std::vector<ParseError> *         errors   = nullptr;                     // collect errors instead of throwing if set
+      const std::vector<std::string> *  sections = nullptr;                     // parse only these if set ...
+      const SectionIndex *              index    = nullptr;                     // ... located by this index
+      std::pmr::memory_resource *       resource = nullptr;                     // allocates the result if set
+      std::string *                     text     = nullptr;                     // parsed instead of reading source if set; moved from
+      DiagnosticSink *                  sink     = nullptr;                     // receives the messages instead of diagnosticSink if set
+    };
+
+    Parrot::FileContent parse                  (const std::string & source, const ParseJob & job) const;
+
+    using ParseCompletion = std::function<void (FileContent * content, std::exception_ptr error)>;  // exactly one of both is set
+    void                submitParse            (const std::string & source, const CancellationToken & token, ParseCompletion done) const;
+    void                runParse               (const std::string & source, std::shared_ptr<std::string> text,  // reads source if text is nullptr
+                                                const CancellationToken & token, const ParseCompletion & done) const;
+
+    std::string         indexSignature         () const;                        // settings that affect the keyword names found by indexKeywords
+    void                parseIndexed           (std::istream &               hFile,
+                                                const std::string &          keyword,
+                                                const KeywordIndex::Entry *  entry,
+                                                FileContent &                target) const;
+
+    friend class LazyFileContent;
+    friend class ParseAwaitable;
 
   public:
     // ---------------------------------------------------------------------- //
     // CTors
 
-    Reader() = default;
+    Reader();
     /**
      * @brief copies all <tt>Parrot::Descriptor</tt>s from \c descriptor into
      *    the parsing ruleset for later application.
@@ -113,6 +223,32 @@ namespace Parrot {
     bool                                    getKeywordCaseSensitive () const;
     //! returns whether or not the parsing progress should be printed to stdout
     bool                                    getVerbose              () const;
+    //! returns the number of threads used to parse one file
+    size_t                                  getThreads              () const;
+    //! returns whether integer and real lists are stored in aligned buffers
+    bool                                    getAlignNumericLists    () const;
+    //! returns whether integer and real values may be written as arithmetic expressions
+    bool                                    getEvaluateExpressions  () const;
+    //! returns whether after-parse restrictions are applied in a separate pass over all keywords
+    bool                                    getDeferValidation      () const;
+    //! returns the sink receiving warnings and the verbose mode summary
+    const std::shared_ptr<DiagnosticSink> & getDiagnosticSink       () const;
+    //! returns the executor of asynchronous parsing processes; \c nullptr for \c Parrot::defaultExecutor()
+    const std::shared_ptr<Executor> &       getExecutor             () const;
+    //! returns the executor reading files for asynchronous parsing processes; \c nullptr if read by the parsing task
+    const std::shared_ptr<Executor> &       getIOExecutor           () const;
+    //! returns the loader reading the files of \c parseBatch(); \c nullptr for \c Parrot::defaultFileLoader()
+    const std::shared_ptr<FileLoader> &     getFileLoader           () const;
+    //! returns the words recognized as boolean values
+    const BooleanVocabulary &               getBooleanVocabulary    () const;
+    //! returns the cache of compiled expressions
+    const ExpressionCache &                 getExpressionCache      () const;
+    //! returns the directive that includes other files; empty if disabled
+    const std::string &                     getIncludeKeyword       () const;
+    //! returns the cache of parsed included files
+    const FragmentCache &                   getFragmentCache        () const;
+    //! returns the named constants available in expressions
+    const std::map<std::string, double> &   getConstants            () const;
 
     //! returns the event triggered if a mandatory keyword was not found in file
     const ParsingErrorPolicy &            getParsingErrorPolicyMandatory  () const;
@@ -144,6 +280,35 @@ namespace Parrot {
      *    if the keyword was not found
      */
     size_t                                  getKeywordIndex (const std::string & keyword) const;
+    /**
+     * @brief returns the interned qualified keys of all registered
+     *    descriptors; the ID of a keyword is the index of its descriptor.
+     *
+     * The table is shared with all <tt>Parrot::FileContent</tt>s created by
+     *    this reader. It is copied before new keywords are added, so results
+     *    already returned remain valid.
+     */
+    std::shared_ptr<const KeywordTable>     getKeywordTable () const;
+    /**
+     * @brief returns a handle to the value of \c keyword in the
+     *    <tt>Parrot::FileContent</tt>s created by this reader, for repeated
+     *    access without lookup via
+     *    <tt>Parrot::FileContent::get(const KeyHandle<T> &)</tt>
+     *
+     * \c keyword is given as in the file, with its section if any, i.e. as
+     *    <tt>section.key</tt>. \c T is the C++ type of its
+     *    \c Parrot::ValueTypeID, e.g. <tt>PARROT_TYPE(ValueTypeID::Real)</tt>.
+     *    Since numeric lists stored by \c setAlignNumericLists() are no
+     *    \c std::vector, no handle to them can be created while this is
+     *    enabled; use \c Parrot::FileContent::getSpan_RealList() and its
+     *    siblings instead.
+     *
+     * @throws Parrot::ValueAccessError if \c keyword is not registered
+     * @throws Parrot::ValueTypeError if \c T does not match the value type of
+     *    \c keyword, or if it is an aligned numeric list
+     */
+    template <typename T>
+    KeyHandle<T>                            handle          (const std::string & keyword) const;
 
 
     //! returns all currently registered keywords
@@ -169,6 +334,9 @@ namespace Parrot {
      */
     const             Parrot::Descriptor  & getDescriptor (const std::string & keyword) const;
 
+    //! returns all registered constraints between keywords
+    const std::vector<Constraint> &         getConstraints() const;
+
     // ---------------------------------------------------------------------- //
     // Setters
 
@@ -261,6 +429,164 @@ namespace Parrot {
     void setKeywordCaseSensitive            (bool                         newVal);
     //! activates or deactivates debug parsing output
     void setVerbose                         (bool                         newVal);
+    /**
+     * @brief sets the number of threads used to parse one file
+     *
+     * With more than one thread, the call operator reads the whole file into
+     *    memory and splits it into chunks of complete lines, respecting line
+     *    continuations and section headers. The chunks are parsed
+     *    concurrently and merged in file order, so the resulting
+     *    \c Parrot::FileContent, the order of diagnostics, the line numbers
+     *    in messages, the handling of duplicate keywords and the thrown
+     *    exceptions are the same as with a single thread.
+     *
+     * Files smaller than a few hundred kilobytes, as well as calls that parse
+     *    selected sections only, are always parsed on the calling thread.
+     *
+     * User preparsers and user restriction functions of the
+     *    <tt>Parrot::Descriptor</tt>s must be thread safe if more than one
+     *    thread is used. With \c setEvaluateExpressions(true), files are
+     *    parsed on the calling thread, too, since expressions may refer to
+     *    keywords from any earlier part of the file.
+     *
+     * @param newVal the number of threads; 0 selects the number of hardware
+     *    threads. Default is 1.
+     */
+    void setThreads                         (size_t                       newVal);
+    /**
+     * @brief sets the sink that receives all warnings and the verbose mode
+     *    summary of subsequent parsing processes.
+     *
+     * By default, a \c Parrot::StderrDiagnosticSink is used, which writes each
+     *    message immediately. Use a \c Parrot::BufferedDiagnosticSink or a
+     *    \c Parrot::AsyncDiagnosticSink to keep output off the parsing loop.
+     *    Passing \c nullptr restores the default.
+     */
+    void setDiagnosticSink                  (const std::shared_ptr<DiagnosticSink> & newVal);
+    /**
+     * @brief sets the executor that runs the parsing processes started by
+     *    \c parseAsync() and \c parseAwaitable().
+     *
+     * By default, or when passing \c nullptr, the thread pool returned by
+     *    \c Parrot::defaultExecutor() is used. Synchronous calls are not
+     *    affected.
+     */
+    void setExecutor                        (const std::shared_ptr<Executor> & newVal);
+    /**
+     * @brief sets a separate executor that reads the files of asynchronous
+     *    parsing processes.
+     *
+     * If set, each file is read in one go by a task on \c newVal, which then
+     *    submits the parsing of the text to the executor set with
+     *    \c setExecutor(). Reads of subsequent files thus overlap with
+     *    parsing the files already read, and slow storage does not occupy the
+     *    threads that parse. By default, or when passing \c nullptr, each
+     *    parsing task reads its own file.
+     */
+    void setIOExecutor                      (const std::shared_ptr<Executor> & newVal);
+    /**
+     * @brief sets the loader that reads the files of \c parseBatch().
+     *
+     * By default, or when passing \c nullptr, the loader returned by
+     *    \c Parrot::defaultFileLoader() is used, i.e. an \c io_uring where
+     *    the kernel supports it.
+     */
+    void setFileLoader                      (const std::shared_ptr<FileLoader> & newVal);
+    /**
+     * @brief sets the words recognized as boolean values for keywords of type
+     *    \c Boolean and \c BooleanList.
+     *
+     * The vocabulary is copied; \c reset() restores the words in
+     *    \c Parrot::defaultBooleanTextTrue and
+     *    \c Parrot::defaultBooleanTextFalse.
+     */
+    void setBooleanVocabulary               (const BooleanVocabulary & newVal);
+    /**
+     * @brief sets whether integer and real lists are stored in buffers
+     *    aligned to \c Parrot::numericListAlignment bytes.
+     *
+     * If set, the values of all integer, real and complex list keywords in
+     *    the resulting \c Parrot::FileContent hold a \c Parrot::AlignedVector
+     *    instead of a \c std::vector. Use
+     *    <tt>Parrot::FileContent::getSpan_IntegerList()</tt> and its
+     *    siblings to access them without copying; the \c get_ functions and the \c operator[] still
+     *    return a \c std::vector. Restrictions and validation functions are
+     *    unaffected. Off by default.
+     */
+    void setAlignNumericLists               (bool newVal);
+    /**
+     * @brief sets whether integer and real values, including the elements of
+     *    lists and ranges, may be written as arithmetic expressions.
+     *
+     * If set, a value that is not a plain number is compiled to a
+     *    \c Parrot::Expression, e.g. \c 2PI, <tt>PI/4</tt> or
+     *    <tt>1E-6*N_modes</tt>. Each distinct text is compiled once and kept
+     *    in a cache shared by all copies of the reader. Names are looked up
+     *    among the constants (see \c setConstant()) first, then among the
+     *    integer and real keywords parsed earlier in the same file: in the
+     *    current section first, then by their full name. Integer keywords
+     *    only accept expressions with an integral result. Off by default.
+     */
+    void setEvaluateExpressions             (bool newVal);
+    /**
+     * @brief defines a named constant for expressions, replacing any
+     *    constant of the same name.
+     *
+     * Constant names are case insensitive. Since constants are folded into
+     *    the compiled expressions, this starts a new expression cache.
+     *    \c reset() restores the constants \c PI and \c E.
+     */
+    void setConstant                        (const std::string & name, double value);
+    /**
+     * @brief sets whether after-parse restrictions are applied while reading
+     *    each line or in a separate pass once the whole file is read.
+     *
+     * If set, lines are only split, preparsed, checked against their
+     *    pre-parse restrictions and converted. The converted values are
+     *    stored right away, and the after-parse restrictions of all keywords
+     *    are applied afterwards, each keyword on its own. With more than one
+     *    thread (see \c setThreads()), this pass is shared among the threads
+     *    for files with many restricted keywords.
+     *
+     * The restriction violation policies keep their meaning, and messages
+     *    still name the line of the keyword. However, they are issued after
+     *    all messages of the reading pass, and a
+     *    \c RestrictionViolationPolicy::Exception is only thrown once the
+     *    whole file is read. Keywords without after-parse restrictions do not
+     *    take part in the pass. Off by default.
+     */
+    void setDeferValidation                 (bool newVal);
+    /**
+     * @brief sets the keyword of the directive that includes another file,
+     *    e.g. \c include for lines like <tt>include = ../base.ini</tt>.
+     *
+     * The included file is parsed as if its lines stood in place of the
+     *    directive: its keywords belong to the section in effect at the
+     *    directive, keywords found in both files are duplicates, and a
+     *    section started in the included file ends with it. Relative paths
+     *    refer to the directory of the including file; the path may be
+     *    quoted. Included files may include further files, but not
+     *    themselves, directly or indirectly. Messages about lines of an
+     *    included file name that file and its line number in \c $F and
+     *    \c $#.
+     *
+     * Each included file is parsed once per section it is included in and
+     *    kept in a \c Parrot::FragmentCache shared by all copies of the
+     *    reader, so a base file included by many files is only read again
+     *    when it was modified. With \c setEvaluateExpressions(true),
+     *    included files are parsed anew each time, since expressions may
+     *    refer to keywords of the including file.
+     *
+     * The directive takes precedence over a keyword of the same name, and
+     *    the keyword is matched case sensitively only if all keywords are.
+     *    \c parseLazy() does not follow included files. Empty by default,
+     *    which disables the directive.
+     *
+     * @throws Parrot::IncludeError while parsing, if an included file cannot
+     *    be read or includes itself; reported as a \c Parrot::ParseError
+     *    by \c tryParse().
+     */
+    void setIncludeKeyword                  (const std::string & newVal);
 
 
     /**
@@ -337,7 +663,46 @@ namespace Parrot {
     void addKeyword                  (const             Parrot::Descriptor &        descriptor);
 
 
-    //! @throws Parrot::InvalidDescriptorError via descriptorValidityCheck
+    /**
+     * @brief adds a rule that relates the values of several keywords.
+     *
+     * Constraints are checked in the order they were added, after the whole
+     *    file is read and missing keywords were set to their defaults.
+     *    \c check is only called if all \c keywords are present in the
+     *    \c Parrot::FileContent; its result decides as for a
+     *    \c Parrot::Restriction whether \c policy is applied.
+     *    \c RestrictionViolationPolicy::WarningRevert reverts all \c keywords
+     *    to their defaults. Within \c restrictionViolationText, \c $K is
+     *    replaced by the list of \c keywords.
+     *
+     * Example:
+     * @code
+     * reader.addConstraint({"N_photons", "N_modes"}, [] (const Parrot::FileContent & content) {
+     *   return content.get_Integer("N_PHOTONS") >= content.get_Integer("N_MODES");
+     * });
+     * @endcode
+     *
+     * @throws Parrot::InvalidFunctionError if \c check is empty
+     * @throws std::invalid_argument if any of \c keywords is not registered
+     */
+    void addConstraint               (const std::vector<std::string> &              keywords,
+                                      const std::function<bool (const FileContent &)> & check,
+                                      RestrictionViolationPolicy                    policy                    = RestrictionViolationPolicy::Exception,
+                                      const std::string &                           restrictionViolationText  = "inconsistent values of $K"
+    );
+    //! removes all constraints between keywords
+    void clearConstraints            ();
+
+
+    /**
+     * @brief adds all \c descriptors in one step.
+     *
+     * The batch is checked as a whole before anything is registered, i.e.
+     *    either all \c descriptors are added or none.
+     *
+     * @throws Parrot::InvalidDescriptorError via descriptorValidityCheck or if
+     *    two of \c descriptors have the same keyword
+     */
     void addKeywords                 (const std::vector<Parrot::Descriptor> &       descriptors);
     //! @throws Parrot::InvalidDescriptorError via descriptorValidityCheck
     void addKeywords                 (const std::vector<MinimalDescriptor> &        descriptors);
@@ -355,6 +720,29 @@ namespace Parrot {
                                       const std::vector<std::any> &                 defaultValues,
                                       const std::vector<bool> &                     mandatory = std::vector<bool>()
     );
+    /**
+     * @brief adds all keywords described in the schema file \c source in one
+     *    step; see \c Parrot::Schema for the format.
+     *
+     * @throws anything thrown by \c Parrot::Schema::load() or
+     *    \c addKeywords()
+     */
+    void loadSchema                  (const std::string &                           source);
+    /**
+     * @brief adds all keywords stored in the schema image \c filename in one
+     *    step, taking user functions from \c registry; see
+     *    \c Parrot::Schema::loadImage().
+     *
+     * Nothing is parsed or converted, and the keyword lookup table is built
+     *    while the keywords are added, so this is the fastest way to set up
+     *    a Reader with many keywords.
+     *
+     * @throws anything thrown by \c Parrot::Schema::loadImage() or
+     *    \c addKeywords()
+     */
+    void loadSchemaImage             (const std::string &                           filename,
+                                      const FunctionRegistry &                      registry = FunctionRegistry()
+    );
 
 
 
@@ -460,6 +848,165 @@ namespace Parrot {
     // I/O
 
     Parrot::FileContent operator() (const std::string & source) const;
+    /**
+     * @brief parses \c source like the plain call operator and additionally
+     *    adds the time spent in each parsing step to \c stats.
+     *
+     * The plain call operator does not read any clock; profiling only takes
+     *    place in this overload.
+     */
+    Parrot::FileContent operator() (const std::string & source, ParseStats & stats) const;
+    /**
+     * @brief parses \c source like the plain call operator, allocating the
+     *    elements of the returned \c Parrot::FileContent from \c resource.
+     *
+     * With a \c std::pmr::monotonic_buffer_resource, many short-lived
+     *    results can be released at once, and threads using separate
+     *    resources do not contend for the global heap. \c resource must
+     *    outlive the result.
+     */
+    Parrot::FileContent operator() (const std::string & source, std::pmr::memory_resource & resource) const;
+    /**
+     * @brief parses \c source without throwing on parsing errors.
+     *
+     * Every event that would make the call operator throw (i.e. any
+     *    \c ParsingErrorPolicy::Exception or
+     *    \c RestrictionViolationPolicy::Exception, as well as an inaccessible
+     *    file) is recorded as a \c Parrot::ParseError instead, and parsing
+     *    continues with the next line. Error messages are only assembled when
+     *    requested via \c Parrot::ParseError::message().
+     *
+     * Warnings are still sent to the diagnostic sink.
+     */
+    Parrot::ParseResult tryParse   (const std::string & source) const;
+
+    /**
+     * @brief parses \c source like the plain call operator, but on the
+     *    executor of this Reader (see \c setExecutor()).
+     *
+     * The call returns immediately. The future receives the
+     *    \c Parrot::FileContent or the exception the call operator would have
+     *    thrown; \c Parrot::ParseCancelledError if \c token was cancelled
+     *    before the parse started. Any number of files may be parsed at the
+     *    same time by one Reader.
+     *
+     * The Reader must outlive the parsing process and must not be modified
+     *    while it runs.
+     */
+    std::future<Parrot::FileContent>
+                        parseAsync     (const std::string & source, const CancellationToken & token = CancellationToken()) const;
+    /**
+     * @brief returns an object that parses \c source like \c parseAsync()
+     *    when awaited with \c co_await in a C++20 coroutine.
+     *
+     * See \c Parrot::ParseAwaitable.
+     */
+    ParseAwaitable      parseAwaitable (const std::string & source, const CancellationToken & token = CancellationToken()) const;
+    /**
+     * @brief parses all of \c sources, reading them in bulk.
+     *
+     * The files are read by the loader of this Reader (see
+     *    \c setFileLoader()). Each file is handed to the executor for parsing
+     *    as soon as it has been read, so parsing overlaps with reading the
+     *    remaining files. The call returns when all files have been read;
+     *    the futures are in the order of \c sources and behave like those of
+     *    \c parseAsync(). A file that cannot be read yields a
+     *    \c std::runtime_error.
+     *
+     * Meant for many small files, where opening and reading each one with
+     *    a \c std::fstream takes longer than parsing it.
+     */
+    std::vector<std::future<Parrot::FileContent>>
+                        parseBatch     (const std::vector<std::string> & sources, const CancellationToken & token = CancellationToken()) const;
+    /**
+     * @brief parses all regular files below \c root whose name matches the
+     *    glob \c pattern, like \c tryParse().
+     *
+     * The directory tree is walked in the calling thread. Each matching file
+     *    is handed to the executor (see \c setExecutor()) as soon as it is
+     *    found, so the first files are parsed while the walk continues. After
+     *    the walk, the calling thread parses all files the executor has not
+     *    started yet, and returns when all files have been parsed. Hence
+     *    this may also be called from a task of the executor, e.g. within a
+     *    pool of one thread.
+     *
+     * In \c pattern, \c * matches any characters but \c /, \c ** any
+     *    characters including \c /, \c ? one character but \c / and
+     *    <tt>[abc]</tt>, <tt>[a-z]</tt> and <tt>[!abc]</tt> one character of
+     *    (or not of) a set. A pattern without \c / is matched against the
+     *    file name, e.g. <tt>*.ini</tt>; otherwise against the path relative
+     *    to \c root, e.g. <tt>run[0-9]/config.ini</tt>. Matching is case
+     *    sensitive. Directories that cannot be entered are skipped.
+     *
+     * All messages go to the returned \c Parrot::DirectoryParseResult
+     *    instead of the diagnostic sink of this Reader. Its keys are the
+     *    paths of the files, i.e. \c root joined with the relative path.
+     *
+     * @throws std::runtime_error if \c root is not a directory
+     * @throws std::filesystem::filesystem_error if the walk fails; files
+     *    found until then are parsed before the exception is thrown
+     */
+    DirectoryParseResult parseDirectory(const std::string & root, const std::string & pattern = "*.ini") const;
+
+    /**
+     * @brief locates all <tt>[section]</tt> headers in \c source.
+     *
+     * This only reads the file line by line and looks for headers; no
+     *    keyword is parsed or converted. The index can be passed to the call
+     *    operator repeatedly as long as the file does not change.
+     *
+     * @throws std::runtime_error if the file cannot be opened
+     */
+    SectionIndex        indexSections (const std::string & source) const;
+    /**
+     * @brief parses only the given sections of \c source.
+     *
+     * Lines outside these sections are skipped without being parsed, and only
+     *    keywords whose \c Parrot::Descriptor belongs to one of the sections
+     *    are checked for being missing. Use the empty string to refer to the
+     *    global section, i.e. all lines before the first section header.
+     *
+     * Keywords in the returned \c Parrot::FileContent are qualified as
+     *    <tt>section.key</tt>, as with the plain call operator.
+     */
+    Parrot::FileContent operator() (const std::string & source, const std::vector<std::string> & sections) const;
+    //! @overload uses a section index previously obtained by \c indexSections()
+    Parrot::FileContent operator() (const std::string & source, const std::vector<std::string> & sections, const SectionIndex & index) const;
+
+    /**
+     * @brief scans \c source once and records the location of each keyword.
+     *
+     * Only the keyword names are extracted; no value is trimmed, converted or
+     *    validated. See \c Parrot::KeywordIndex.
+     *
+     * @throws std::runtime_error if the file cannot be opened
+     */
+    KeywordIndex        indexKeywords (const std::string & source) const;
+    /**
+     * @brief returns an object that parses the keywords of \c source on
+     *    demand.
+     *
+     * If \c indexFile is given and holds an index that is current for
+     *    \c source and this Reader, the scan of the file is skipped. Otherwise
+     *    the file is scanned and the index is written to \c indexFile.
+     *
+     * @throws std::runtime_error if the file cannot be opened or the index
+     *    cannot be written
+     */
+    LazyFileContent     parseLazy     (const std::string & source, const std::string & indexFile = "") const;
+    //! @overload uses an index obtained by \c indexKeywords() or \c Parrot::KeywordIndex::load()
+    LazyFileContent     parseLazy     (const KeywordIndex & index) const;
+
+    /**
+     * @brief writes all keywords to the schema image \c filename, to be read
+     *    back by \c loadSchemaImage().
+     *
+     * Constraints between keywords and the Reader settings are not part of
+     *    the image. See \c Parrot::Schema::saveImage().
+     *
+     * @throws std::runtime_error if the file cannot be written
+     */
+    void                saveSchemaImage(const std::string & filename) const;
 
     std::string to_string() const;
   };
@@ -469,6 +1016,8 @@ namespace Parrot {
 // template implementations
 
 #include "Parrot/Reader.tpp"
+#include "Parrot/LazyFileContent.hpp"
+#include "Parrot/ParseAwaitable.hpp"
 
 // ========================================================================== //
 
@@ -15,6 +15,14 @@
 
 #define THROWTEXT(msg) ("RUNTIME EXCEPTION IN "s + (__PRETTY_FUNCTION__) + "\n"s + msg)
 
+// ========================================================================== //
+// Getters
+
+template <typename T>
+Parrot::KeyHandle<T> Parrot::Reader::handle (const std::string & keyword) const {
+  return KeyHandle<T>( keywordTable, handleID(keyword, KeyHandle<T>::valueTypeID) );
+}
+
 // ========================================================================== //
 // Setters
 
@@ -38,8 +46,7 @@ void Parrot::Reader::addKeywordRanged            (const std::string &
 ) {
   auto descriptor = Descriptor();
   descriptor.makeRanged(keyword, defaultValue, min, max, policy, restrictionViolationText, mandatory);
-  descriptorValidityCheck (descriptor);
-  addKeyword              (descriptor);
+  addKeyword(descriptor);
 }
 // .......................................................................... //
 template <typename T>
@@ -53,8 +60,7 @@ void Parrot::Reader::addKeywordListboundPreParse (const std::string &
 ) {
   auto descriptor = Descriptor();
   descriptor.makeListboundPreParse(keyword, defaultValue, list, forbiddenList, policy, restrictionViolationText, mandatory);
-  descriptorValidityCheck (descriptor);
-  addKeyword              (descriptor);
+  addKeyword(descriptor);
 }
 // .......................................................................... //
 template <typename LT>
@@ -68,8 +74,7 @@ void Parrot::Reader::addKeywordListboundAftParse (const std::string &
 ) {
   auto descriptor = Descriptor();
   descriptor.makeListboundAftParse(keyword, valueType, list, forbiddenList, policy, restrictionViolationText, mandatory);
-  descriptorValidityCheck (descriptor);
-  addKeyword              (descriptor);
+  addKeyword(descriptor);
 }
 // .......................................................................... //
 template <typename DT, typename LT>
@@ -83,8 +88,7 @@ void Parrot::Reader::addKeywordListboundAftParse (const std::string &
 ) {
   auto descriptor = Descriptor();
   descriptor.makeListboundAftParse(keyword, defaultValue, list, forbiddenList, policy, restrictionViolationText, mandatory);
-  descriptorValidityCheck (descriptor);
-  addKeyword              (descriptor);
+  addKeyword(descriptor);
 }
 // .......................................................................... //
 template <typename T>
@@ -97,8 +101,7 @@ void Parrot::Reader::addKeywordUserboundPreParse (const std::string &
 ) {
   auto descriptor = Descriptor();
   descriptor.makeUserboundPreParse(keyword, defaultValue, uFunc, policy, restrictionViolationText, mandatory);
-  descriptorValidityCheck (descriptor);
-  addKeyword              (descriptor);
+  addKeyword(descriptor);
 }
 // .......................................................................... //
 template <typename T>
@@ -111,8 +114,7 @@ void Parrot::Reader::addKeywordUserboundAftParse (const std::string &
 ) {
   auto descriptor = Descriptor();
   descriptor.makeUserboundAftParse(keyword, valueType, uFunc, policy, restrictionViolationText, mandatory);
-  descriptorValidityCheck (descriptor);
-  addKeyword              (descriptor);
+  addKeyword(descriptor);
 }
 // .......................................................................... //
 template <typename T>
@@ -125,8 +127,7 @@ void Parrot::Reader::addKeywordUserboundAftParse (const std::string &
 ) {
   auto descriptor = Descriptor();
   descriptor.makeUserboundAftParse(keyword, defaultValue, uFunc, policy, restrictionViolationText, mandatory);
-  descriptorValidityCheck (descriptor);
-  addKeyword              (descriptor);
+  addKeyword(descriptor);
 }
 
 // ========================================================================== //
@@ -63,6 +63,76 @@ namespace Parrot {
 
   //! @todo Restriction: make a CTor with a string argument, creating a valid characters check function
 
+  // ======================================================================== //
+  // class
+
+  /**
+   * @brief a user defined validation function, bound to the
+   *    \c Parrot::ValueTypeID() of its argument.
+   *
+   * Only plain functions <tt>bool f(const T &)</tt> are accepted as
+   *    validation functions, so a \c Parrot::Validator keeps just the
+   *    function pointer along with a dispatcher instantiated for \c T. A call
+   *    thus neither copies the function nor the checked value: the value is
+   *    looked up in its \c std::any by reference and passed on as
+   *    <tt>const T &</tt>.
+   */
+  class Validator {
+  public:
+    //! the type-erased form of the stored function pointer
+    using Function   = void (*) ();
+    //! calls \c function on the content of \c value
+    using Dispatcher = bool (*) (Function function, const std::any & value);
+
+  private:
+    ValueTypeID valueTypeID = ValueTypeID::None;
+    Function    function    = nullptr;
+    Dispatcher  dispatcher  = nullptr;
+
+    template<ValueTypeID ID>
+    static bool dispatch(Function function, const std::any & value);
+
+  public:
+    // ---------------------------------------------------------------------- //
+    // CTors
+
+    //! an empty validator; see \c operator bool()
+    Validator() = default;
+
+    /**
+     * @brief binds \c uFunc to the \c Parrot::ValueTypeID() \c ID.
+     *
+     * @throws Parrot::InvalidFunctionError if \c uFunc is empty or does not
+     *    hold a plain function <tt>bool f(const PARROT_TYPE(ID) &)</tt>
+     */
+    template<ValueTypeID ID>
+    static Validator make(const std::function<bool (const typename ValueType<ID>::value_type &)> & uFunc);
+
+    // ---------------------------------------------------------------------- //
+    // Getters
+
+    //! returns the \c Parrot::ValueTypeID() of the function argument
+    ValueTypeID getValueTypeID() const {return valueTypeID;}
+    //! returns the address of the bound function or \c nullptr
+    const void* getTarget     () const {return reinterpret_cast<const void *>(function);}
+    //! returns whether a function is bound
+    explicit operator bool    () const {return function;}
+
+    // ---------------------------------------------------------------------- //
+    // Evaluation
+
+    /**
+     * @brief calls the bound function on the content of \c value
+     *
+     * @throws Parrot::ValueTypeError if \c value does not hold a
+     *    \c PARROT_TYPE() of the bound \c Parrot::ValueTypeID()
+     */
+    bool operator() (const std::any & value) const {return dispatcher(function, value);}
+  };
+
+  // ======================================================================== //
+  // class
+
 
   class Restriction {
   private:
@@ -71,6 +141,7 @@ namespace Parrot {
     
     RestrictionType aftParseRestrictionType = RestrictionType::None;
     std::any        aftParseRestriction;
+    Validator       aftParseValidator;
 
     RestrictionValueTypeID      restrictionValueTypeID     = RestrictionValueTypeID::None;
     
@@ -78,9 +149,10 @@ namespace Parrot {
     std::string                 restrictionViolationText   = "value not allowed\n$L";
     
     // ---------------------------------------------------------------------- //
-    // Rectifyers
+    // Setters
 
-    void rectify_AftParseValidationList ();
+    template<ValueTypeID ID>
+    void setAftParseValidator(const std::function<bool (const typename ValueType<ID>::value_type &)> & uFunc, RestrictionValueTypeID typeRestriction);
 
   public:
     // ---------------------------------------------------------------------- //
@@ -220,6 +292,16 @@ namespace Parrot {
      */
     const std::any &  getAftParseRestriction    () const;
     // ...................................................................... //
+
+    /**
+     * @brief returns the user defined function applied after parsing, bound
+     *    to the \c Parrot::ValueTypeID() of its argument.
+     *
+     * The returned \c Parrot::Validator is empty unless the
+     *    \c aftParseRestriction is set to \c Parrot::RestrictionType::Function.
+     */
+    const Validator & getAftParseValidator      () const;
+    // ...................................................................... //
     
     
     /**
@@ -421,6 +503,10 @@ namespace Parrot {
      *    to the indicated \c Parrot::ValueTypeID() such that it represents a
      *    \c Parrot::RestrictionType::Function.
      *
+     * The function is bound to the \c Parrot::ValueTypeID() of its argument
+     *    and can only be used with keywords of exactly that type; see
+     *    \c Parrot::Validator.
+     *
      * @param uFunc the function to be called to decide whether or not a value
      *    is valid.
      *
@@ -442,6 +528,20 @@ namespace Parrot {
     void setAftParseValidationFunction(const std::function<bool (const PARROT_TYPE(ValueTypeID::RealList   ) &)> & uFunc);
     //! @overload void setAftParseValidationFunction(const std::function<bool (const PARROT_TYPE(ValueTypeID::BooleanList) &)> & uFunc)
     void setAftParseValidationFunction(const std::function<bool (const PARROT_TYPE(ValueTypeID::BooleanList) &)> & uFunc);
+    //! @overload void setAftParseValidationFunction(const std::function<bool (const PARROT_TYPE(ValueTypeID::RealRange  ) &)> & uFunc)
+    void setAftParseValidationFunction(const std::function<bool (const PARROT_TYPE(ValueTypeID::RealRange  ) &)> & uFunc);
+    //! @overload void setAftParseValidationFunction(const std::function<bool (const PARROT_TYPE(ValueTypeID::Int32      ) &)> & uFunc)
+    void setAftParseValidationFunction(const std::function<bool (const PARROT_TYPE(ValueTypeID::Int32      ) &)> & uFunc);
+    //! @overload void setAftParseValidationFunction(const std::function<bool (const PARROT_TYPE(ValueTypeID::Float32    ) &)> & uFunc)
+    void setAftParseValidationFunction(const std::function<bool (const PARROT_TYPE(ValueTypeID::Float32    ) &)> & uFunc);
+    //! @overload void setAftParseValidationFunction(const std::function<bool (const PARROT_TYPE(ValueTypeID::Complex    ) &)> & uFunc)
+    void setAftParseValidationFunction(const std::function<bool (const PARROT_TYPE(ValueTypeID::Complex    ) &)> & uFunc);
+    //! @overload void setAftParseValidationFunction(const std::function<bool (const PARROT_TYPE(ValueTypeID::Int32List  ) &)> & uFunc)
+    void setAftParseValidationFunction(const std::function<bool (const PARROT_TYPE(ValueTypeID::Int32List  ) &)> & uFunc);
+    //! @overload void setAftParseValidationFunction(const std::function<bool (const PARROT_TYPE(ValueTypeID::Float32List) &)> & uFunc)
+    void setAftParseValidationFunction(const std::function<bool (const PARROT_TYPE(ValueTypeID::Float32List) &)> & uFunc);
+    //! @overload void setAftParseValidationFunction(const std::function<bool (const PARROT_TYPE(ValueTypeID::ComplexList) &)> & uFunc)
+    void setAftParseValidationFunction(const std::function<bool (const PARROT_TYPE(ValueTypeID::ComplexList) &)> & uFunc);
     // ...................................................................... //
     
     /**
@@ -17,6 +17,42 @@
 
 #define THROWTEXT(msg) ("RUNTIME EXCEPTION IN "s + (__PRETTY_FUNCTION__) + "\n"s + msg)
 
+// ========================================================================== //
+// Validator
+
+template<Parrot::ValueTypeID ID>
+bool Parrot::Validator::dispatch(Function function, const std::any & value) {
+  using T = typename ValueType<ID>::value_type;
+
+  const auto * typed = std::any_cast<T>(&value);
+  if (!typed) {
+    throw Parrot::ValueTypeError(THROWTEXT("    validation function for "s + valueTypeName(ID) + " called on incompatible value"));
+  }
+
+  return reinterpret_cast<bool (*) (const T &)>(function)(*typed);
+}
+// .......................................................................... //
+template<Parrot::ValueTypeID ID>
+Parrot::Validator Parrot::Validator::make(const std::function<bool (const typename ValueType<ID>::value_type &)> & uFunc) {
+  using T = typename ValueType<ID>::value_type;
+
+  if ( !uFunc ) {throw Parrot::InvalidFunctionError(THROWTEXT("    Uninitialized parsing function"));}
+
+  /* Apparently, it is possible to pass wrong-typed functions without any issue.
+   * Only then, retrieving the function pointer will yield zero and the call
+   * itself will fail.
+   */
+  auto ptr = uFunc.template target<bool (*) (const T &)>();
+  if ( !ptr || !*ptr ) {throw Parrot::InvalidFunctionError(THROWTEXT("    Uninitialized validation function"));}
+
+  Validator reVal;
+  reVal.valueTypeID = ID;
+  reVal.function    = reinterpret_cast<Function>(*ptr);
+  reVal.dispatcher  = dispatch<ID>;
+
+  return reVal;
+}
+
 // ========================================================================== //
 // Getters
 
@@ -62,9 +98,17 @@ void Parrot::Restriction::setAftParseValidationList(const std::vector<T> & list,
   auto resType = (forbiddenList ? RestrictionType::ForbiddenList : RestrictionType::AllowedList);
 
   aftParseRestrictionType = resType;
-  aftParseRestriction     = list;
+  aftParseRestriction     = toParrotValue(list);
+  aftParseValidator       = Validator();
+}
 
-  rectify_AftParseValidationList ();
+// -------------------------------------------------------------------------- //
+template<Parrot::ValueTypeID ID>
+void Parrot::Restriction::setAftParseValidator(const std::function<bool (const typename ValueType<ID>::value_type &)> & uFunc, RestrictionValueTypeID typeRestriction) {
+  aftParseValidator       = Validator::make<ID>(uFunc);
+  aftParseRestrictionType = RestrictionType::Function;
+  aftParseRestriction     = uFunc;
+  restrictionValueTypeID  = typeRestriction;
 }
 
 // ========================================================================== //
@@ -0,0 +1,142 @@
+/* Keyword descriptions kept as data in a schema file.
+ *
+ */
+
+#ifndef PARROT_SCHEMA_HPP
+#define PARROT_SCHEMA_HPP
+
+// ========================================================================== //
+// dependencies
+
+// STL
+#include <string>
+#include <vector>
+
+// own
+#include "Parrot/Definitions.hpp"
+#include "Parrot/Descriptor.hpp"
+#include "Parrot/FunctionRegistry.hpp"
+
+// ========================================================================== //
+
+namespace Parrot {
+
+  // ======================================================================== //
+  // class
+
+  /**
+   * @brief a list of <tt>Parrot::Descriptor</tt>s read from a schema file.
+   *
+   * A schema file is an .ini file, read by a \c Parrot::Reader itself, with
+   *    one section per keyword. The section name is the keyword name; a name
+   *    of the form <tt>section.key</tt> describes the keyword \c key in the
+   *    section \c section. Within a keyword section, these properties are
+   *    understood:
+   *
+   * <table>
+   *  <tr><th>Property  <th>Meaning
+   *  <tr><td>type      <td>name of a \c Parrot::ValueTypeID, e.g.
+   *                        \c Integer or \c RealList (required)
+   *  <tr><td>default   <td>default value, written like a value of that type
+   *  <tr><td>mandatory <td>whether the keyword is mandatory (default: false)
+   *  <tr><td>min, max  <td>bounds of a range restriction; a missing bound is
+   *                        unlimited
+   *  <tr><td>allowed   <td>list of allowed values; only for \c String,
+   *                        \c Integer, \c Real, \c Int32 and \c Float32.
+   *                        Words are trimmed and compared ignoring case,
+   *                        like the values read for the keyword.
+   *  <tr><td>forbidden <td>list of forbidden values; as \c allowed
+   *  <tr><td>policy    <td>name of the \c Parrot::RestrictionViolationPolicy
+   *                        of the restrictions (default: \c Exception)
+   *  <tr><td>message   <td>restriction violation text of the restrictions
+   * </table>
+   *
+   * Example:
+   * @code
+   * [N_photons]
+   * type      = Integer
+   * default   = 10
+   * min       = 1
+   * policy    = WarningRevert
+   *
+   * [optics.mode]
+   * type      = String
+   * mandatory = true
+   * allowed   = linear, circular
+   * @endcode
+   *
+   * Property and type names are case insensitive, keyword names keep their
+   *    spelling. The file is read in two passes of a \c Parrot::Reader
+   *    regardless of the number of keywords: one for the types and one for
+   *    the defaults and lists, which are converted like values of the
+   *    declared type.
+   */
+  class Schema {
+  private:
+    std::vector<Descriptor> descriptors;
+
+  public:
+    // ---------------------------------------------------------------------- //
+    // CTors
+
+    Schema() = default;
+    //! a schema of the given descriptors
+    Schema(const std::vector<Descriptor> & descriptors);
+
+    /**
+     * @brief reads the schema file \c source
+     *
+     * @throws Parrot::InvalidDescriptorError if a property is found outside
+     *    of a keyword section, if a property is unknown or if a keyword has
+     *    no type
+     * @throws Parrot::ValueTypeError if a type or policy name is unknown or
+     *    if \c allowed or \c forbidden are given for an unsupported type
+     * @throws anything thrown by \c Parrot::Reader on reading \c source, e.g.
+     *    if a default cannot be converted to the declared type
+     */
+    static Schema load(const std::string & source);
+
+    // ---------------------------------------------------------------------- //
+    // Getters
+
+    //! returns the descriptors in the order of the schema file
+    const std::vector<Descriptor> & getDescriptors() const;
+    //! returns the number of keywords
+    size_t                          size          () const;
+
+    // ---------------------------------------------------------------------- //
+    // I/O
+
+    /**
+     * @brief writes the descriptors to the binary schema image \c filename
+     *
+     * The image holds keys, types, defaults, flags, substitutions and all
+     *    restrictions in the form they are stored in, so loading it does not
+     *    parse or convert anything. Functions are represented by their
+     *    position only; see \c Parrot::FunctionRegistry. Images are bound to
+     *    the byte order of the machine that wrote them.
+     *
+     * @throws std::runtime_error if the file cannot be written
+     */
+    void          saveImage(const std::string & filename) const;
+
+    /**
+     * @brief reads a schema image written by \c saveImage(), taking all user
+     *    functions from \c registry
+     *
+     * The file is read with a single call and decoded from memory.
+     *
+     * @throws std::runtime_error if the file cannot be read, is not a schema
+     *    image or was written with a different byte order
+     * @throws Parrot::InvalidFunctionError if a function recorded in the
+     *    image is missing from \c registry
+     * @throws Parrot::RestrictionTypeError if a function in \c registry does
+     *    not match the type of its keyword
+     */
+    static Schema loadImage(const std::string & filename, const FunctionRegistry & registry = FunctionRegistry());
+  };
+}
+
+// ========================================================================== //
+
+#endif
@@ -0,0 +1,108 @@
+// ========================================================================== //
+// dependencies
+
+// STL
+#include <stdexcept>
+
+#include <string>
+using namespace std::string_literals;
+
+#include <cctype>
+
+// own
+#include "Parrot/Definitions.hpp"
+#include "Parrot/BooleanVocabulary.hpp"
+
+using namespace Parrot;
+
+// ========================================================================== //
+// local macro
+
+#define THROWTEXT(msg) ("RUNTIME EXCEPTION IN "s + (__PRETTY_FUNCTION__) + "\n"s + msg)
+
+// ========================================================================== //
+// local helpers
+
+inline char foldChar(char c) {return std::toupper( static_cast<unsigned char>(c) );}
+
+// ========================================================================== //
+// private functions
+
+void BooleanVocabulary::add(const std::string & word, bool value) {
+  if ( word.empty() ) {throw std::invalid_argument(THROWTEXT("    empty boolean word!"));}
+
+  Word entry = {word, value};
+  if (!caseSensitive) {for (auto & c : entry.text) {c = foldChar(c);}}
+
+  if (byLength.size() <= word.size()) {byLength.resize(word.size() + 1);}
+
+  for (const auto & other : byLength[word.size()]) {
+    if (other.text != entry.text) {continue;}
+    if (other.value == value)     {return;}
+    throw std::invalid_argument(THROWTEXT("    '" + word + "' is both a true and a false word!"));
+  }
+
+  byLength[word.size()].push_back(std::move(entry));
+}
+
+// ========================================================================== //
+// CTors
+
+BooleanVocabulary::BooleanVocabulary() :
+  BooleanVocabulary(defaultBooleanTextTrue, defaultBooleanTextFalse)
+{}
+// .......................................................................... //
+BooleanVocabulary::BooleanVocabulary(const std::vector<std::string> & wordsTrue,
+                                     const std::vector<std::string> & wordsFalse,
+                                     bool                             caseSensitive
+) :
+  wordsTrue     (wordsTrue ),
+  wordsFalse    (wordsFalse),
+  caseSensitive (caseSensitive)
+{
+  for (const auto & word : wordsTrue ) {add(word, true );}
+  for (const auto & word : wordsFalse) {add(word, false);}
+}
+
+// ========================================================================== //
+// Getters
+
+const std::vector<std::string> &  BooleanVocabulary::getWordsTrue   () const {return wordsTrue    ;}
+const std::vector<std::string> &  BooleanVocabulary::getWordsFalse  () const {return wordsFalse   ;}
+bool                              BooleanVocabulary::isCaseSensitive() const {return caseSensitive;}
+
+// ========================================================================== //
+// Recognition
+
+std::optional<bool> BooleanVocabulary::recognize(std::string_view token) const {
+  if (token.size() >= byLength.size()) {return std::nullopt;}
+
+  for (const auto & word : byLength[token.size()]) {
+    auto i = 0u;
+    if (caseSensitive) {while (i < token.size() &&          token[i]  == word.text[i]) {++i;}}
+    else               {while (i < token.size() && foldChar(token[i]) == word.text[i]) {++i;}}
+
+    if (i == token.size()) {return word.value;}
+  }
+
+  return std::nullopt;
+}
+
+// ========================================================================== //
+// Representation
+
+std::string BooleanVocabulary::to_string() const {
+  std::string reVal;
+
+  auto join = [&reVal] (const std::vector<std::string> & words) {
+    for (auto i = 0u; i < words.size(); ++i) {reVal += (i ? ", " : "") + words[i];}
+  };
+
+  reVal += "true: ";
+  join(wordsTrue);
+  reVal += "; false: ";
+  join(wordsFalse);
+  if (caseSensitive) {reVal += " (case sensitive)";}
+
+  return reVal;
+}
@@ -0,0 +1,828 @@
+// ========================================================================== //
+// dependencies
+
+// STL
+#include <stdexcept>
+
+#include <string>
+using namespace std::string_literals;
+
+#include <algorithm>
+#include <cctype>
+#include <cmath>
+#include <cstdint>
+#include <fstream>
+#include <iomanip>
+#include <limits>
+#include <map>
+#include <set>
+#include <sstream>
+#include <string_view>
+
+// own
+#include "BCG.hpp"
+#include "Parrot/CodeGenerator.hpp"
+#include "Parrot/Restriction.hpp"
+
+using namespace Parrot;
+
+// ========================================================================== //
+// local macro
+
+#define THROWTEXT(msg) ("RUNTIME EXCEPTION IN "s + (__PRETTY_FUNCTION__) + "\n"s + msg)
+
+// ========================================================================== //
+// local helpers
+
+/* The generated parser mimics a Parrot::Reader with default settings; the texts
+ * below are those of Reader::reset().
+ */
+
+namespace {
+  const std::string missingMandatoryText    = "mandatory keyword '$K' was not found in file '$F'!";
+  const std::string missingNonMandatoryText = "keyword '$K' was not found; reverting to default ('$D')";
+  const std::string unexpectedKeywordText   = "unexpected keyword in file '$F', line $# (ignored)!\n$L";
+  const std::string duplicateKeywordText    = "duplicate keyword '$K' in file '$F', line $# (updating to new value)\n$L";
+  const std::string conversionErrorText     = "could not convert to target type $T in line $#\n$L";
+  const std::string malformedLineText       = "found no value in line $#:\n$L";
+
+  // ........................................................................ //
+  const std::set<std::string> reservedNames = {
+    "alignas", "alignof", "and", "and_eq", "asm", "auto", "bitand", "bitor", "bool", "break", "case", "catch", "char",
+    "char8_t", "char16_t", "char32_t", "class", "compl", "concept", "const", "consteval", "constexpr", "constinit",
+    "const_cast", "continue", "co_await", "co_return", "co_yield", "decltype", "default", "delete", "do", "double",
+    "dynamic_cast", "else", "enum", "explicit", "export", "extern", "false", "float", "for", "friend", "goto", "if",
+    "inline", "int", "long", "mutable", "namespace", "new", "noexcept", "not", "not_eq", "nullptr", "operator", "or",
+    "or_eq", "private", "protected", "public", "register", "reinterpret_cast", "requires", "return", "short", "signed",
+    "sizeof", "static", "static_assert", "static_cast", "struct", "switch", "template", "this", "thread_local", "throw",
+    "true", "try", "typedef", "typeid", "typename", "union", "unsigned", "using", "virtual", "void", "volatile",
+    "wchar_t", "while", "xor", "xor_eq",
+    "load", "parse"                                                             // static members of the generated struct
+  };
+
+  // ------------------------------------------------------------------------ //
+  bool isIdentifier(const std::string & name) {
+    if ( name.empty() || std::isdigit(static_cast<unsigned char>(name[0])) ) {return false;}
+    for (char c : name) {
+      if ( !std::isalnum(static_cast<unsigned char>(c)) && c != '_' ) {return false;}
+    }
+    return !reservedNames.contains(name);
+  }
+  // ........................................................................ //
+  std::string memberName(const std::string & qualifiedKey) {
+    std::string reVal = qualifiedKey;
+    for (auto & c : reVal) {
+      if ( !std::isalnum(static_cast<unsigned char>(c)) ) {c = '_';}
+    }
+    if ( reVal.empty() || std::isdigit(static_cast<unsigned char>(reVal[0])) ) {reVal.insert(0, "_");}
+    if ( reservedNames.contains(reVal)                                      ) {reVal += "_";}
+    return reVal;
+  }
+
+  // ------------------------------------------------------------------------ //
+  std::uint64_t hashName(std::string_view text) {                               // FNV-1a; must match hash() in runtimeCode
+    std::uint64_t reVal = 0xcbf29ce484222325ull;
+    for (char c : text) {reVal = (reVal ^ static_cast<unsigned char>(c)) * 0x100000001b3ull;}
+    return reVal;
+  }
+
+  // ------------------------------------------------------------------------ //
+  std::string stringLiteral(const std::string & text) {
+    std::ostringstream reVal;
+    reVal << '"';
+    for (char c : text) {
+      switch (c) {
+        case '"'  : reVal << "\\\""; break;
+        case '\\' : reVal << "\\\\"; break;
+        case '\n' : reVal << "\\n" ; break;
+        case '\t' : reVal << "\\t" ; break;
+        case '\r' : reVal << "\\r" ; break;
+        default   :
+          if ( std::iscntrl(static_cast<unsigned char>(c)) ) {
+            reVal << '\\' << std::oct << std::setw(3) << std::setfill('0') << int(static_cast<unsigned char>(c)) << std::dec;
+          } else {
+            reVal << c;
+          }
+      }
+    }
+    reVal << '"';
+    return reVal.str();
+  }
+  // ........................................................................ //
+  std::string charLiteral(char c) {
+    auto reVal = stringLiteral(std::string(1, c));
+    reVal.front() = reVal.back() = '\'';
+    if (c == '\'') {reVal = "'\\''";}
+    return reVal;
+  }
+  // ........................................................................ //
+  std::string integerLiteral(long long int value) {
+    if (value == std::numeric_limits<long long int>::min()) {return "(-9223372036854775807ll - 1)";}
+    return std::to_string(value) + "ll";
+  }
+  // ........................................................................ //
+  std::string realLiteral(double value, bool single) {
+    const std::string type = single ? "float" : "double";
+
+    if ( std::isnan(value) ) {return "std::numeric_limits<" + type + ">::quiet_NaN()";}
+    if ( std::isinf(value) ) {return (value < 0 ? "-" : "") + "std::numeric_limits<"s + type + ">::infinity()";}
+
+    std::ostringstream stream;
+    stream << std::setprecision(single ? 9 : 17) << value;
+    auto reVal = stream.str();
+    if (reVal.find_first_of(".e") == std::string::npos) {reVal += ".0";}
+    return reVal + (single ? "f" : "");
+  }
+
+  // ------------------------------------------------------------------------ //
+  bool isList(ValueTypeID valueType) {
+    switch (valueType) {
+      case ValueTypeID::StringList  :
+      case ValueTypeID::IntegerList :
+      case ValueTypeID::RealList    :
+      case ValueTypeID::BooleanList :
+      case ValueTypeID::Int32List   :
+      case ValueTypeID::Float32List : return true;
+      default                       : return false;
+    }
+  }
+  // ........................................................................ //
+  ValueTypeID elementTypeOf(ValueTypeID valueType) {
+    switch (valueType) {
+      case ValueTypeID::StringList  : return ValueTypeID::String ;
+      case ValueTypeID::IntegerList : return ValueTypeID::Integer;
+      case ValueTypeID::RealList    : return ValueTypeID::Real   ;
+      case ValueTypeID::BooleanList : return ValueTypeID::Boolean;
+      case ValueTypeID::Int32List   : return ValueTypeID::Int32  ;
+      case ValueTypeID::Float32List : return ValueTypeID::Float32;
+      default                       : return valueType;
+    }
+  }
+  // ........................................................................ //
+  std::string cppType(ValueTypeID valueType) {
+    switch (valueType) {
+      case ValueTypeID::String      : return "std::string";
+      case ValueTypeID::Integer     : return "long long int";
+      case ValueTypeID::Real        : return "double";
+      case ValueTypeID::Boolean     : return "bool";
+      case ValueTypeID::Int32       : return "std::int32_t";
+      case ValueTypeID::Float32     : return "float";
+      case ValueTypeID::StringList  :
+      case ValueTypeID::IntegerList :
+      case ValueTypeID::RealList    :
+      case ValueTypeID::BooleanList :
+      case ValueTypeID::Int32List   :
+      case ValueTypeID::Float32List : return "std::vector<" + cppType( elementTypeOf(valueType) ) + ">";
+      default                       :
+        throw ValueTypeError(THROWTEXT("    values of type " + valueTypeName(valueType) + " are not supported by the code generator"));
+    }
+  }
+  // ........................................................................ //
+  std::string converterName(ValueTypeID valueType) {                            // element converters in runtimeCode
+    switch ( elementTypeOf(valueType) ) {
+      case ValueTypeID::String      : return "toString" ;
+      case ValueTypeID::Integer     : return "toInteger";
+      case ValueTypeID::Real        : return "toReal"   ;
+      case ValueTypeID::Boolean     : return "toBoolean";
+      case ValueTypeID::Int32       : return "toInt32"  ;
+      case ValueTypeID::Float32     : return "toFloat32";
+      default                       : return "";
+    }
+  }
+
+  // ------------------------------------------------------------------------ //
+  std::string elementLiteral(ValueTypeID valueType, const std::any & value) {   // value of a scalar type, or of a restriction list element type
+    switch (valueType) {
+      case ValueTypeID::String      : return stringLiteral ( std::any_cast<PARROT_TYPE(ValueTypeID::String )>(value) );
+      case ValueTypeID::Integer     : return integerLiteral( std::any_cast<PARROT_TYPE(ValueTypeID::Integer)>(value) );
+      case ValueTypeID::Real        : return realLiteral   ( std::any_cast<PARROT_TYPE(ValueTypeID::Real   )>(value), false );
+      case ValueTypeID::Boolean     : return std::any_cast<PARROT_TYPE(ValueTypeID::Boolean)>(value) ? "true" : "false";
+      case ValueTypeID::Int32       : return std::to_string( std::any_cast<PARROT_TYPE(ValueTypeID::Int32  )>(value) );
+      case ValueTypeID::Float32     : return realLiteral   ( std::any_cast<PARROT_TYPE(ValueTypeID::Float32)>(value), true  );
+      default                       : return "";
+    }
+  }
+  // ........................................................................ //
+  template<typename T>
+  std::string listLiteral(ValueTypeID elementType, const std::any & value) {
+    std::string reVal = "{";
+    for (const auto & element : std::any_cast<const std::vector<T> &>(value)) {
+      if (reVal.size() > 1) {reVal += ", ";}
+      reVal += elementLiteral(elementType, static_cast<T>(element));
+    }
+    return reVal + "}";
+  }
+  // ........................................................................ //
+  std::string valueLiteral(ValueTypeID valueType, const std::any & value) {
+    if ( !value.has_value() ) {return "{}";}
+
+    switch (valueType) {
+      case ValueTypeID::StringList  : return listLiteral<PARROT_TYPE(ValueTypeID::String )>(ValueTypeID::String , value);
+      case ValueTypeID::IntegerList : return listLiteral<PARROT_TYPE(ValueTypeID::Integer)>(ValueTypeID::Integer, value);
+      case ValueTypeID::RealList    : return listLiteral<PARROT_TYPE(ValueTypeID::Real   )>(ValueTypeID::Real   , value);
+      case ValueTypeID::BooleanList : return listLiteral<PARROT_TYPE(ValueTypeID::Boolean)>(ValueTypeID::Boolean, value);
+      case ValueTypeID::Int32List   : return listLiteral<PARROT_TYPE(ValueTypeID::Int32  )>(ValueTypeID::Int32  , value);
+      case ValueTypeID::Float32List : return listLiteral<PARROT_TYPE(ValueTypeID::Float32)>(ValueTypeID::Float32, value);
+      default                       : return elementLiteral(valueType, value);
+    }
+  }
+
+  // ------------------------------------------------------------------------ //
+  std::string membership(const std::string & item, ValueTypeID elementType, const std::any & list) { // "item is in list" as a chain of comparisons
+    std::vector<std::string> literals;
+
+    switch (elementType) {
+      case ValueTypeID::String  :
+        for (const auto & element : std::any_cast<const PARROT_TYPE(ValueTypeID::StringList ) &>(list)) {literals.push_back( stringLiteral (element) );}
+        break;
+      case ValueTypeID::Integer :
+      case ValueTypeID::Int32   :
+        for (const auto & element : std::any_cast<const PARROT_TYPE(ValueTypeID::IntegerList) &>(list)) {literals.push_back( integerLiteral(element) );}
+        break;
+      case ValueTypeID::Real    :
+      case ValueTypeID::Float32 :                                               // compared at the stored precision, as by the Reader
+        for (const auto & element : std::any_cast<const PARROT_TYPE(ValueTypeID::RealList   ) &>(list)) {literals.push_back( realLiteral(element, elementType == ValueTypeID::Float32) );}
+        break;
+      default :
+        throw RestrictionTypeError(THROWTEXT("    list restrictions on values of type " + valueTypeName(elementType) + " are not supported by the code generator"));
+    }
+
+    if ( literals.empty() ) {return "false";}
+
+    std::string reVal;
+    for (const auto & literal : literals) {
+      if ( !reVal.empty() ) {reVal += " || ";}
+      reVal += item + " == " + literal;
+    }
+    return "(" + reVal + ")";
+  }
+  // ........................................................................ //
+  std::string outOfRange(const std::string & item, ValueTypeID elementType, double min, double max) {
+    std::vector<std::string> conditions;
+
+    if ( !std::isinf(min) || min > 0 ) {conditions.push_back(item + " < " + realLiteral(min, false));}
+    if ( !std::isinf(max) || max < 0 ) {conditions.push_back(item + " > " + realLiteral(max, false));}
+    if ( elementType == ValueTypeID::Real || elementType == ValueTypeID::Float32 ) {conditions.push_back(item + " != " + item);}  // NaN
+
+    std::string reVal;
+    for (const auto & condition : conditions) {
+      if ( !reVal.empty() ) {reVal += " || ";}
+      reVal += condition;
+    }
+    return reVal;
+  }
+
+  // ------------------------------------------------------------------------ //
+  void writeViolation(std::ostringstream & code, const Restriction & restriction, const std::string & context, const std::string & revert) {
+    const auto text = "message(" + stringLiteral( restriction.getRestrictionViolationText() ) + ", " + context + ")";
+
+    switch ( restriction.getRestrictionViolationPolicy() ) {
+      case RestrictionViolationPolicy::Warning       : code << "      warn(context, " << text << ");\n";                     break;
+      case RestrictionViolationPolicy::WarningRevert : code << "      warn(context, " << text << ");\n      " << revert << "\n"; break;
+      case RestrictionViolationPolicy::Exception     : code << "      throw std::runtime_error(" << text << ");\n";          break;
+    }
+  }
+
+  // ------------------------------------------------------------------------ //
+  /* The part of the generated source that is the same for every schema. The
+   * boolean words are inserted in place of $TRUE and $FALSE.
+   */
+  const std::string runtimeCode = R"~~~(
+  // ------------------------------------------------------------------------ //
+  // parsing state
+
+  struct Context {
+    const std::string & filename;
+    std::ostream *      warnings;
+    size_t              linenumber = 0;
+    std::string         lineOriginal;
+    std::string         keyword;
+    std::string         value;
+
+    Context(const std::string & filename, std::ostream * warnings) : filename(filename), warnings(warnings) {}
+  };
+
+  // ------------------------------------------------------------------------ //
+  // text handling
+
+  constexpr std::string_view whitespaces = " \t\r\n\v\f";
+
+  constexpr std::uint64_t hash(std::string_view text) {
+    std::uint64_t reVal = 0xcbf29ce484222325ull;
+    for (char c : text) {reVal = (reVal ^ static_cast<unsigned char>(c)) * 0x100000001b3ull;}
+    return reVal;
+  }
+  // ........................................................................ //
+  inline void trimLeft (std::string & text) {text.erase(0, text.find_first_not_of(whitespaces));}
+  inline void trimRight(std::string & text) {
+    auto last = text.find_last_not_of(whitespaces);
+    text.erase(last == std::string::npos ? 0 : last + 1);
+  }
+  inline void trim     (std::string & text) {trimRight(text); trimLeft(text);}
+  inline void uppercase(std::string & text) {for (auto & c : text) {c = std::toupper( static_cast<unsigned char>(c) );}}
+  // ........................................................................ //
+  inline std::string_view trimmed(std::string_view text) {
+    auto first = text.find_first_not_of(whitespaces);
+    if (first == std::string_view::npos) {return std::string_view();}
+    return text.substr(first, text.find_last_not_of(whitespaces) - first + 1);
+  }
+  // ........................................................................ //
+  inline void replaceAll(std::string & text, std::string_view substituee, std::string_view substitute) {
+    if ( substituee.empty() ) {return;}
+    for (auto pos = text.find(substituee); pos != std::string::npos; pos = text.find(substituee, pos + substitute.size())) {
+      text.replace(pos, substituee.size(), substitute);
+    }
+  }
+
+  // ------------------------------------------------------------------------ //
+  // diagnostics
+
+  std::string message(std::string text, const Context & context, std::string_view defaultText, std::string_view typeName) {
+    replaceAll(text, "$F", context.filename);
+    replaceAll(text, "$L", context.lineOriginal);
+    replaceAll(text, "$#", std::to_string(context.linenumber));
+    replaceAll(text, "$K", context.keyword);
+    replaceAll(text, "$D", defaultText);
+    replaceAll(text, "$V", context.value);
+    replaceAll(text, "$T", typeName);
+    return text;
+  }
+  // ........................................................................ //
+  void warn(const Context & context, const std::string & text) {
+    if (context.warnings) {*context.warnings << "WARNING: " << text << std::endl;}
+  }
+
+  // ------------------------------------------------------------------------ //
+  // conversions
+
+  inline bool toString (std::string_view text, std::string & value) {value = text; return true;}
+  // ........................................................................ //
+  template<typename T>
+  inline bool toNumber (std::string_view text, T & value) {
+    text = trimmed(text);
+    if ( !text.empty() && text.front() == '+' ) {text.remove_prefix(1);}
+    auto [end, error] = std::from_chars(text.data(), text.data() + text.size(), value);
+    return error == std::errc() && end == text.data() + text.size() && !text.empty();
+  }
+  inline bool toInteger(std::string_view text, long long int & value) {return toNumber(text, value);}
+  inline bool toReal   (std::string_view text, double        & value) {return toNumber(text, value);}
+  // ........................................................................ //
+  inline bool toInt32  (std::string_view text, std::int32_t & value) {
+    long long int wide;
+    if ( !toNumber(text, wide) || wide != static_cast<std::int32_t>(wide) ) {return false;}
+    value = static_cast<std::int32_t>(wide);
+    return true;
+  }
+  inline bool toFloat32(std::string_view text, float & value) {
+    double wide;
+    if ( !toNumber(text, wide) ) {return false;}
+    value = static_cast<float>(wide);
+    return true;
+  }
+  // ........................................................................ //
+  inline bool toBoolean(std::string_view text, bool & value) {
+    constexpr std::string_view wordsTrue [] = {$TRUE};
+    constexpr std::string_view wordsFalse[] = {$FALSE};
+
+    std::string word(trimmed(text));
+    uppercase(word);
+    for (auto candidate : wordsTrue ) {if (word == candidate) {value = true ; return true;}}
+    for (auto candidate : wordsFalse) {if (word == candidate) {value = false; return true;}}
+    return false;
+  }
+  // ........................................................................ //
+  template<typename T, typename Converter>
+  bool toList(std::string_view text, char separator, std::vector<T> & list, Converter convert) {
+    bool reVal = true;
+    list.reserve( std::count(text.begin(), text.end(), separator) + 1 );
+
+    while (true) {
+      auto end = text.find(separator);
+      T element;
+      if ( convert(text.substr(0, end), element) ) {list.push_back(element);}
+      else                                         {reVal = false;}
+
+      if (end == std::string_view::npos) {break;}
+      text.remove_prefix(end + 1);
+    }
+
+    return reVal;
+  }
+)~~~";
+
+  // ........................................................................ //
+  std::string wordList(const std::vector<std::string> & words) {
+    std::string reVal;
+    for (auto word : words) {
+      BCG::to_uppercase(word);
+      if ( !reVal.empty() ) {reVal += ", ";}
+      reVal += stringLiteral(word);
+    }
+    return reVal;
+  }
+}
+
+// ========================================================================== //
+// private functions
+
+void CodeGenerator::makeKeywords() {
+  std::map<std::string, std::string> members;
+
+  keywords.clear();
+  for (const auto & descriptor : schema.getDescriptors()) {
+    Keyword keyword;
+    keyword.descriptor = &descriptor;
+    keyword.name       = descriptor.getQualifiedKey();
+    keyword.member     = memberName(keyword.name);
+    BCG::to_uppercase(keyword.name);                                             // keywords are matched ignoring case, like by a default Reader
+
+    const auto valueType   = descriptor.getValueTypeID();
+    const auto elementType = elementTypeOf(valueType);
+    cppType(valueType);                                                         // throws for unsupported types
+
+    if ( descriptor.getUserPreParser() ) {throw InvalidFunctionError(THROWTEXT("    user preparser of keyword '" + keyword.name + "' cannot be generated"));}
+
+    for (const auto & restriction : descriptor.getRestrictions()) {
+      if (restriction.getPreParseRestrictionType() == RestrictionType::Function ||
+          restriction.getAftParseRestrictionType() == RestrictionType::Function
+      ) {throw InvalidFunctionError(THROWTEXT("    user defined validation function of keyword '" + keyword.name + "' cannot be generated"));}
+
+      switch ( restriction.getAftParseRestrictionType() ) {
+        case RestrictionType::Range :
+          if (elementType == ValueTypeID::String || elementType == ValueTypeID::Boolean) {
+            throw RestrictionTypeError(THROWTEXT("    range restriction on keyword '" + keyword.name + "' of type " + valueTypeName(valueType)));
+          }
+          break;
+        case RestrictionType::AllowedList   :
+        case RestrictionType::ForbiddenList :
+          if (elementType == ValueTypeID::Boolean) {
+            throw RestrictionTypeError(THROWTEXT("    list restriction on keyword '" + keyword.name + "' of type " + valueTypeName(valueType)));
+          }
+          break;
+        default :
+          break;
+      }
+    }
+
+    auto [it, isNew] = members.try_emplace(keyword.member, keyword.name);
+    if ( !isNew ) {
+      throw InvalidDescriptorError(THROWTEXT("    keywords '" + it->second + "' and '" + keyword.name + "' both map to the member name '" + keyword.member + "'"));
+    }
+
+    keywords.push_back(std::move(keyword));
+  }
+}
+
+// ========================================================================== //
+// CTors
+
+CodeGenerator::CodeGenerator(const Schema & schema, const std::string & structName) :
+  schema    (schema    ),
+  structName(structName)
+{
+  if ( !isIdentifier(structName) ) {throw InvalidDescriptorError(THROWTEXT("    '" + structName + "' is not a valid struct name"));}
+  makeKeywords();
+}
+
+// ========================================================================== //
+// Getters
+
+const std::string & CodeGenerator::getStructName() const {return structName;}
+const std::string & CodeGenerator::getNamespace () const {return nameSpace ;}
+// .......................................................................... //
+std::vector<std::string> CodeGenerator::getMemberNames() const {
+  std::vector<std::string> reVal;
+  reVal.reserve(keywords.size());
+  for (const auto & keyword : keywords) {reVal.push_back(keyword.member);}
+  return reVal;
+}
+
+// ========================================================================== //
+// Setters
+
+void CodeGenerator::setNamespace(const std::string & newVal) {
+  if ( !newVal.empty() ) {
+    for (const auto & part : BCG::splitString(newVal, ':')) {
+      if ( !part.empty() && !isIdentifier(part) ) {throw InvalidDescriptorError(THROWTEXT("    '" + newVal + "' is not a valid namespace name"));}
+    }
+    if ( newVal.find(":::") != std::string::npos || newVal.front() == ':' || newVal.back() == ':' ) {
+      throw InvalidDescriptorError(THROWTEXT("    '" + newVal + "' is not a valid namespace name"));
+    }
+  }
+
+  nameSpace = newVal;
+}
+
+// ========================================================================== //
+// Generation
+
+std::string CodeGenerator::header() const {
+  std::ostringstream code;
+
+  auto guard = "PARROT_GENERATED_" + (nameSpace.empty() ? ""s : nameSpace + "_") + structName + "_HPP";
+  for (auto & c : guard) {c = std::isalnum(static_cast<unsigned char>(c)) ? std::toupper(static_cast<unsigned char>(c)) : '_';}
+
+  code << "/* Settings parser generated by Parrot::CodeGenerator -- do not edit.\n"
+       << " *\n"
+       << " */\n\n"
+       << "#ifndef " << guard << "\n"
+       << "#define " << guard << "\n\n"
+       << "// ========================================================================== //\n"
+       << "// dependencies\n\n"
+       << "// STL\n"
+       << "#include <cstdint>\n"
+       << "#include <iostream>\n"
+       << "#include <string>\n"
+       << "#include <vector>\n\n"
+       << "// ========================================================================== //\n\n";
+
+  if ( !nameSpace.empty() ) {code << "namespace " << nameSpace << " {\n\n";}
+
+  size_t typeWidth = 0, memberWidth = 0;
+  for (const auto & keyword : keywords) {
+    typeWidth   = std::max(typeWidth  , cppType( keyword.descriptor->getValueTypeID() ).size());
+    memberWidth = std::max(memberWidth, keyword.member.size());
+  }
+
+  code << "  /**\n"
+       << "   * @brief the " << keywords.size() << " keywords of the schema, initialized with their defaults\n"
+       << "   */\n"
+       << "  struct " << structName << " {\n";
+
+  for (const auto & keyword : keywords) {
+    const auto valueType = keyword.descriptor->getValueTypeID();
+    code << "    " << std::left << std::setw(typeWidth) << cppType(valueType) << " " << std::setw(memberWidth) << keyword.member
+         << " = " << valueLiteral(valueType, keyword.descriptor->getValue()) << ";"
+         << "  //!< " << keyword.name << (keyword.descriptor->isMandatory() ? " (mandatory)" : "") << "\n";
+  }
+
+  code << "\n"
+       << "    /**\n"
+       << "     * @brief reads \\c filename; warnings are written to \\c warnings unless it is \\c nullptr\n"
+       << "     *\n"
+       << "     * @throws std::runtime_error if the file cannot be opened, a mandatory keyword is missing\n"
+       << "     *    or a restriction with the policy \\c Exception is violated\n"
+       << "     */\n"
+       << "    static " << structName << " load (const std::string & filename, std::ostream * warnings = &std::cerr);\n"
+       << "    //! @overload reads from \\c stream; \\c filename is only used in messages\n"
+       << "    static " << structName << " parse(std::istream & stream, const std::string & filename = \"\", std::ostream * warnings = &std::cerr);\n"
+       << "  };\n";
+
+  if ( !nameSpace.empty() ) {code << "}\n";}
+
+  code << "\n"
+       << "// ========================================================================== //\n\n"
+       << "#endif\n";
+
+  return code.str();
+}
+// -------------------------------------------------------------------------- //
+std::string CodeGenerator::source(const std::string & headerName) const {
+  std::ostringstream code;
+  const auto qualifiedStruct = nameSpace.empty() ? structName : nameSpace + "::" + structName;
+
+  code << "// ========================================================================== //\n"
+       << "// Settings parser generated by Parrot::CodeGenerator -- do not edit.\n\n"
+       << "// ========================================================================== //\n"
+       << "// dependencies\n\n"
+       << "// STL\n"
+       << "#include <stdexcept>\n\n"
+       << "#include <algorithm>\n"
+       << "#include <cctype>\n"
+       << "#include <charconv>\n"
+       << "#include <fstream>\n"
+       << "#include <limits>\n"
+       << "#include <string_view>\n"
+       << "#include <system_error>\n\n"
+       << "// own\n"
+       << "#include " << stringLiteral(headerName) << "\n\n"
+       << "// ========================================================================== //\n"
+       << "// local helpers\n\n"
+       << "namespace {\n"
+       << "  using Settings_t = " << qualifiedStruct << ";\n";
+
+  auto runtime = runtimeCode;
+  BCG::replaceAll(runtime, "$TRUE" , wordList(defaultBooleanTextTrue ));
+  BCG::replaceAll(runtime, "$FALSE", wordList(defaultBooleanTextFalse));
+  code << runtime;
+
+  // ........................................................................ //
+  // keyword dispatch
+
+  std::map<std::uint64_t, std::vector<size_t>> buckets;
+  for (size_t i = 0u; i < keywords.size(); ++i) {buckets[ hashName(keywords[i].name) ].push_back(i);}
+
+  code << "\n"
+       << "  // ------------------------------------------------------------------------ //\n"
+       << "  // keyword dispatch\n\n"
+       << "  constexpr size_t keywordCount = " << keywords.size() << ";\n"
+       << "  constexpr size_t npos         = keywordCount;\n\n"
+       << "  size_t keywordID(std::string_view keyword) {\n"
+       << "    switch ( hash(keyword) ) {\n";
+  for (const auto & [hash, ids] : buckets) {
+    code << "      case 0x" << std::hex << std::setw(16) << std::setfill('0') << hash << std::dec << std::setfill(' ') << "ull:";
+    for (auto id : ids) {
+      code << (id == ids.front() ? " " : "\n" + std::string(29, ' '))
+           << "if (keyword == " << stringLiteral(keywords[id].name) << ") {return " << id << ";}";
+    }
+    code << " break;\n";
+  }
+  code << "      default: break;\n"
+       << "    }\n"
+       << "    return npos;\n"
+       << "  }\n";
+
+  // ........................................................................ //
+  // one reader per keyword
+
+  code << "\n"
+       << "  // ------------------------------------------------------------------------ //\n"
+       << "  // keyword readers\n";
+
+  for (const auto & keyword : keywords) {
+    const auto & descriptor  = *keyword.descriptor;
+    const auto   valueType   = descriptor.getValueTypeID();
+    const auto   elementType = elementTypeOf(valueType);
+    const auto   member      = "settings." + keyword.member;
+    const auto   defaultVal  = valueLiteral(valueType, descriptor.getValue());
+    const auto   context     = "context, " + stringLiteral( getAnyText(descriptor.getValue()) ) + ", " + stringLiteral( valueTypeName(valueType) );
+
+    code << "\n"
+         << "  void read_" << keyword.member << "(Settings_t & settings, Context & context) {  // " << keyword.name << "\n"
+         << "    auto & text = context.value;\n";
+
+    if ( descriptor.isTrimLeadingWhitespaces () ) {code << "    trimLeft (text);\n";}
+    if ( descriptor.isTrimTrailingWhitespaces() ) {code << "    trimRight(text);\n";}
+    if ( !descriptor.isCaseSensitive         () ) {code << "    uppercase(text);\n";}
+    for (const auto & [substituee, substitute] : descriptor.getSubstitutions()) {
+      code << "    replaceAll(text, " << stringLiteral(substituee) << ", " << stringLiteral(substitute) << ");\n";
+    }
+
+    // pre-parse restrictions: on the text
+
+    for (const auto & restriction : descriptor.getRestrictions()) {
+      const auto rType = restriction.getPreParseRestrictionType();
+      if (rType != RestrictionType::AllowedList && rType != RestrictionType::ForbiddenList) {continue;}
+
+      const std::any words = restriction.getPreParseValidationList();
+      code << "\n    if ( " << (rType == RestrictionType::AllowedList ? "!" : "") << membership("text", ValueTypeID::String, words) << " ) {\n";
+      writeViolation(code, restriction, context, member + " = " + defaultVal + "; return;");
+      code << "    }\n";
+    }
+
+    // conversion
+
+    code << "\n    " << cppType(valueType) << " value;\n";
+    if ( isList(valueType) ) {code << "    if ( !toList(text, " << charLiteral(descriptor.getListSeparator()) << ", value, " << converterName(valueType) << ") ) {\n";}
+    else                     {code << "    if ( !" << converterName(valueType) << "(text, value) ) {\n";}
+    code << "      warn(context, message(" << stringLiteral(conversionErrorText) << ", " << context << "));\n"
+         << "      " << member << " = " << defaultVal << ";\n"
+         << "      return;\n"
+         << "    }\n";
+
+    // after parse restrictions: on the value
+
+    for (const auto & restriction : descriptor.getRestrictions()) {
+      const auto rType  = restriction.getAftParseRestrictionType();
+      const auto revert = "value = " + defaultVal + ";";
+
+      std::string condition;
+      switch (rType) {
+        case RestrictionType::Range : {
+          const auto [min, max] = restriction.getAftParseRange();
+          condition = outOfRange(isList(valueType) ? "element" : "value", elementType, min, max);
+        } break;
+
+        case RestrictionType::AllowedList   :
+        case RestrictionType::ForbiddenList : {
+          condition = membership(isList(valueType) ? "element" : "value", elementType, restriction.getAftParseRestriction());
+          if (rType == RestrictionType::AllowedList) {condition = "!" + condition;}
+        } break;
+
+        default :
+          continue;
+      }
+      if ( condition.empty() ) {continue;}
+
+      if ( isList(valueType) ) {
+        code << "\n    if ( std::any_of(value.begin(), value.end(), [] (const auto & element) {return " << condition << ";}) ) {\n";
+      } else {
+        code << "\n    if ( " << condition << " ) {\n";
+      }
+      writeViolation(code, restriction, context, revert);
+      code << "    }\n";
+    }
+
+    code << "\n    " << member << " = std::move(value);\n"
+         << "  }\n";
+  }
+
+  // ........................................................................ //
+  // missing keywords
+
+  code << "\n"
+       << "  // ------------------------------------------------------------------------ //\n"
+       << "  // missing keywords\n\n"
+       << "  void readMissing(size_t id, Context & context) {\n"
+       << "    switch (id) {\n";
+  for (size_t i = 0u; i < keywords.size(); ++i) {
+    const auto & descriptor = *keywords[i].descriptor;
+    const auto   context    = "context, " + stringLiteral( getAnyText(descriptor.getValue()) ) + ", " + stringLiteral( valueTypeName(descriptor.getValueTypeID()) );
+
+    code << "      case " << i << ": context.keyword = " << stringLiteral(keywords[i].name) << "; ";
+    if ( descriptor.isMandatory() ) {code << "throw std::runtime_error(message(" << stringLiteral(missingMandatoryText   ) << ", " << context << "));\n";}
+    else                            {code << "warn(context, message("            << stringLiteral(missingNonMandatoryText) << ", " << context << ")); break;\n";}
+  }
+  code << "      default: break;\n"
+       << "    }\n"
+       << "  }\n"
+       << "}\n\n";
+
+  // ........................................................................ //
+  // struct members
+
+  code << "// ========================================================================== //\n"
+       << "// I/O\n\n"
+       << qualifiedStruct << " " << qualifiedStruct << "::load(const std::string & filename, std::ostream * warnings) {\n"
+       << "  std::ifstream hFile(filename);\n"
+       << "  if ( !hFile.is_open() ) {throw std::runtime_error(\"could not open file '\" + filename + \"'\");}\n"
+       << "  return parse(hFile, filename, warnings);\n"
+       << "}\n"
+       << "// .......................................................................... //\n"
+       << qualifiedStruct << " " << qualifiedStruct << "::parse(std::istream & stream, const std::string & filename, std::ostream * warnings) {\n"
+       << "  " << structName << " settings;\n"
+       << "  Context     context {filename, warnings};\n"
+       << "  bool        found[keywordCount + 1] = {};\n"
+       << "  std::string line, logical, section;\n"
+       << "\n"
+       << "  while ( std::getline(stream, line) ) {\n"
+       << "    ++context.linenumber;\n"
+       << "    context.lineOriginal += line;\n"
+       << "\n"
+       << "    trim(line);\n"
+       << "    if ( !line.empty() && line.back() == '\\\\' ) {\n"
+       << "      line.pop_back();\n"
+       << "      logical              += line;\n"
+       << "      context.lineOriginal += \"\\n\";\n"
+       << "      continue;\n"
+       << "    }\n"
+       << "    logical += line;\n"
+       << "\n"
+       << "    if        ( logical.empty() || logical.front() == '#' ) {\n"
+       << "    } else if ( logical.front() == '[' && logical.back() == ']' ) {\n"
+       << "      section = logical.substr(1, logical.size() - 2);\n"
+       << "      trim     (section);\n"
+       << "      uppercase(section);\n"
+       << "    } else if ( auto separator = logical.find('='); separator == std::string::npos ) {\n"
+       << "      warn(context, message(" << stringLiteral(malformedLineText) << ", context, \"\", \"\"));\n"
+       << "    } else {\n"
+       << "      context.keyword = logical.substr(0, separator);\n"
+       << "      context.value   = logical.substr(separator + 1);\n"
+       << "      trim     (context.keyword);\n"
+       << "      uppercase(context.keyword);\n"
+       << "      if ( !section.empty() ) {context.keyword = section + \".\" + context.keyword;}\n"
+       << "\n"
+       << "      const auto id = keywordID(context.keyword);\n"
+       << "      if ( id == npos ) {warn(context, message(" << stringLiteral(unexpectedKeywordText) << ", context, \"\", \"\"));}\n"
+       << "      else {\n"
+       << "        if ( found[id] ) {warn(context, message(" << stringLiteral(duplicateKeywordText) << ", context, \"\", \"\"));}\n"
+       << "        found[id] = true;\n"
+       << "\n"
+       << "        switch (id) {\n";
+  for (size_t i = 0u; i < keywords.size(); ++i) {
+    code << "          case " << i << ": read_" << keywords[i].member << "(settings, context); break;\n";
+  }
+  code << "          default: break;\n"
+       << "        }\n"
+       << "      }\n"
+       << "    }\n"
+       << "\n"
+       << "    context.lineOriginal.clear();\n"
+       << "    logical             .clear();\n"
+       << "  }\n"
+       << "\n"
+       << "  context.linenumber = 0;\n"
+       << "  context.lineOriginal.clear();\n"
+       << "  context.value       .clear();\n"
+       << "  for (size_t id = 0u; id < keywordCount; ++id) {\n"
+       << "    if ( !found[id] ) {readMissing(id, context);}\n"
+       << "  }\n"
+       << "\n"
+       << "  return settings;\n"
+       << "}\n";
+
+  return code.str();
+}
+// -------------------------------------------------------------------------- //
+void CodeGenerator::write(const std::string & basename) const {
+  const auto headerFile = basename + ".hpp";
+  const auto sourceFile = basename + ".cpp";
+  const auto headerName = headerFile.substr( headerFile.find_last_of("/\\") == std::string::npos ? 0 : headerFile.find_last_of("/\\") + 1 );
+
+  for (const auto & [filename, text] : {std::pair(headerFile, header()), std::pair(sourceFile, source(headerName))}) {
+    std::ofstream hFile(filename);
+    if ( !hFile ) {throw std::runtime_error(THROWTEXT("    could not open '" + filename + "' for writing"));}
+    hFile << text;
+    if ( !hFile ) {throw std::runtime_error(THROWTEXT("    could not write '" + filename + "'"));}
+  }
+}
@@ -12,6 +12,7 @@ using namespace std::string_literals;
 // own
 #include "BCG.hpp"
 #include "Parrot/Definitions.hpp"
+#include "Parrot/AlignedAllocator.hpp"
 using namespace Parrot;
 
 // ========================================================================== //
@@ -31,6 +32,14 @@ const std::string Parrot::TypeIDString_StringList  = BCG::getTypeIDName( PARROT_
 const std::string Parrot::TypeIDString_IntegerList = BCG::getTypeIDName( PARROT_TYPE(Parrot::ValueTypeID::IntegerList)() );
 const std::string Parrot::TypeIDString_RealList    = BCG::getTypeIDName( PARROT_TYPE(Parrot::ValueTypeID::RealList   )() );
 const std::string Parrot::TypeIDString_BooleanList = BCG::getTypeIDName( PARROT_TYPE(Parrot::ValueTypeID::BooleanList)() );
+const std::string Parrot::TypeIDString_RealRange   = BCG::getTypeIDName( PARROT_TYPE(Parrot::ValueTypeID::RealRange  )() );
+
+const std::string Parrot::TypeIDString_Int32       = BCG::getTypeIDName( PARROT_TYPE(Parrot::ValueTypeID::Int32      )() );
+const std::string Parrot::TypeIDString_Float32     = BCG::getTypeIDName( PARROT_TYPE(Parrot::ValueTypeID::Float32    )() );
+const std::string Parrot::TypeIDString_Complex     = BCG::getTypeIDName( PARROT_TYPE(Parrot::ValueTypeID::Complex    )() );
+const std::string Parrot::TypeIDString_Int32List   = BCG::getTypeIDName( PARROT_TYPE(Parrot::ValueTypeID::Int32List  )() );
+const std::string Parrot::TypeIDString_Float32List = BCG::getTypeIDName( PARROT_TYPE(Parrot::ValueTypeID::Float32List)() );
+const std::string Parrot::TypeIDString_ComplexList = BCG::getTypeIDName( PARROT_TYPE(Parrot::ValueTypeID::ComplexList)() );
 // -------------------------------------------------------------------------- //
 std::vector<std::string> Parrot::defaultBooleanTextTrue  = {"TRUE", "YES", "ON"};
 std::vector<std::string> Parrot::defaultBooleanTextFalse = {"FALSE", "NO", "OFF"};
@@ -46,6 +55,13 @@ const std::string Parrot::valueTypeName(const ValueTypeID & T) {
     case ValueTypeID::IntegerList : return "list of integers";
     case ValueTypeID::RealList    : return "list of real values";
     case ValueTypeID::BooleanList : return "list of booleans";
+    case ValueTypeID::RealRange   : return "range of real values";
+    case ValueTypeID::Int32       : return "32 bit integer";
+    case ValueTypeID::Float32     : return "single precision real value";
+    case ValueTypeID::Complex     : return "complex value";
+    case ValueTypeID::Int32List   : return "list of 32 bit integers";
+    case ValueTypeID::Float32List : return "list of single precision real values";
+    case ValueTypeID::ComplexList : return "list of complex values";
     default                       : return "(invalid state)";
   }
 }
@@ -77,10 +93,15 @@ bool Parrot::isTypeCompatibleWithValidityList(const ValueTypeID & valType, const
     listType != ValueTypeID::RealList
   ) {return false;}
 
-  if (valType == listType)                                                     {return true;}
-  if (valType == ValueTypeID::String  && listType == ValueTypeID::StringList ) {return true;}
-  if (valType == ValueTypeID::Integer && listType == ValueTypeID::IntegerList) {return true;}
-  if (valType == ValueTypeID::Real    && listType == ValueTypeID::RealList   ) {return true;}
+  if (valType == listType)                                                         {return true;}
+  if (valType == ValueTypeID::String      && listType == ValueTypeID::StringList ) {return true;}
+  if (valType == ValueTypeID::Integer     && listType == ValueTypeID::IntegerList) {return true;}
+  if (valType == ValueTypeID::Real        && listType == ValueTypeID::RealList   ) {return true;}
+  if (valType == ValueTypeID::RealRange   && listType == ValueTypeID::RealList   ) {return true;}
+  if (valType == ValueTypeID::Int32       && listType == ValueTypeID::IntegerList) {return true;}
+  if (valType == ValueTypeID::Int32List   && listType == ValueTypeID::IntegerList) {return true;}
+  if (valType == ValueTypeID::Float32     && listType == ValueTypeID::RealList   ) {return true;}
+  if (valType == ValueTypeID::Float32List && listType == ValueTypeID::RealList   ) {return true;}
 
   return false;
 }
@@ -89,9 +110,9 @@ const std::string Parrot::restrictionValueTypeIDName (const RestrictionValueType
   switch (T) {
     case RestrictionValueTypeID::None        : return "no type restriction";
     case RestrictionValueTypeID::String      : return "only compatible with Strings and StringLists";
-    case RestrictionValueTypeID::Integer     : return "only compatible with Integers and IntegerLists";
-    case RestrictionValueTypeID::Real        : return "only compatible with Reals and RealLists";
-    case RestrictionValueTypeID::Numeric     : return "only compatible with Integers, Reals, IntegerLists and RealLists";
+    case RestrictionValueTypeID::Integer     : return "only compatible with Integers and IntegerLists of any width";
+    case RestrictionValueTypeID::Real        : return "only compatible with Reals and RealLists of any precision, and RealRanges";
+    case RestrictionValueTypeID::Numeric     : return "only compatible with Integers, Reals, their Lists and RealRanges";
     case RestrictionValueTypeID::Boolean     : return "only compatible with Booleans and BooleanLists";
     case RestrictionValueTypeID::StringList  : return "only compatible with StringLists";
     case RestrictionValueTypeID::IntegerList : return "only compatible with IntegerLists";
@@ -111,6 +132,20 @@ const std::string Parrot::parsingErrorPolicyName (const ParsingErrorPolicy & T)
   }
 }
 
+// ========================================================================== //
+// local helpers
+
+template<typename T>
+std::vector<T> unalignedList(const std::any & x) {                              // accepts both storage forms of numeric lists
+  if (auto aligned = std::any_cast<AlignedVector<T>>(&x)) {return std::vector<T>(aligned->begin(), aligned->end());}
+  return std::any_cast<std::vector<T>>(x);
+}
+// .......................................................................... //
+std::string complexText(const PARROT_TYPE(ValueTypeID::Complex) & z) {         // the form read by Parrot::Reader, e.g. 1-2i
+  auto imag = std::to_string(z.imag());
+  return std::to_string(z.real()) + (imag[0] == '-' ? "" : "+") + imag + "i";
+}
+
 // ========================================================================== //
 // type interpreters
 
@@ -122,13 +157,24 @@ const std::string Parrot::getAnyText(const std::any & x, const ValueTypeID & T)
     case ValueTypeID::Real        : return std::to_string       (std::any_cast<PARROT_TYPE(ValueTypeID::Real       )>(x));
     case ValueTypeID::Boolean     : return                      (std::any_cast<PARROT_TYPE(ValueTypeID::Boolean    )>(x)) ? "true" : "false";
     case ValueTypeID::StringList  : return BCG::vector_to_string(std::any_cast<PARROT_TYPE(ValueTypeID::StringList )>(x));
-    case ValueTypeID::IntegerList : return BCG::vector_to_string(std::any_cast<PARROT_TYPE(ValueTypeID::IntegerList)>(x));
-    case ValueTypeID::RealList    : return BCG::vector_to_string(std::any_cast<PARROT_TYPE(ValueTypeID::RealList   )>(x));
+    case ValueTypeID::IntegerList : return BCG::vector_to_string(unalignedList<PARROT_TYPE(ValueTypeID::Integer)>(x));
+    case ValueTypeID::RealList    : return BCG::vector_to_string(unalignedList<PARROT_TYPE(ValueTypeID::Real   )>(x));
     case ValueTypeID::BooleanList : {
       std::string reVal;
       for (auto bit : std::any_cast<PARROT_TYPE(ValueTypeID::BooleanList)>(x)) {reVal += (bit ? "1" : "o");}
       return reVal;
     }
+    case ValueTypeID::RealRange   : return std::any_cast<const PARROT_TYPE(ValueTypeID::RealRange) &>(x).to_string();
+    case ValueTypeID::Int32       : return std::to_string       (std::any_cast<PARROT_TYPE(ValueTypeID::Int32      )>(x));
+    case ValueTypeID::Float32     : return std::to_string       (std::any_cast<PARROT_TYPE(ValueTypeID::Float32    )>(x));
+    case ValueTypeID::Complex     : return complexText          (std::any_cast<PARROT_TYPE(ValueTypeID::Complex    )>(x));
+    case ValueTypeID::Int32List   : return BCG::vector_to_string(unalignedList<PARROT_TYPE(ValueTypeID::Int32  )>(x));
+    case ValueTypeID::Float32List : return BCG::vector_to_string(unalignedList<PARROT_TYPE(ValueTypeID::Float32)>(x));
+    case ValueTypeID::ComplexList : {
+      std::string reVal;
+      for (const auto & z : unalignedList<PARROT_TYPE(ValueTypeID::Complex)>(x)) {reVal += reVal.empty() ? '[' : ','; reVal += complexText(z);}
+      return reVal.empty() ? "[]" : reVal + "]";
+    }
 
     default                     : return "(invalid type): ";
   }
@@ -144,7 +190,8 @@ const std::string Parrot::getAnyText(const std::any & x) {
   else if ( x.type().name() == TypeIDString_IntegerList ) {return getAnyText(x, ValueTypeID::IntegerList);}
   else if ( x.type().name() == TypeIDString_RealList    ) {return getAnyText(x, ValueTypeID::RealList   );}
   else if ( x.type().name() == TypeIDString_BooleanList ) {return getAnyText(x, ValueTypeID::BooleanList);}
-  else {throw Parrot::ValueTypeError(THROWTEXT("    type not supported"));}
+  else if ( x.type().name() == TypeIDString_RealRange   ) {return getAnyText(x, ValueTypeID::RealRange  );}
+  else                                                    {return getAnyText(x, getAnyValueType(x)     );}
 
 }
 // .......................................................................... //
@@ -158,5 +205,17 @@ ValueTypeID Parrot::getAnyValueType(const std::any & x) {
   else if ( x.type().name() == TypeIDString_IntegerList ) {return ValueTypeID::IntegerList;}
   else if ( x.type().name() == TypeIDString_RealList    ) {return ValueTypeID::RealList   ;}
   else if ( x.type().name() == TypeIDString_BooleanList ) {return ValueTypeID::BooleanList;}
+  else if ( x.type().name() == TypeIDString_RealRange   ) {return ValueTypeID::RealRange  ;}
+  else if ( x.type().name() == TypeIDString_Int32       ) {return ValueTypeID::Int32      ;}
+  else if ( x.type().name() == TypeIDString_Float32     ) {return ValueTypeID::Float32    ;}
+  else if ( x.type().name() == TypeIDString_Complex     ) {return ValueTypeID::Complex    ;}
+  else if ( x.type().name() == TypeIDString_Int32List   ) {return ValueTypeID::Int32List  ;}
+  else if ( x.type().name() == TypeIDString_Float32List ) {return ValueTypeID::Float32List;}
+  else if ( x.type().name() == TypeIDString_ComplexList ) {return ValueTypeID::ComplexList;}
+  else if ( x.type() == typeid(AlignedVector<PARROT_TYPE(ValueTypeID::Integer)>) ) {return ValueTypeID::IntegerList;}
+  else if ( x.type() == typeid(AlignedVector<PARROT_TYPE(ValueTypeID::Real   )>) ) {return ValueTypeID::RealList   ;}
+  else if ( x.type() == typeid(AlignedVector<PARROT_TYPE(ValueTypeID::Int32  )>) ) {return ValueTypeID::Int32List  ;}
+  else if ( x.type() == typeid(AlignedVector<PARROT_TYPE(ValueTypeID::Float32)>) ) {return ValueTypeID::Float32List;}
+  else if ( x.type() == typeid(AlignedVector<PARROT_TYPE(ValueTypeID::Complex)>) ) {return ValueTypeID::ComplexList;}
   else {throw Parrot::ValueTypeError(THROWTEXT("    type not supported"));}
 }
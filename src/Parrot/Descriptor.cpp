@@ -9,10 +9,9 @@
 #include <string>
 using namespace std::string_literals;
 
-#include <algorithm>
-
 // own
 #include "BCG.hpp"
+#include "Parrot/AlignedAllocator.hpp"
 #include "Parrot/Definitions.hpp"
 #include "Parrot/Descriptor.hpp"
 
@@ -24,201 +23,31 @@ using namespace Parrot;
 #define THROWTEXT(msg) ("RUNTIME EXCEPTION IN "s + (__PRETTY_FUNCTION__) + "\n"s + msg)
 
 // ========================================================================== //
-// Rectifyers
-
-void Descriptor::rectify() {
-  switch (valueTypeID) {
-    case ValueTypeID::None        :                        break;
-    case ValueTypeID::String      : rectify_String     (); break;
-    case ValueTypeID::Integer     : rectify_Integer    (); break;
-    case ValueTypeID::Real        : rectify_Real       (); break;
-    case ValueTypeID::Boolean     : rectify_Boolean    (); break;
-    case ValueTypeID::StringList  : rectify_StringList (); break;
-    case ValueTypeID::IntegerList : rectify_IntegerList(); break;
-    case ValueTypeID::RealList    : rectify_RealList   (); break;
-    case ValueTypeID::BooleanList : rectify_BooleanList(); break;
-   }
-}
-// -------------------------------------------------------------------------- //
-void Descriptor::rectify_String     () {
-  try                                 {value =              std::any_cast<std::string >(value)  ;}
-  catch (const std::bad_any_cast & e) {value = std::string( std::any_cast<const char *>(value) );}
-}
-// .......................................................................... //
-void Descriptor::rectify_Integer    () {
-  PARROT_TYPE(ValueTypeID::Integer) newVal;
-
-  auto type = BCG::demangle( value.type().name() );
-
-  if      (type == "char"              ) {newVal = std::any_cast<char              >(value);}
-  else if (type == "short"             ) {newVal = std::any_cast<short             >(value);}
-  else if (type == "int"               ) {newVal = std::any_cast<int               >(value);}
-  else if (type == "long"              ) {newVal = std::any_cast<long              >(value);}
-  else if (type == "long long"         ) {newVal = std::any_cast<long long         >(value);}
+// local helpers
 
-  else if (type == "unsigned char"     ) {newVal = std::any_cast<unsigned char     >(value);}
-  else if (type == "unsigned short"    ) {newVal = std::any_cast<unsigned short    >(value);}
-  else if (type == "unsigned int"      ) {newVal = std::any_cast<unsigned int      >(value);}
-  else if (type == "unsigned long"     ) {newVal = std::any_cast<unsigned long     >(value);}
-  else if (type == "unsigned long long") {newVal = std::any_cast<unsigned long long>(value);}
-
-  else                                   {newVal = 0;}
-
-  value = newVal;
+template<typename T>
+void unalign(std::any & value) {
+  if (auto aligned = std::any_cast<AlignedVector<T>>(&value)) {value = std::vector<T>(aligned->begin(), aligned->end());}
 }
-// .......................................................................... //
-void Descriptor::rectify_Real       () {
-  PARROT_TYPE(ValueTypeID::Real) newVal;
-
-  auto type = BCG::demangle( value.type().name() );
-
-  if      (type == "float"      ) {newVal = std::any_cast<float      >(value);}
-  else if (type == "double"     ) {newVal = std::any_cast<double     >(value);}
-  else if (type == "long double") {newVal = std::any_cast<long double>(value);}
-  else                            {newVal = 0.;}
-
-  value = newVal;
-}
-// .......................................................................... //
-void Descriptor::rectify_Boolean    () {value = std::any_cast<bool>(value);}
-// .......................................................................... //
-void Descriptor::rectify_StringList () {
-  try {value = std::any_cast< std::vector<std::string> >(value);}
-  catch (const std::bad_any_cast & e) {
-    const auto & old = std::any_cast< std::vector<char const *> >(value);
-    value = std::vector<std::string>(old.begin(), old.end());
-  }
-}
-// .......................................................................... //
-void Descriptor::rectify_IntegerList() {
-  PARROT_TYPE(ValueTypeID::IntegerList) newVal;
-
-  auto type = BCG::demangle( value.type().name() );
-
-  if        (type == "std::vector<char, std::allocator<char> >"                            ) {
-    auto src = std::any_cast< std::vector<char> >(value);
-    newVal.reserve(src.size());
-    std::transform(src.begin(), src.end(),
-                   std::back_inserter(newVal),
-                   [] (auto & v) {return PARROT_TYPE(ValueTypeID::Integer)(v);}
-                   );
-
-  } else if (type == "std::vector<short, std::allocator<short> >"                          ) {
-    auto src = std::any_cast< std::vector<short> >(value);
-    newVal.reserve(src.size());
-    std::transform(src.begin(), src.end(),
-                   std::back_inserter(newVal),
-                   [] (auto & v) {return PARROT_TYPE(ValueTypeID::Integer)(v);}
-                   );
-
-  } else if (type == "std::vector<int, std::allocator<int> >"                              ) {
-    auto src = std::any_cast< std::vector<int> >(value);
-    newVal.reserve(src.size());
-    std::transform(src.begin(), src.end(),
-                   std::back_inserter(newVal),
-                   [] (auto & v) {return PARROT_TYPE(ValueTypeID::Integer)(v);}
-                   );
-
-  } else if (type == "std::vector<long, std::allocator<long> >"                            ) {
-    auto src = std::any_cast< std::vector<long> >(value);
-    newVal.reserve(src.size());
-    std::transform(src.begin(), src.end(),
-                   std::back_inserter(newVal),
-                   [] (auto & v) {return PARROT_TYPE(ValueTypeID::Integer)(v);}
-                   );
-
-  } else if (type == "std::vector<long long, std::allocator<long long> >"                  ) {
-    auto src = std::any_cast< std::vector<long long> >(value);
-    newVal.reserve(src.size());
-    std::transform(src.begin(), src.end(),
-                   std::back_inserter(newVal),
-                   [] (auto & v) {return PARROT_TYPE(ValueTypeID::Integer)(v);}
-                   );
-
-  } else if (type == "std::vector<unsigned char, std::allocator<unsigned char> >"          ) {
-    auto src = std::any_cast< std::vector<unsigned char> >(value);
-    newVal.reserve(src.size());
-    std::transform(src.begin(), src.end(),
-                   std::back_inserter(newVal),
-                   [] (auto & v) {return PARROT_TYPE(ValueTypeID::Integer)(v);}
-                   );
-
-  } else if (type == "std::vector<unsigned short, std::allocator<unsigned short> >"        ) {
-    auto src = std::any_cast< std::vector<unsigned short> >(value);
-    newVal.reserve(src.size());
-    std::transform(src.begin(), src.end(),
-                   std::back_inserter(newVal),
-                   [] (auto & v) {return PARROT_TYPE(ValueTypeID::Integer)(v);}
-                   );
-
-  } else if (type == "std::vector<unsigned int, std::allocator<unsigned int> >"            ) {
-    auto src = std::any_cast< std::vector<unsigned int> >(value);
-    newVal.reserve(src.size());
-    std::transform(src.begin(), src.end(),
-                   std::back_inserter(newVal),
-                   [] (auto & v) {return PARROT_TYPE(ValueTypeID::Integer)(v);}
-                   );
-
-  } else if (type == "std::vector<unsigned long, std::allocator<unsigned long> >"          ) {
-    auto src = std::any_cast< std::vector<unsigned long> >(value);
-    newVal.reserve(src.size());
-    std::transform(src.begin(), src.end(),
-                   std::back_inserter(newVal),
-                   [] (auto & v) {return PARROT_TYPE(ValueTypeID::Integer)(v);}
-                   );
-
-  } else if (type == "std::vector<unsigned long long, std::allocator<unsigned long long> >") {
-    auto src = std::any_cast< std::vector<unsigned long long> >(value);
-    newVal.reserve(src.size());
-    std::transform(src.begin(), src.end(),
-                   std::back_inserter(newVal),
-                   [] (auto & v) {return PARROT_TYPE(ValueTypeID::Integer)(v);}
-                   );
-
-  }
 
-  // no else clause -- default CTor automatically makes empty list.
+// ========================================================================== //
+// Rectifyers
 
-  value = newVal;
-}
-// .......................................................................... //
-void Descriptor::rectify_RealList   () {
-  PARROT_TYPE(ValueTypeID::RealList) newVal;
-
-  auto type = BCG::demangle( value.type().name() );
-
-  if        (type == "std::vector<float, std::allocator<float> >"            ) {
-    auto src = std::any_cast< std::vector<char> >(value);
-    newVal.reserve(src.size());
-    std::transform(src.begin(), src.end(),
-                   std::back_inserter(newVal),
-                   [] (auto & v) {return PARROT_TYPE(ValueTypeID::Real)(v);}
-                   );
-
-  } else if (type == "std::vector<double, std::allocator<double> >"          ) {
-    auto src = std::any_cast< std::vector<double> >(value);
-    newVal.reserve(src.size());
-    std::transform(src.begin(), src.end(),
-                   std::back_inserter(newVal),
-                   [] (auto & v) {return PARROT_TYPE(ValueTypeID::Real)(v);}
-                   );
-
-  } else if (type == "std::vector<long double, std::allocator<long double> >") {
-    auto src = std::any_cast< std::vector<long double> >(value);
-    newVal.reserve(src.size());
-    std::transform(src.begin(), src.end(),
-                   std::back_inserter(newVal),
-                   [] (auto & v) {return PARROT_TYPE(ValueTypeID::Real)(v);}
-                   );
+void Descriptor::rectify() {
+  /* setValue converts to the Parrot types at compile time, and
+   * getAnyValueType() only accepts the Parrot types themselves, so all that is
+   * left to do here is storing aligned lists like their plain counterparts.
+   */
 
+  switch (valueTypeID) {
+    case ValueTypeID::IntegerList : unalign<PARROT_TYPE(ValueTypeID::Integer)>(value); break;
+    case ValueTypeID::RealList    : unalign<PARROT_TYPE(ValueTypeID::Real   )>(value); break;
+    case ValueTypeID::Int32List   : unalign<PARROT_TYPE(ValueTypeID::Int32  )>(value); break;
+    case ValueTypeID::Float32List : unalign<PARROT_TYPE(ValueTypeID::Float32)>(value); break;
+    case ValueTypeID::ComplexList : unalign<PARROT_TYPE(ValueTypeID::Complex)>(value); break;
+    default                       :                                                   break;
   }
-
-  // no else clause -- default CTor automatically makes empty list.
-
-  value = newVal;
 }
-// .......................................................................... //
-void Descriptor::rectify_BooleanList() {value = std::any_cast< std::vector<bool> >(value);}
 
 // ========================================================================== //
 // CTor, DTor
@@ -239,6 +68,8 @@ Descriptor::Descriptor(
 // Getters
 
 const std::string Descriptor::getKey            () const {return key;}
+const std::string Descriptor::getSection        () const {return section;}
+const std::string Descriptor::getQualifiedKey   () const {return section.empty() ? key : section + "." + key;}
 // .......................................................................... //
 std::any          Descriptor::getValue          () const {return value;}
 // .......................................................................... //
@@ -273,7 +104,10 @@ void Descriptor::reset () {
   resetParsing ();
 }
 // .......................................................................... //
-void Descriptor::resetKey     () {key = "";}
+void Descriptor::resetKey     () {
+  key     = "";
+  section = "";
+}
 // .......................................................................... //
 void Descriptor::resetValue   () {
   value.reset();
@@ -301,6 +135,11 @@ void Descriptor::setKey (const std::string & newVal) {
     key = newVal;
     BCG::trim(key);
 }
+// .......................................................................... //
+void Descriptor::setSection (const std::string & newVal) {
+    section = newVal;
+    BCG::trim(section);
+}
 // -------------------------------------------------------------------------- //
 void Descriptor::setValueAny (std::any    newVal, bool resetMetaData) {
   valueTypeID = getAnyValueType(newVal);
@@ -352,14 +191,19 @@ void Descriptor::addRestriction (const Restriction & restriction) {
     case RestrictionValueTypeID::Integer     :
       if (
         valueTypeID != ValueTypeID::Integer     &&
-        valueTypeID != ValueTypeID::IntegerList
+        valueTypeID != ValueTypeID::IntegerList &&
+        valueTypeID != ValueTypeID::Int32       &&
+        valueTypeID != ValueTypeID::Int32List
       ) {throw Parrot::RestrictionTypeError(THROWTEXT("    Restriction incompatible with value type"));}
       break;
 
     case RestrictionValueTypeID::Real        :
       if (
-        valueTypeID != ValueTypeID::Real     &&
-        valueTypeID != ValueTypeID::RealList
+        valueTypeID != ValueTypeID::Real        &&
+        valueTypeID != ValueTypeID::RealList    &&
+        valueTypeID != ValueTypeID::RealRange   &&
+        valueTypeID != ValueTypeID::Float32     &&
+        valueTypeID != ValueTypeID::Float32List
       ) {throw Parrot::RestrictionTypeError(THROWTEXT("    Restriction incompatible with value type"));}
       break;
 
@@ -368,7 +212,12 @@ void Descriptor::addRestriction (const Restriction & restriction) {
         valueTypeID != ValueTypeID::Integer     &&
         valueTypeID != ValueTypeID::IntegerList &&
         valueTypeID != ValueTypeID::Real        &&
-        valueTypeID != ValueTypeID::RealList
+        valueTypeID != ValueTypeID::RealList    &&
+        valueTypeID != ValueTypeID::RealRange   &&
+        valueTypeID != ValueTypeID::Int32       &&
+        valueTypeID != ValueTypeID::Int32List   &&
+        valueTypeID != ValueTypeID::Float32     &&
+        valueTypeID != ValueTypeID::Float32List
       ) {throw Parrot::RestrictionTypeError(THROWTEXT("    Restriction incompatible with value type"));}
       break;
 
@@ -384,11 +233,17 @@ void Descriptor::addRestriction (const Restriction & restriction) {
       break;
 
     case RestrictionValueTypeID::IntegerList :
-      if (valueTypeID != ValueTypeID::IntegerList) {throw Parrot::RestrictionTypeError(THROWTEXT("    Restriction incompatible with value type"));}
+      if (
+        valueTypeID != ValueTypeID::IntegerList &&
+        valueTypeID != ValueTypeID::Int32List
+      ) {throw Parrot::RestrictionTypeError(THROWTEXT("    Restriction incompatible with value type"));}
       break;
 
     case RestrictionValueTypeID::RealList    :
-      if (valueTypeID != ValueTypeID::RealList   ) {throw Parrot::RestrictionTypeError(THROWTEXT("    Restriction incompatible with value type"));}
+      if (
+        valueTypeID != ValueTypeID::RealList    &&
+        valueTypeID != ValueTypeID::Float32List
+      ) {throw Parrot::RestrictionTypeError(THROWTEXT("    Restriction incompatible with value type"));}
       break;
 
     case RestrictionValueTypeID::BooleanList :
@@ -396,6 +251,16 @@ void Descriptor::addRestriction (const Restriction & restriction) {
       break;
   }
 
+  // user defined functions are bound to exactly one value type
+  if (
+    restriction.getAftParseRestrictionType() == RestrictionType::Function &&
+    restriction.getAftParseValidator().getValueTypeID() != valueTypeID
+  ) {
+    throw Parrot::RestrictionTypeError(THROWTEXT(
+      "    Type "s + valueTypeName(valueTypeID) + " not compatible with validation function for " + valueTypeName(restriction.getAftParseValidator().getValueTypeID())
+    ));
+  }
+
   // actually do the trick
   restrictions.push_back(restriction);
 }
@@ -490,6 +355,7 @@ std::string Descriptor::to_string() const {
   reVal << "Descriptor";
   if ( key.empty() )  {reVal << " (uninitialized keyword)\n";}
   else                {reVal << " for keyowrd '" << key << "'\n";}
+  if ( !section.empty() ) {reVal << "  Section                  : " << section << "\n";}
 
   reVal << "  Datatype                 : " << valueTypeName(valueTypeID) << "\n";
   reVal << "  Default value            : " << (value.has_value() ? getAnyText(value) : "(### none ###)")  << "\n";
@@ -0,0 +1,166 @@
+// ========================================================================== //
+// dependencies
+
+// STL
+#include <iostream>
+#include <iterator>
+
+#include <string>
+using namespace std::string_literals;
+
+// own
+#include "BCG.hpp"
+#include "Parrot/Diagnostics.hpp"
+
+using namespace Parrot;
+
+// ========================================================================== //
+// lookups
+
+const std::string Parrot::diagnosticKindName(const DiagnosticKind & T) {
+  switch (T) {
+    case DiagnosticKind::MissingKeyword       : return "missing keyword";
+    case DiagnosticKind::UnexpectedKeyword    : return "unexpected keyword";
+    case DiagnosticKind::DuplicateKeyword     : return "duplicate keyword";
+    case DiagnosticKind::ConversionError      : return "conversion error";
+    case DiagnosticKind::RestrictionViolation : return "restriction violation";
+    case DiagnosticKind::MalformedLine        : return "malformed line";
+    case DiagnosticKind::InconsistentState    : return "inconsistent state";
+    case DiagnosticKind::FileAccess           : return "file access";
+    case DiagnosticKind::IncludeCycle         : return "include cycle";
+    case DiagnosticKind::Summary              : return "summary";
+    default                                   : return "(invalid state)";
+  }
+}
+
+// ========================================================================== //
+// StderrDiagnosticSink
+
+void StderrDiagnosticSink::write(const DiagnosticRecord & record) {
+  std::lock_guard<std::mutex> lock(mtx);
+
+  if (record.kind == DiagnosticKind::Summary) {std::cout << '\n' << record.message << "\n\n";}
+  else                                        {BCG::writeWarning(record.message);}
+}
+
+// ========================================================================== //
+// BufferedDiagnosticSink
+
+BufferedDiagnosticSink::BufferedDiagnosticSink(std::shared_ptr<DiagnosticSink> target) : target(target) {}
+// -------------------------------------------------------------------------- //
+void BufferedDiagnosticSink::write      (const DiagnosticRecord & record) {
+  std::lock_guard<std::mutex> lock(mtx);
+
+  auto it = open.find(std::this_thread::get_id());
+  if (it != open.end()) {it->second.records.push_back(record);}
+  else                  {records          .push_back(record);}
+}
+// .......................................................................... //
+void BufferedDiagnosticSink::beginParse (const std::string &) {
+  std::lock_guard<std::mutex> lock(mtx);
+  ++open[std::this_thread::get_id()].depth;
+}
+// .......................................................................... //
+void BufferedDiagnosticSink::endParse   () {
+  std::vector<DiagnosticRecord> pending;
+  {
+    std::lock_guard<std::mutex> lock(mtx);
+
+    auto it = open.find(std::this_thread::get_id());
+    if (it == open.end() || --it->second.depth) {return;}                       // the outermost parse forwards
+
+    pending.swap(it->second.records);
+    open.erase(it);
+
+    if (!target) {
+      records.insert(records.end(), std::make_move_iterator(pending.begin()), std::make_move_iterator(pending.end()));
+      return;
+    }
+  }
+
+  forward(pending);
+}
+// .......................................................................... //
+void BufferedDiagnosticSink::forward    (const std::vector<DiagnosticRecord> & pending) {
+  if (!target) {return;}
+
+  std::lock_guard<std::mutex> lock(targetMtx);
+  for (const auto & record : pending) {target->write(record);}
+}
+// -------------------------------------------------------------------------- //
+std::vector<DiagnosticRecord> BufferedDiagnosticSink::getRecords () const {
+  std::lock_guard<std::mutex> lock(mtx);
+  return records;
+}
+// .......................................................................... //
+size_t                        BufferedDiagnosticSink::size       () const {
+  std::lock_guard<std::mutex> lock(mtx);
+  return records.size();
+}
+// .......................................................................... //
+void                          BufferedDiagnosticSink::flush      () {
+  std::vector<DiagnosticRecord> pending;
+  {
+    std::lock_guard<std::mutex> lock(mtx);
+    pending.swap(records);
+  }
+
+  forward(pending);
+}
+// .......................................................................... //
+void                          BufferedDiagnosticSink::clear      () {
+  std::lock_guard<std::mutex> lock(mtx);
+  records.clear();
+}
+
+// ========================================================================== //
+// AsyncDiagnosticSink
+
+AsyncDiagnosticSink::AsyncDiagnosticSink(std::shared_ptr<DiagnosticSink> target) :
+  target(target ? target : std::make_shared<StderrDiagnosticSink>())
+{
+  worker = std::thread(&AsyncDiagnosticSink::drain, this);
+}
+// .......................................................................... //
+AsyncDiagnosticSink::~AsyncDiagnosticSink() {
+  {
+    std::lock_guard<std::mutex> lock(mtx);
+    stopping = true;
+  }
+  cvQueue.notify_one();
+  worker.join();
+}
+// -------------------------------------------------------------------------- //
+void AsyncDiagnosticSink::drain() {
+  std::unique_lock<std::mutex> lock(mtx);
+
+  for (;;) {
+    cvQueue.wait(lock, [this] {return stopping || !queue.empty();});
+
+    if (queue.empty()) {return;}                                                // only reached when stopping
+
+    auto record = std::move(queue.front());
+    queue.pop_front();
+    busy = true;
+
+    lock.unlock();
+    target->write(record);
+    lock.lock();
+
+    busy = false;
+    if (queue.empty()) {cvDrained.notify_all();}
+  }
+}
+// -------------------------------------------------------------------------- //
+void AsyncDiagnosticSink::write(const DiagnosticRecord & record) {
+  {
+    std::lock_guard<std::mutex> lock(mtx);
+    queue.push_back(record);
+  }
+  cvQueue.notify_one();
+}
+// .......................................................................... //
+void AsyncDiagnosticSink::flush() {
+  std::unique_lock<std::mutex> lock(mtx);
+  cvDrained.wait(lock, [this] {return queue.empty() && !busy;});
+}
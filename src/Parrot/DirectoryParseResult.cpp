@@ -0,0 +1,56 @@
+// ========================================================================== //
+// dependencies
+
+// STL
+#include <stdexcept>
+
+#include <string>
+using namespace std::string_literals;
+
+#include <algorithm>
+
+// own
+#include "BCG.hpp"
+#include "Parrot/DirectoryParseResult.hpp"
+
+using namespace Parrot;
+
+// ========================================================================== //
+// local macro
+
+#define THROWTEXT(msg) ("RUNTIME EXCEPTION IN "s + (__PRETTY_FUNCTION__) + "\n"s + msg)
+
+// ========================================================================== //
+// CTors
+
+DirectoryParseResult::DirectoryParseResult(std::map<std::string, ParseResult> && files, std::vector<DiagnosticRecord> && diagnostics) :
+  files      (std::move(files      )),
+  diagnostics(std::move(diagnostics))
+{}
+
+// ========================================================================== //
+// Getters
+
+bool   DirectoryParseResult::ok      () const {
+  return std::all_of(files.begin(), files.end(), [] (const auto & file) {return file.second.ok();});
+}
+size_t DirectoryParseResult::size    () const {return files.size();}
+bool   DirectoryParseResult::contains(const std::string & path) const {return files.contains(path);}
+// -------------------------------------------------------------------------- //
+const ParseResult & DirectoryParseResult::operator[](const std::string & path) const {
+  auto it = files.find(path);
+  if (it == files.end()) {throw ValueAccessError(THROWTEXT("    file '" + path + "' was not parsed"));}
+  return it->second;
+}
+// -------------------------------------------------------------------------- //
+const std::map<std::string, ParseResult> &  DirectoryParseResult::getFiles      () const {return files;}
+// .......................................................................... //
+std::vector<std::string>                    DirectoryParseResult::getFailedFiles() const {
+  std::vector<std::string> reVal;
+  for (const auto & [path, result] : files) {
+    if (!result.ok()) {reVal.push_back(path);}
+  }
+  return reVal;
+}
+// .......................................................................... //
+const std::vector<DiagnosticRecord> &       DirectoryParseResult::getDiagnostics() const {return diagnostics;}
@@ -0,0 +1,74 @@
+// ========================================================================== //
+// dependencies
+
+// STL
+#include <algorithm>
+
+// own
+#include "Parrot/Executor.hpp"
+
+using namespace Parrot;
+
+// ========================================================================== //
+// InlineExecutor
+
+void InlineExecutor::submit(std::function<void ()> task) {task();}
+
+// ========================================================================== //
+// ThreadPoolExecutor
+
+ThreadPoolExecutor::ThreadPoolExecutor(size_t threads) {
+  if (!threads) {threads = std::max(1u, std::thread::hardware_concurrency());}
+
+  for (auto i = 0u; i < threads; ++i) {workers.emplace_back(&ThreadPoolExecutor::work, this);}
+}
+// .......................................................................... //
+ThreadPoolExecutor::~ThreadPoolExecutor() {
+  {
+    std::lock_guard<std::mutex> lock(mtx);
+    stopping = true;
+  }
+  cvQueue.notify_all();
+  for (auto & worker : workers) {worker.join();}
+}
+// -------------------------------------------------------------------------- //
+void ThreadPoolExecutor::work() {
+  std::unique_lock<std::mutex> lock(mtx);
+
+  for (;;) {
+    cvQueue.wait(lock, [this] {return stopping || !queue.empty();});
+
+    if (queue.empty()) {return;}                                                // only reached when stopping
+
+    auto task = std::move(queue.front());
+    queue.pop_front();
+
+    lock.unlock();
+    task();
+    lock.lock();
+  }
+}
+// -------------------------------------------------------------------------- //
+void ThreadPoolExecutor::submit(std::function<void ()> task) {
+  {
+    std::lock_guard<std::mutex> lock(mtx);
+    queue.push_back(std::move(task));
+  }
+  cvQueue.notify_one();
+}
+// .......................................................................... //
+size_t ThreadPoolExecutor::size() const {return workers.size();}
+
+// ========================================================================== //
+// default
+
+const std::shared_ptr<Executor> & Parrot::defaultExecutor() {
+  static const std::shared_ptr<Executor> pool = std::make_shared<ThreadPoolExecutor>();
+  return pool;
+}
+
+// ========================================================================== //
+// CancellationToken
+
+void CancellationToken::cancel     () const {cancelled->store(true);}
+bool CancellationToken::isCancelled() const {return cancelled->load();}
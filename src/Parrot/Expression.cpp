@@ -0,0 +1,316 @@
+// ========================================================================== //
+// dependencies
+
+// STL
+#include <stdexcept>
+
+#include <string>
+using namespace std::string_literals;
+
+#include <cctype>
+#include <cmath>
+#include <cstdlib>
+#include <numbers>
+#include <mutex>
+
+// own
+#include "Parrot/Expression.hpp"
+
+using namespace Parrot;
+
+// ========================================================================== //
+// local macro
+
+#define THROWTEXT(msg) ("RUNTIME EXCEPTION IN "s + (__PRETTY_FUNCTION__) + "\n"s + msg)
+
+// ========================================================================== //
+// local helpers
+
+using OpCode = Expression::OpCode;
+
+namespace {
+  bool isNameStart(char c) {return std::isalpha(static_cast<unsigned char>(c)) || c == '_';}
+  bool isNameChar (char c) {return std::isalnum(static_cast<unsigned char>(c)) || c == '_' || c == '.';}
+
+  int  precedence (char op) {                                                   // '~' is the unary minus
+    switch (op) {
+      case '+' : case '-' : return 1;
+      case '*' : case '/' : return 2;
+      case '~' :            return 3;
+      case '^' :            return 4;
+      default  :            return 0;
+    }
+  }
+
+  OpCode opCodeOf (char op) {
+    switch (op) {
+      case '+' : return OpCode::Add;
+      case '-' : return OpCode::Sub;
+      case '*' : return OpCode::Mul;
+      case '/' : return OpCode::Div;
+      case '^' : return OpCode::Pow;
+      default  : return OpCode::Neg;
+    }
+  }
+
+  double apply    (OpCode op, double a, double b) {
+    switch (op) {
+      case OpCode::Add : return a + b;
+      case OpCode::Sub : return a - b;
+      case OpCode::Mul : return a * b;
+      case OpCode::Div : return a / b;
+      case OpCode::Pow : return std::pow(a, b);
+      default          : return -b;
+    }
+  }
+
+  // emits op and folds it into a single Push if all its operands are constant
+  void emit(std::vector<Expression::Instruction> & program, OpCode op) {
+    const auto N     = program.size();
+    const bool unary = (op == OpCode::Neg);
+
+    if        ( unary && N >= 1 && program[N-1].op == OpCode::Push) {
+      program[N-1].value = -program[N-1].value;
+
+    } else if (!unary && N >= 2 && program[N-1].op == OpCode::Push && program[N-2].op == OpCode::Push) {
+      program[N-2].value = apply(op, program[N-2].value, program[N-1].value);
+      program.pop_back();
+
+    } else {
+      program.emplace_back(op);
+    }
+  }
+}
+
+// ========================================================================== //
+// CTors
+
+Expression Expression::compile(const std::string & text, const std::map<std::string, double> & constants) {
+  Expression reVal;
+  reVal.text = text;
+
+  auto fail = [&text] (const std::string & reason, size_t pos) {
+    return ExpressionError(THROWTEXT("    invalid expression '" + text + "' at position " + std::to_string(pos) + ": " + reason));
+  };
+
+  std::vector<char> ops;                                                        // operator stack; '(' marks a parenthesis
+  bool              expectOperand = true;                                       // otherwise, expect an operator or ')'
+  size_t            pos           = 0;
+
+  auto pushOperator = [&] (char op) {
+    const bool rightAssoc = (op == '^');
+    while ( !ops.empty() && ops.back() != '(' ) {
+      const auto top = ops.back();
+      if ( precedence(top) > precedence(op) || (precedence(top) == precedence(op) && !rightAssoc) ) {
+        emit(reVal.program, opCodeOf(top));
+        ops.pop_back();
+      } else {break;}
+    }
+    ops.push_back(op);
+  };
+
+  while (pos < text.size()) {
+    const char c = text[pos];
+
+    if ( std::isspace(static_cast<unsigned char>(c)) ) {++pos; continue;}
+
+    // ...................................................................... //
+    // operands -- an operand right after another one is an implicit product
+
+    if ( std::isdigit(static_cast<unsigned char>(c)) || c == '.' || isNameStart(c) || c == '(' ) {
+      if (!expectOperand) {pushOperator('*');}
+
+      if (c == '(') {
+        ops.push_back('(');
+        ++pos;
+        expectOperand = true;
+        continue;
+      }
+
+      if ( isNameStart(c) ) {
+        auto end = pos;
+        while ( end < text.size() && isNameChar(text[end]) ) {++end;}
+
+        auto name   = text.substr(pos, end - pos);
+        auto folded = name;
+        for (auto & n : folded) {n = std::toupper( static_cast<unsigned char>(n) );}
+
+        auto constant = constants.find(folded);
+        if (constant != constants.end()) {reVal.program.emplace_back(OpCode::Push, constant->second);}
+        else                             {reVal.program.emplace_back(OpCode::Load, 0, name);}
+
+        pos = end;
+
+      } else {
+        char * end   = nullptr;
+        auto   value = std::strtod(text.c_str() + pos, &end);
+        auto   next  = static_cast<size_t>(end - text.c_str());
+        if (next == pos) {throw fail("malformed number", pos);}
+
+        reVal.program.emplace_back(OpCode::Push, value);
+        pos = next;
+      }
+
+      expectOperand = false;
+      continue;
+    }
+
+    // ...................................................................... //
+    // operators
+
+    ++pos;
+
+    if (c == ')') {
+      if (expectOperand) {throw fail("operand expected", pos - 1);}
+      while ( !ops.empty() && ops.back() != '(' ) {emit(reVal.program, opCodeOf(ops.back())); ops.pop_back();}
+      if ( ops.empty() ) {throw fail("unbalanced ')'", pos - 1);}
+      ops.pop_back();
+      continue;
+    }
+
+    if ( precedence(c) == 0 ) {throw fail("unexpected character '"s + c + "'", pos - 1);}
+
+    if (expectOperand) {
+      if      (c == '-') {ops.push_back('~');}                                 // prefix: nothing to its left to reduce
+      else if (c == '+') {}
+      else               {throw fail("operand expected", pos - 1);}
+      continue;
+    }
+
+    pushOperator(c);
+    expectOperand = true;
+  }
+
+  if (expectOperand) {throw fail("operand expected", pos);}
+
+  while ( !ops.empty() ) {
+    if (ops.back() == '(') {throw fail("unbalanced '('", pos);}
+    emit(reVal.program, opCodeOf(ops.back()));
+    ops.pop_back();
+  }
+
+  // ........................................................................ //
+  // stack size
+
+  size_t height = 0;
+  for (const auto & instruction : reVal.program) {
+    switch (instruction.op) {
+      case OpCode::Push : case OpCode::Load : ++height; break;
+      case OpCode::Neg  :                             break;
+      default           :                   --height; break;
+    }
+    reVal.depth = std::max(reVal.depth, height);
+  }
+
+  return reVal;
+}
+
+// ========================================================================== //
+// Getters
+
+const std::string &                             Expression::getText      () const {return text;}
+const std::vector<Expression::Instruction> &    Expression::getProgram   () const {return program;}
+bool                                            Expression::isConstant   () const {return program.size() == 1 && program[0].op == OpCode::Push;}
+std::vector<std::string>                        Expression::getReferences() const {
+  std::vector<std::string> reVal;
+  for (const auto & instruction : program) {
+    if (instruction.op == OpCode::Load) {reVal.push_back(instruction.name);}
+  }
+  return reVal;
+}
+
+// ========================================================================== //
+// Evaluation
+
+double Expression::evaluate(const Resolver & resolve) const {
+  if ( isConstant() ) {return program[0].value;}
+
+  constexpr size_t    localDepth = 16;
+  double              local[localDepth] = {};
+  std::vector<double> heap;
+  double *            stack = local;
+  size_t              top   = 0;                                                // number of values on the stack
+
+  if (depth > localDepth) {
+    heap.resize(depth);
+    stack = heap.data();
+  }
+
+  for (const auto & instruction : program) {
+    switch (instruction.op) {
+      case OpCode::Push :
+        stack[top++] = instruction.value;
+        break;
+
+      case OpCode::Load :
+        if (!resolve) {throw ExpressionError(THROWTEXT("    unresolved name '" + instruction.name + "' in '" + text + "'"));}
+        stack[top++] = resolve(instruction.name);
+        break;
+
+      case OpCode::Neg :
+        stack[top-1] = -stack[top-1];
+        break;
+
+      default :
+        --top;
+        stack[top-1] = apply(instruction.op, stack[top-1], stack[top]);
+        break;
+    }
+  }
+
+  return stack[0];
+}
+
+// ========================================================================== //
+// Representation
+
+std::string Expression::to_string() const {
+  std::string reVal;
+
+  for (const auto & instruction : program) {
+    if ( !reVal.empty() ) {reVal += " ";}
+
+    switch (instruction.op) {
+      case OpCode::Push : reVal += std::to_string(instruction.value); break;
+      case OpCode::Load : reVal += instruction.name;                  break;
+      case OpCode::Add  : reVal += "+";                               break;
+      case OpCode::Sub  : reVal += "-";                               break;
+      case OpCode::Mul  : reVal += "*";                               break;
+      case OpCode::Div  : reVal += "/";                               break;
+      case OpCode::Pow  : reVal += "^";                               break;
+      case OpCode::Neg  : reVal += "neg";                             break;
+    }
+  }
+
+  return reVal;
+}
+
+// ========================================================================== //
+// ExpressionCache
+
+ExpressionCache::ExpressionCache() :
+  ExpressionCache({{"PI", std::numbers::pi}, {"E", std::numbers::e}})
+{}
+// .......................................................................... //
+ExpressionCache::ExpressionCache(const std::map<std::string, double> & constants) :
+  constants(constants)
+{}
+// -------------------------------------------------------------------------- //
+const std::map<std::string, double> &   ExpressionCache::getConstants() const {return constants;}
+size_t                                  ExpressionCache::size        () const {
+  std::shared_lock lock(mutex);
+  return programs.size();
+}
+// .......................................................................... //
+std::shared_ptr<const Expression>       ExpressionCache::get         (const std::string & text) const {
+  {
+    std::shared_lock lock(mutex);
+    auto it = programs.find(text);
+    if (it != programs.end()) {return it->second;}
+  }
+
+  auto compiled = std::make_shared<const Expression>( Expression::compile(text, constants) );
+
+  std::unique_lock lock(mutex);
+  return programs.try_emplace(text, compiled).first->second;                    // another thread may have been faster
+}
@@ -10,6 +10,8 @@
 using namespace std::string_literals;
 
 #include <algorithm>
+#include <numeric>
+#include <utility>
 
 // own
 #include "BCG.hpp"
@@ -22,49 +24,129 @@ using namespace Parrot;
 
 #define THROWTEXT(msg) ("RUNTIME EXCEPTION IN "s + (__PRETTY_FUNCTION__) + "\n"s + msg)
 
+// ========================================================================== //
+// local helpers
+
+template<typename T>
+std::span<const T> listSpan(const std::any & x) {                               // numeric lists are stored plain or aligned
+  if (auto plain   = std::any_cast<std::vector  <T>>(&x)) {return {plain  ->data(), plain  ->size()};}
+  if (auto aligned = std::any_cast<AlignedVector<T>>(&x)) {return {aligned->data(), aligned->size()};}
+  throw std::bad_any_cast();
+}
+
 // ========================================================================== //
 // safe getter
 
-FileContent::ContentType              FileContent::getSafe             (const std::string & key) const {
-  auto it = content.find(key);
+const FileContent::ContentType &      FileContent::getSafe             (const std::string & key) const {
+  auto data = find(key);
 
-  if ( it == content.end() ) {
+  if ( !data ) {
     throw Parrot::ValueAccessError(THROWTEXT("    keyword '" + key + "' does not exist."));
   }
 
-  return (*it).second;
+  return *data;
+}
+// .......................................................................... //
+const FileContent::ContentType *      FileContent::find                (const std::string & key) const {
+  auto data = entry(key);
+  return data ? &data->data : nullptr;
+}
+// .......................................................................... //
+const FileContent::Entry *            FileContent::entry               (const std::string & key) const {
+  if (keywords) {
+    auto id = keywords->find(key);
+    if (id != KeywordTable::npos) {return slots[id] ? &*slots[id] : nullptr;}
+  }
+
+  auto it = others.find(key);
+  return it == others.end() ? nullptr : &it->second;
+}
+FileContent::Entry *                  FileContent::entry               (const std::string & key) {
+  return const_cast<Entry *>( std::as_const(*this).entry(key) );
+}
+// .......................................................................... //
+void                                  FileContent::store               (const std::string & key, ContentType && data) {
+  auto id = keywords ? keywords->find(key) : KeywordTable::npos;
+
+  if (id != KeywordTable::npos) {store(id, std::move(data));}
+  else {
+    auto it = others.find(key);
+    if (it != others.end()) {it->second = Entry {std::move(data)};}
+    else                    {others.emplace(key, Entry {std::move(data)});}
+  }
+}
+void                                  FileContent::store               (KeywordTable::ID  id , ContentType && data) {
+  if (!slots[id]) {++slotsUsed;}
+  slots[id] = Entry {std::move(data)};
+}
+// .......................................................................... //
+void                                  FileContent::throwMissing        (KeywordTable::ID    id ) const {
+  throw Parrot::ValueAccessError(THROWTEXT("    keyword ID " + std::to_string(id) + " does not exist."));
+}
+void                                  FileContent::checkTable          (const std::shared_ptr<const KeywordTable> & table, KeywordTable::ID id) const {
+  if ( !table ) {throw Parrot::ValueAccessError(THROWTEXT("    handle does not refer to a keyword."));}
+
+  const auto & name = table->name(id);
+  if ( !keywords || id >= keywords->size() || keywords->name(id) != name ) {
+    throw Parrot::ValueAccessError(THROWTEXT("    handle of keyword '" + name + "' was created for another keyword table."));
+  }
 }
 
 // ========================================================================== //
 // CTors
 
 FileContent::FileContent (const std::string & source) {this->source = source;}
+FileContent::FileContent (const std::string & source, std::pmr::memory_resource * resource) :
+  source (source),
+  slots  (resource),
+  others (resource)
+{}
+FileContent::FileContent (const std::string &                  source,
+                          std::shared_ptr<const KeywordTable>  keywords,
+                          std::pmr::memory_resource *          resource) :
+  source  (source),
+  keywords(keywords),
+  slots   (keywords ? keywords->size() : 0, resource),
+  others  (resource)
+{}
 
 // ========================================================================== //
 // Getters
 
 const std::string &                   FileContent::getSource           ()                        const {return source;}
-bool                                  FileContent::empty               ()                        const {return content.empty();}
-size_t                                FileContent::size                ()                        const {return content.size();}
+bool                                  FileContent::empty               ()                        const {return size() == 0;}
+size_t                                FileContent::size                ()                        const {return slotsUsed + others.size();}
 // -------------------------------------------------------------------------- //
-bool                                  FileContent::hasKeyword          (const std::string & key) const {return content.contains(key);}
+bool                                  FileContent::hasKeyword          (const std::string & key) const {return find(key) != nullptr;}
+bool                                  FileContent::hasKeyword          (KeywordTable::ID    id ) const {return id < slots.size() && slots[id];}
 bool                                  FileContent::hasValue            (const std::string & key) const {return getAny(key).has_value();}
 std::vector<std::string>              FileContent::getKeywords() const {
-  std::vector<std::string> reVal(content.size());
+  std::vector<std::string> reVal;
+  reVal.reserve(size());
 
-  std::transform(content.begin(), content.end(),
-                 reVal  .begin(),
-                 [] (const auto & pair) {return pair.first;}
-  );
+  for (auto id = 0u; id < slots.size(); ++id) {
+    if (slots[id]) {reVal.push_back( keywords->name(id) );}
+  }
+  for (const auto & [key, data] : others) {reVal.emplace_back(key);}
 
+  std::sort(reVal.begin(), reVal.end());
   return reVal;
 }
 // .......................................................................... //
 FileContent::ContentType              FileContent::get                 (const std::string & key) const {return                            getSafe(key) ;}
+FileContent::ContentType              FileContent::get                 (KeywordTable::ID    id ) const {
+  if ( !hasKeyword(id) ) {throwMissing(id);}
+  return slots[id]->data;
+}
 std::any                              FileContent::getAny              (const std::string & key) const {return std::get<Value           >(getSafe(key));}
 Parrot::ValueTypeID                   FileContent::getValueType        (const std::string & key) const {return std::get<ValueType       >(getSafe(key));}
 bool                                  FileContent::getFoundInFile      (const std::string & key) const {return std::get<FoundInFile     >(getSafe(key));}
 bool                                  FileContent::getTriggeredWarning (const std::string & key) const {return std::get<TriggeredWarning>(getSafe(key));}
+int                                   FileContent::getLine             (const std::string & key) const {
+  auto data = entry(key);
+  if ( !data ) {throw Parrot::ValueAccessError(THROWTEXT("    keyword '" + key + "' does not exist."));}
+  return data->line;
+}
 // .......................................................................... //
 PARROT_TYPE(ValueTypeID::String     ) FileContent::get_String          (const std::string & key) const {
   return static_cast<PARROT_TYPE(ValueTypeID::String     )>((*this)[key]);
@@ -82,18 +164,76 @@ PARROT_TYPE(ValueTypeID::StringList ) FileContent::get_StringList      (const st
   return static_cast<PARROT_TYPE(ValueTypeID::StringList )>((*this)[key]);
 }
 PARROT_TYPE(ValueTypeID::IntegerList) FileContent::get_IntegerList     (const std::string & key) const {
-  return static_cast<PARROT_TYPE(ValueTypeID::IntegerList)>((*this)[key]);
+  auto view = getSpan_IntegerList(key);
+  return PARROT_TYPE(ValueTypeID::IntegerList)(view.begin(), view.end());
 }
 PARROT_TYPE(ValueTypeID::RealList   ) FileContent::get_RealList        (const std::string & key) const {
-  return static_cast<PARROT_TYPE(ValueTypeID::RealList   )>((*this)[key]);
+  auto view = getSpan_RealList(key);
+  return PARROT_TYPE(ValueTypeID::RealList   )(view.begin(), view.end());
 }
 PARROT_TYPE(ValueTypeID::BooleanList) FileContent::get_BooleanList     (const std::string & key) const {
   return static_cast<PARROT_TYPE(ValueTypeID::BooleanList)>((*this)[key]);
 }
+PARROT_TYPE(ValueTypeID::RealRange  ) FileContent::get_RealRange       (const std::string & key) const {
+  return static_cast<PARROT_TYPE(ValueTypeID::RealRange  )>((*this)[key]);
+}
+PARROT_TYPE(ValueTypeID::Int32      ) FileContent::get_Int32           (const std::string & key) const {
+  return static_cast<PARROT_TYPE(ValueTypeID::Int32      )>((*this)[key]);
+}
+PARROT_TYPE(ValueTypeID::Float32    ) FileContent::get_Float32         (const std::string & key) const {
+  return static_cast<PARROT_TYPE(ValueTypeID::Float32    )>((*this)[key]);
+}
+PARROT_TYPE(ValueTypeID::Complex    ) FileContent::get_Complex         (const std::string & key) const {
+  return std::any_cast<PARROT_TYPE(ValueTypeID::Complex  )>(getAny(key));
+}
+PARROT_TYPE(ValueTypeID::Int32List  ) FileContent::get_Int32List       (const std::string & key) const {
+  auto view = getSpan_Int32List(key);
+  return PARROT_TYPE(ValueTypeID::Int32List  )(view.begin(), view.end());
+}
+PARROT_TYPE(ValueTypeID::Float32List) FileContent::get_Float32List     (const std::string & key) const {
+  auto view = getSpan_Float32List(key);
+  return PARROT_TYPE(ValueTypeID::Float32List)(view.begin(), view.end());
+}
+PARROT_TYPE(ValueTypeID::ComplexList) FileContent::get_ComplexList     (const std::string & key) const {
+  auto view = getSpan_ComplexList(key);
+  return PARROT_TYPE(ValueTypeID::ComplexList)(view.begin(), view.end());
+}
+// .......................................................................... //
+std::span<const PARROT_TYPE(ValueTypeID::Integer)> FileContent::getSpan_IntegerList (const std::string & key) const {
+  auto data = find(key);
+  if ( !data ) {throw Parrot::ValueAccessError(THROWTEXT("    keyword '" + key + "' does not exist."));}
+  return listSpan<PARROT_TYPE(ValueTypeID::Integer)>(std::get<Value>(*data));
+}
+std::span<const PARROT_TYPE(ValueTypeID::Real   )> FileContent::getSpan_RealList    (const std::string & key) const {
+  auto data = find(key);
+  if ( !data ) {throw Parrot::ValueAccessError(THROWTEXT("    keyword '" + key + "' does not exist."));}
+  return listSpan<PARROT_TYPE(ValueTypeID::Real   )>(std::get<Value>(*data));
+}
+std::span<const PARROT_TYPE(ValueTypeID::Int32  )> FileContent::getSpan_Int32List   (const std::string & key) const {
+  auto data = find(key);
+  if ( !data ) {throw Parrot::ValueAccessError(THROWTEXT("    keyword '" + key + "' does not exist."));}
+  return listSpan<PARROT_TYPE(ValueTypeID::Int32  )>(std::get<Value>(*data));
+}
+std::span<const PARROT_TYPE(ValueTypeID::Float32)> FileContent::getSpan_Float32List (const std::string & key) const {
+  auto data = find(key);
+  if ( !data ) {throw Parrot::ValueAccessError(THROWTEXT("    keyword '" + key + "' does not exist."));}
+  return listSpan<PARROT_TYPE(ValueTypeID::Float32)>(std::get<Value>(*data));
+}
+std::span<const PARROT_TYPE(ValueTypeID::Complex)> FileContent::getSpan_ComplexList (const std::string & key) const {
+  auto data = find(key);
+  if ( !data ) {throw Parrot::ValueAccessError(THROWTEXT("    keyword '" + key + "' does not exist."));}
+  return listSpan<PARROT_TYPE(ValueTypeID::Complex)>(std::get<Value>(*data));
+}
 // -------------------------------------------------------------------------- //
 
 // -------------------------------------------------------------------------- //
-const std::map<std::string,           FileContent::ContentType> & FileContent::getContent() const {return content;}
+std::map<std::string, FileContent::ContentType> FileContent::toMap          () const {
+  std::map<std::string, ContentType> reVal;
+  forEach([&reVal] (std::string_view key, const ContentType & data) {reVal.emplace(key, data);});
+  return reVal;
+}
+std::pmr::memory_resource *                     FileContent::getResource    () const {return others.get_allocator().resource();}
+const std::shared_ptr<const KeywordTable> &     FileContent::getKeywordTable() const {return keywords;}
 
 // ========================================================================== //
 // Value Access
@@ -104,8 +244,10 @@ FileContent::TypeConverterClass FileContent::operator[](const std::string & key)
 // Setters
 
 void FileContent::reset() {
-  source = "<user defined>";
-  content.clear();
+  source    = "<user defined>";
+  others    .clear();
+  std::fill(slots.begin(), slots.end(), std::nullopt);
+  slotsUsed = 0;
 }
 // -------------------------------------------------------------------------- //
 void FileContent::addElement   (const std::string & key,
@@ -115,7 +257,7 @@ void FileContent::addElement   (const std::string & key,
 ) {
   if ( hasKeyword(key) )    {throw Parrot::ValueAccessError(THROWTEXT("    keyword already defined!"));}
   if ( !value.has_value() ) {throw Parrot::ValueAccessError(THROWTEXT("    value type could not be deduced!"));}
-  content[key] = std::make_tuple(value, getAnyValueType(value), foundInFile, triggeredWarning);
+  store(key, std::make_tuple(value, getAnyValueType(value), foundInFile, triggeredWarning));
 }
 // .......................................................................... //
 void FileContent::addElement   (const std::string & key,
@@ -124,7 +266,7 @@ void FileContent::addElement   (const std::string & key,
                                 bool                triggeredWarning
 ) {
   if ( hasKeyword(key) )    {throw Parrot::ValueAccessError(THROWTEXT("    keyword already defined!"));}
-  content[key] = std::make_tuple(std::any(), valueType, foundInFile, triggeredWarning);
+  store(key, std::make_tuple(std::any(), valueType, foundInFile, triggeredWarning));
 }
 // -------------------------------------------------------------------------- //
 void FileContent::updateElement(const std::string & key,
@@ -132,9 +274,10 @@ void FileContent::updateElement(const std::string & key,
                                 bool                foundInFile,
                                 bool                triggeredWarning
 ) {
-  if (!hasKeyword(key) ) {throw Parrot::ValueAccessError(THROWTEXT("    keyword does not exist!"));}
+  auto data = entry(key);
+  if ( !data )              {throw Parrot::ValueAccessError(THROWTEXT("    keyword does not exist!"));}
   if ( !value.has_value() ) {throw Parrot::ValueAccessError(THROWTEXT("    value type could not be deduced!"));}
-  content[key] = std::make_tuple(value, getAnyValueType(value), foundInFile, triggeredWarning);
+  data->data = std::make_tuple(value, getAnyValueType(value), foundInFile, triggeredWarning);
 }
 // .......................................................................... //
 void FileContent::updateElement(const std::string & key,
@@ -142,8 +285,9 @@ void FileContent::updateElement(const std::string & key,
                                 bool                foundInFile,
                                 bool                triggeredWarning
 ) {
-  if (!hasKeyword(key) ) {throw Parrot::ValueAccessError(THROWTEXT("    keyword does not exist!"));}
-  content[key] = std::make_tuple(std::any(), valueType, foundInFile, triggeredWarning);
+  auto data = entry(key);
+  if ( !data ) {throw Parrot::ValueAccessError(THROWTEXT("    keyword does not exist!"));}
+  data->data = std::make_tuple(std::any(), valueType, foundInFile, triggeredWarning);
 }
 // -------------------------------------------------------------------------- //
 void FileContent::setElement   (const std::string & key,
@@ -152,7 +296,7 @@ void FileContent::setElement   (const std::string & key,
                                 bool                triggeredWarning
 ) {
   if ( !value.has_value() ) {throw Parrot::ValueAccessError(THROWTEXT("    value type could not be deduced!"));}
-  content[key] = std::make_tuple(value, getAnyValueType(value), foundInFile, triggeredWarning);
+  store(key, std::make_tuple(value, getAnyValueType(value), foundInFile, triggeredWarning));
 }
 // .......................................................................... //
 void FileContent::setElement   (const std::string & key,
@@ -160,25 +304,61 @@ void FileContent::setElement   (const std::string & key,
                                 bool                foundInFile,
                                 bool                triggeredWarning
 ) {
-  content[key] = std::make_tuple(std::any(), valueType, foundInFile, triggeredWarning);
+  store(key, std::make_tuple(std::any(), valueType, foundInFile, triggeredWarning));
+}
+// -------------------------------------------------------------------------- //
+void FileContent::addElement   (KeywordTable::ID    id,
+                                const std::any &    value,
+                                bool                foundInFile,
+                                bool                triggeredWarning
+) {
+  if ( id >= slots.size() ) {throw Parrot::ValueAccessError(THROWTEXT("    invalid keyword ID " + std::to_string(id) + "!"));}
+  if ( hasKeyword(id) )     {throw Parrot::ValueAccessError(THROWTEXT("    keyword already defined!"));}
+  if ( !value.has_value() ) {throw Parrot::ValueAccessError(THROWTEXT("    value type could not be deduced!"));}
+  store(id, std::make_tuple(value, getAnyValueType(value), foundInFile, triggeredWarning));
+}
+// .......................................................................... //
+void FileContent::updateElement(KeywordTable::ID    id,
+                                const std::any &    value,
+                                bool                foundInFile,
+                                bool                triggeredWarning
+) {
+  if (!hasKeyword(id) )     {throw Parrot::ValueAccessError(THROWTEXT("    keyword does not exist!"));}
+  if ( !value.has_value() ) {throw Parrot::ValueAccessError(THROWTEXT("    value type could not be deduced!"));}
+  slots[id]->data = std::make_tuple(value, getAnyValueType(value), foundInFile, triggeredWarning);
+}
+// -------------------------------------------------------------------------- //
+void FileContent::setLine      (const std::string & key, int line) {
+  auto data = entry(key);
+  if ( !data ) {throw Parrot::ValueAccessError(THROWTEXT("    keyword does not exist!"));}
+  data->line = line;
+}
+// .......................................................................... //
+void FileContent::setLine      (KeywordTable::ID    id,  int line) {
+  if (!hasKeyword(id) ) {throw Parrot::ValueAccessError(THROWTEXT("    keyword does not exist!"));}
+  slots[id]->line = line;
 }
 
 // ========================================================================== //
 // Representation
 
 std::string FileContent::to_string() const {
-  size_t                   N = content.size(), i = 0;
+  size_t                   N = size(), i = 0;
   std::vector<std::string>  keys(N),  types(N),  contents(N),  flagsFound(N),  flagsWarning(N);
   size_t                   wKeys   , wTypes   , wContents   , wFlagsFound   , wFlagsWarning   ;
 
-  for (const auto & [key, data] : content) {
+  forEach([&] (std::string_view key, const ContentType & data) {
     keys        [i] = key;
     types       [i] = valueTypeName(std::get<ValueType       >(data));
     contents    [i] = getAnyText   (std::get<Value           >(data));
     flagsFound  [i] =               std::get<FoundInFile     >(data) ? "yes" : "no";
     flagsWarning[i] =               std::get<TriggeredWarning>(data) ? "yes" : "no";
     ++i;
-  }
+  });
+
+  std::vector<size_t> order(N);                                                 // rows in alphabetical order of the keywords
+  std::iota(order.begin(), order.end(), 0);
+  std::sort(order.begin(), order.end(), [&keys] (size_t a, size_t b) {return keys[a] < keys[b];});
 
   wKeys = std::accumulate    (keys.begin(), keys.end(),
                               size_t(0),
@@ -215,7 +395,7 @@ std::string FileContent::to_string() const {
            std::string(wFlagsWarning + 1, '-')  +
            "\n";
 
-  for (i = 0; i < keys.size(); ++i) {
+  for (auto i : order) {
     reVal += BCG::justifyLeft(keys        [i], wKeys        ) + " | ";
     reVal += BCG::justifyLeft(contents    [i], wContents    ) + " | ";
     reVal += BCG::justifyLeft(types       [i], wTypes       ) + " | ";
@@ -235,6 +415,27 @@ FileContent::TypeConverterClass::operator PARROT_TYPE(ValueTypeID::Integer    )
 FileContent::TypeConverterClass::operator PARROT_TYPE(ValueTypeID::Real       ) () {return std::any_cast<PARROT_TYPE(ValueTypeID::Real       )>(data);}
 FileContent::TypeConverterClass::operator PARROT_TYPE(ValueTypeID::Boolean    ) () {return std::any_cast<PARROT_TYPE(ValueTypeID::Boolean    )>(data);}
 FileContent::TypeConverterClass::operator PARROT_TYPE(ValueTypeID::StringList ) () {return std::any_cast<PARROT_TYPE(ValueTypeID::StringList )>(data);}
-FileContent::TypeConverterClass::operator PARROT_TYPE(ValueTypeID::IntegerList) () {return std::any_cast<PARROT_TYPE(ValueTypeID::IntegerList)>(data);}
-FileContent::TypeConverterClass::operator PARROT_TYPE(ValueTypeID::RealList   ) () {return std::any_cast<PARROT_TYPE(ValueTypeID::RealList   )>(data);}
+FileContent::TypeConverterClass::operator PARROT_TYPE(ValueTypeID::IntegerList) () {
+  auto view = listSpan<PARROT_TYPE(ValueTypeID::Integer)>(data);
+  return PARROT_TYPE(ValueTypeID::IntegerList)(view.begin(), view.end());
+}
+FileContent::TypeConverterClass::operator PARROT_TYPE(ValueTypeID::RealList   ) () {
+  auto view = listSpan<PARROT_TYPE(ValueTypeID::Real   )>(data);
+  return PARROT_TYPE(ValueTypeID::RealList   )(view.begin(), view.end());
+}
 FileContent::TypeConverterClass::operator PARROT_TYPE(ValueTypeID::BooleanList) () {return std::any_cast<PARROT_TYPE(ValueTypeID::BooleanList)>(data);}
+FileContent::TypeConverterClass::operator PARROT_TYPE(ValueTypeID::RealRange  ) () {return std::any_cast<PARROT_TYPE(ValueTypeID::RealRange  )>(data);}
+FileContent::TypeConverterClass::operator PARROT_TYPE(ValueTypeID::Int32      ) () {return std::any_cast<PARROT_TYPE(ValueTypeID::Int32      )>(data);}
+FileContent::TypeConverterClass::operator PARROT_TYPE(ValueTypeID::Float32    ) () {return std::any_cast<PARROT_TYPE(ValueTypeID::Float32    )>(data);}
+FileContent::TypeConverterClass::operator PARROT_TYPE(ValueTypeID::Int32List  ) () {
+  auto view = listSpan<PARROT_TYPE(ValueTypeID::Int32  )>(data);
+  return PARROT_TYPE(ValueTypeID::Int32List  )(view.begin(), view.end());
+}
+FileContent::TypeConverterClass::operator PARROT_TYPE(ValueTypeID::Float32List) () {
+  auto view = listSpan<PARROT_TYPE(ValueTypeID::Float32)>(data);
+  return PARROT_TYPE(ValueTypeID::Float32List)(view.begin(), view.end());
+}
+FileContent::TypeConverterClass::operator PARROT_TYPE(ValueTypeID::ComplexList) () {
+  auto view = listSpan<PARROT_TYPE(ValueTypeID::Complex)>(data);
+  return PARROT_TYPE(ValueTypeID::ComplexList)(view.begin(), view.end());
+}
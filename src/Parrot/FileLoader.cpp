@@ -0,0 +1,408 @@
+// ========================================================================== //
+// dependencies
+
+// STL
+#include <stdexcept>
+
+#include <string>
+using namespace std::string_literals;
+
+#include <fstream>
+#include <sstream>
+#include <algorithm>
+#include <cstring>
+#include <cerrno>
+
+#include <atomic>
+#include <thread>
+
+// own
+#include "Parrot/FileLoader.hpp"
+
+// POSIX
+#if defined(__unix__) || defined(__APPLE__)
+#  define PARROT_POSIX_IO 1
+#  include <fcntl.h>
+#  include <unistd.h>
+#  include <sys/stat.h>
+#endif
+
+#if defined(__linux__) && __has_include(<linux/io_uring.h>)
+#  define PARROT_IO_URING 1
+#  include <linux/io_uring.h>
+#  include <sys/syscall.h>
+#  include <sys/mman.h>
+#endif
+
+using namespace Parrot;
+
+// ========================================================================== //
+// local macro
+
+#define THROWTEXT(msg) ("RUNTIME EXCEPTION IN "s + (__PRETTY_FUNCTION__) + "\n"s + msg)
+
+// ========================================================================== //
+// local helpers
+
+namespace {
+  constexpr size_t unsizedChunk = 65536;                                        // read step for files of unknown size, e.g. pipes
+
+  std::exception_ptr readError(const std::string & file, int error) {
+    return std::make_exception_ptr(std::runtime_error(THROWTEXT(
+      "    could not read file '" + file + "': " + std::strerror(error)
+    )));
+  }
+
+  // ------------------------------------------------------------------------ //
+
+  // reads all of file into text; returns 0 or the errno of the failing call
+  int readFile(const std::string & file, std::string & text) {
+#ifdef PARROT_POSIX_IO
+    auto fd = ::open(file.c_str(), O_RDONLY | O_CLOEXEC);
+    if (fd < 0) {return errno;}
+
+    struct stat info;
+    if (::fstat(fd, &info)) {
+      auto error = errno;
+      ::close(fd);
+      return error;
+    }
+
+    int    error  = 0;
+    size_t filled = 0;
+    bool   sized  = S_ISREG(info.st_mode) && info.st_size;                      // e.g. files in /proc report size 0
+    text.resize(sized ? info.st_size : unsizedChunk);
+
+    for (;;) {
+      if (filled == text.size()) {
+        if (sized) {break;}                                                     // size is exact; spare the call that returns 0
+        text.resize(filled + unsizedChunk);
+      }
+
+      auto count = sized ? ::pread(fd, text.data() + filled, text.size() - filled, filled)
+                         : ::read (fd, text.data() + filled, text.size() - filled);          // pipes cannot pread
+      if (count < 0 && errno == EINTR) {continue;}
+      if (count < 0 ) {error = errno; break;}
+      if (count == 0) {break;}                                                  // file shrank since fstat
+      filled += count;
+    }
+
+    text.resize(filled);
+    ::close(fd);
+    return error;
+#else
+    std::ifstream hFile(file, std::ios::binary);
+    if (!hFile) {return ENOENT;}
+
+    std::ostringstream buffer;
+    buffer << hFile.rdbuf();
+    text = std::move(buffer).str();
+    return 0;
+#endif
+  }
+
+  // ------------------------------------------------------------------------ //
+
+#ifdef PARROT_IO_URING
+  // an io_uring set up without liburing: the rings are mapped into memory and
+  // synchronized with the kernel through their head and tail indices
+  class Ring {
+  private:
+    int             fd        = -1;
+    void *          sqRing    = MAP_FAILED;
+    void *          cqRing    = MAP_FAILED;
+    size_t          sqRingSize = 0;
+    size_t          cqRingSize = 0;
+    io_uring_sqe *  sqes      = static_cast<io_uring_sqe *>(MAP_FAILED);
+    size_t          sqesSize  = 0;
+
+    unsigned *      sqTail;
+    unsigned *      sqMask;
+    unsigned *      sqArray;
+    unsigned *      cqHead;
+    unsigned *      cqTail;
+    unsigned *      cqMask;
+    io_uring_cqe *  cqes;
+
+    unsigned        pending   = 0;                                              // pushed, but not yet submitted
+
+    template<typename T>
+    T * at(void * base, unsigned offset) {return reinterpret_cast<T *>(static_cast<char *>(base) + offset);}
+
+    void release() {
+      if (sqes   != MAP_FAILED                    ) {munmap(sqes  , sqesSize  );}
+      if (cqRing != MAP_FAILED && cqRing != sqRing) {munmap(cqRing, cqRingSize);}
+      if (sqRing != MAP_FAILED                    ) {munmap(sqRing, sqRingSize);}
+      if (fd >= 0) {::close(fd);}
+    }
+
+  public:
+    Ring(unsigned entries) {
+      io_uring_params params {};
+      fd = syscall(__NR_io_uring_setup, entries, &params);
+      if (fd < 0) {throw std::runtime_error(THROWTEXT("    io_uring_setup failed: "s + std::strerror(errno)));}
+
+      if ( !(params.features & IORING_FEAT_RW_CUR_POS) ) {                     // introduced with openat, statx and close
+        ::close(fd);
+        throw std::runtime_error(THROWTEXT("    io_uring of this kernel does not support opening files"));
+      }
+
+      sqRingSize = params.sq_off.array + params.sq_entries * sizeof(unsigned);
+      cqRingSize = params.cq_off.cqes  + params.cq_entries * sizeof(io_uring_cqe);
+      sqesSize   = params.sq_entries * sizeof(io_uring_sqe);
+
+      auto single = params.features & IORING_FEAT_SINGLE_MMAP;
+      if (single) {sqRingSize = cqRingSize = std::max(sqRingSize, cqRingSize);}
+
+      sqRing = mmap(nullptr, sqRingSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, fd, IORING_OFF_SQ_RING);
+      cqRing = single ? sqRing :
+               mmap(nullptr, cqRingSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, fd, IORING_OFF_CQ_RING);
+      sqes   = static_cast<io_uring_sqe *>(
+               mmap(nullptr, sqesSize  , PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, fd, IORING_OFF_SQES)
+      );
+      if (sqRing == MAP_FAILED || cqRing == MAP_FAILED || sqes == MAP_FAILED) {
+        auto error = errno;
+        release();
+        errno = error;
+        throw std::runtime_error(THROWTEXT("    could not map io_uring: "s + std::strerror(errno)));
+      }
+
+      sqTail  = at<unsigned    >(sqRing, params.sq_off.tail        );
+      sqMask  = at<unsigned    >(sqRing, params.sq_off.ring_mask   );
+      sqArray = at<unsigned    >(sqRing, params.sq_off.array       );
+      cqHead  = at<unsigned    >(cqRing, params.cq_off.head        );
+      cqTail  = at<unsigned    >(cqRing, params.cq_off.tail        );
+      cqMask  = at<unsigned    >(cqRing, params.cq_off.ring_mask   );
+      cqes    = at<io_uring_cqe>(cqRing, params.cq_off.cqes        );
+    }
+
+    ~Ring() {release();}
+
+    Ring(const Ring &)             = delete;
+    Ring & operator=(const Ring &) = delete;
+
+    // queues sqe; the caller keeps the number of operations in flight below the ring size
+    void push(const io_uring_sqe & sqe) {
+      auto tail  = *sqTail;                                                     // only written by this process
+      auto index = tail & *sqMask;
+      sqes   [index] = sqe;
+      sqArray[index] = index;
+      std::atomic_ref<unsigned>(*sqTail).store(tail + 1, std::memory_order_release);
+      ++pending;
+    }
+
+    // submits all queued entries and waits for at least one completion
+    void submitAndWait() {
+      for (;;) {
+        auto submitted = syscall(__NR_io_uring_enter, fd, pending, 1, IORING_ENTER_GETEVENTS, nullptr, 0);
+        if (submitted >= 0   ) {pending -= submitted; return;}
+        if (errno     != EINTR) {throw std::runtime_error(THROWTEXT("    io_uring_enter failed: "s + std::strerror(errno)));}
+      }
+    }
+
+    // calls handle for each available completion
+    template<typename F>
+    void reap(F handle) {
+      auto head = *cqHead;
+      auto tail = std::atomic_ref<unsigned>(*cqTail).load(std::memory_order_acquire);
+
+      for (; head != tail; ++head) {
+        auto cqe = cqes[head & *cqMask];                                        // copy: the slot is released below
+        std::atomic_ref<unsigned>(*cqHead).store(head + 1, std::memory_order_release);
+        handle(cqe);
+      }
+    }
+  };
+
+  // ------------------------------------------------------------------------ //
+
+  // state of one file in flight: open and statx run concurrently, then the
+  // file is read in one or more reads and closed
+  struct RingJob {
+    enum Operation : uint64_t {Open, Measure, Read, Close};
+
+    size_t              index       = 0;
+    int                 fd          = -1;
+    int                 error       = 0;
+    unsigned            outstanding = 0;
+    struct statx        info;
+    std::string         text;
+    size_t              filled      = 0;
+    bool                sized       = false;                                    // size from statx is exact, else read until EOF
+  };
+#endif
+}
+
+// ========================================================================== //
+// PreadFileLoader
+
+PreadFileLoader::PreadFileLoader(size_t threads) :
+  threads(threads ? threads : std::max(1u, std::thread::hardware_concurrency()))
+{}
+// -------------------------------------------------------------------------- //
+void PreadFileLoader::load(const std::vector<std::string> & files, const Completion & done) {
+  std::atomic<size_t> next = 0;
+
+  auto work = [&] () {
+    for (auto idx = next++; idx < files.size(); idx = next++) {
+      std::string text;
+      auto error = readFile(files[idx], text);
+
+      if (error) {done(idx, std::string(), readError(files[idx], error));}
+      else       {done(idx, std::move(text), nullptr);}
+    }
+  };
+
+  std::vector<std::thread> workers;
+  for (auto i = 1u; i < std::min(threads, files.size()); ++i) {workers.emplace_back(work);}
+  work();                                                                       // the calling thread is one of the loaders
+  for (auto & worker : workers) {worker.join();}
+}
+
+// ========================================================================== //
+// IoUringFileLoader
+
+IoUringFileLoader::IoUringFileLoader(unsigned depth) :
+  depth(std::max(1u, depth))
+{}
+// -------------------------------------------------------------------------- //
+bool IoUringFileLoader::isAvailable() {
+#ifdef PARROT_IO_URING
+  static const bool available = [] () {
+    try                                   {Ring ring(2); return true;}
+    catch (const std::runtime_error &)    {return false;}
+  } ();
+  return available;
+#else
+  return false;
+#endif
+}
+// -------------------------------------------------------------------------- //
+void IoUringFileLoader::load(const std::vector<std::string> & files, const Completion & done) {
+#ifdef PARROT_IO_URING
+  if (files.empty()) {return;}
+
+  std::vector<RingJob> jobs( std::min<size_t>(depth, files.size()) );
+  Ring                 ring( 2 * jobs.size() );                                 // at most two operations per job are in flight
+  size_t               next   = 0;
+  size_t               active = 0;
+
+  auto tag = [&] (const RingJob & job, RingJob::Operation operation) {
+    return (static_cast<uint64_t>(&job - jobs.data()) << 2) | operation;
+  };
+
+  auto submit = [&] (RingJob & job, RingJob::Operation operation) {
+    io_uring_sqe sqe {};
+    sqe.user_data = tag(job, operation);
+
+    switch (operation) {
+      case RingJob::Open :
+        sqe.opcode      = IORING_OP_OPENAT;
+        sqe.fd          = AT_FDCWD;
+        sqe.addr        = reinterpret_cast<uint64_t>(files[job.index].c_str());
+        sqe.open_flags  = O_RDONLY | O_CLOEXEC;
+        break;
+      case RingJob::Measure :
+        sqe.opcode      = IORING_OP_STATX;
+        sqe.fd          = AT_FDCWD;
+        sqe.addr        = reinterpret_cast<uint64_t>(files[job.index].c_str());
+        sqe.len         = STATX_SIZE | STATX_TYPE;
+        sqe.off         = reinterpret_cast<uint64_t>(&job.info);
+        break;
+      case RingJob::Read :
+        sqe.opcode      = IORING_OP_READ;
+        sqe.fd          = job.fd;
+        sqe.addr        = reinterpret_cast<uint64_t>(job.text.data() + job.filled);
+        sqe.len         = std::min<size_t>(job.text.size() - job.filled, 1u << 30);
+        sqe.off         = job.sized ? job.filled : uint64_t(-1);                // -1: current position, also for pipes
+        break;
+      case RingJob::Close :
+        sqe.opcode      = IORING_OP_CLOSE;
+        sqe.fd          = job.fd;
+        break;
+    }
+
+    ring.push(sqe);
+    ++job.outstanding;
+  };
+
+  auto start = [&] (RingJob & job) {
+    job = RingJob();
+    job.index = next++;
+    ++active;
+    submit(job, RingJob::Open   );
+    submit(job, RingJob::Measure);
+  };
+
+  auto finish = [&] (RingJob & job) {
+    if (job.error) {done(job.index, std::string(), readError(files[job.index], job.error));}
+    else           {done(job.index, std::move(job.text), nullptr);}
+
+    --active;
+    if (next < files.size()) {start(job);}
+  };
+
+  auto closeOrFinish = [&] (RingJob & job) {
+    if (job.fd >= 0) {submit(job, RingJob::Close);}
+    else             {finish(job);}
+  };
+
+  for (auto & job : jobs) {start(job);}
+
+  while (active) {
+    ring.submitAndWait();
+    ring.reap([&] (const io_uring_cqe & cqe) {
+      auto & job       = jobs[cqe.user_data >> 2];
+      auto   operation = static_cast<RingJob::Operation>(cqe.user_data & 3);
+      --job.outstanding;
+
+      switch (operation) {
+        case RingJob::Open :
+          if (cqe.res < 0) {job.error = -cqe.res;}
+          else             {job.fd    =  cqe.res;}
+          [[fallthrough]];
+
+        case RingJob::Measure :
+          if (operation == RingJob::Measure && cqe.res < 0) {job.error = -cqe.res;}
+          if (job.outstanding) {return;}                                        // wait for the other one
+
+          if (job.error) {closeOrFinish(job); return;}
+          job.sized = S_ISREG(job.info.stx_mode) && job.info.stx_size;          // as readFile
+          job.text.resize(job.sized ? job.info.stx_size : unsizedChunk);
+          submit(job, RingJob::Read);
+          return;
+
+        case RingJob::Read :
+          if (cqe.res == -EINTR || cqe.res == -EAGAIN) {submit(job, RingJob::Read); return;}
+          if (cqe.res <  0) {job.error = -cqe.res;}
+          if (cqe.res >  0) {job.filled += cqe.res;}
+
+          if (cqe.res > 0 && !job.sized && job.filled == job.text.size()) {job.text.resize(job.filled + unsizedChunk);}
+          if (cqe.res > 0 && job.filled < job.text.size()) {submit(job, RingJob::Read); return;}
+          job.text.resize(job.filled);                                          // end of file, or file shrank since statx
+          closeOrFinish(job);
+          return;
+
+        case RingJob::Close :
+          job.fd = -1;
+          finish(job);
+          return;
+      }
+    });
+  }
+#else
+  (void) files;
+  (void) done;
+  throw std::runtime_error(THROWTEXT("    io_uring is not available on this platform"));
+#endif
+}
+
+// ========================================================================== //
+// default
+
+const std::shared_ptr<FileLoader> & Parrot::defaultFileLoader() {
+  static const std::shared_ptr<FileLoader> loader = IoUringFileLoader::isAvailable()
+                                                  ? std::shared_ptr<FileLoader>(std::make_shared<IoUringFileLoader>())
+                                                  : std::shared_ptr<FileLoader>(std::make_shared<PreadFileLoader  >());
+  return loader;
+}
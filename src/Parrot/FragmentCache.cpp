@@ -0,0 +1,43 @@
+// ========================================================================== //
+// dependencies
+
+// STL
+#include <mutex>
+
+// own
+#include "Parrot/FragmentCache.hpp"
+
+using namespace Parrot;
+
+// ========================================================================== //
+// Getters
+
+size_t FragmentCache::size() const {
+  std::shared_lock lock(mutex);
+  return entries.size();
+}
+// .......................................................................... //
+std::shared_ptr<const FragmentCache::Fragment> FragmentCache::find(const std::string & path, const std::string & section, bool collectErrors,
+                                                                   std::filesystem::file_time_type modified, std::uintmax_t size) const {
+  std::shared_lock lock(mutex);
+
+  auto it = entries.find({path, section, collectErrors});
+  if (it == entries.end() || it->second.modified != modified || it->second.size != size) {return nullptr;}
+
+  return it->second.fragment;
+}
+
+// ========================================================================== //
+// Setters
+
+void FragmentCache::store(const std::string & path, const std::string & section, bool collectErrors,
+                          std::filesystem::file_time_type modified, std::uintmax_t size,
+                          std::shared_ptr<const Fragment> fragment) const {
+  std::unique_lock lock(mutex);
+  entries.insert_or_assign({path, section, collectErrors}, Entry {modified, size, std::move(fragment)});
+}
+// .......................................................................... //
+void FragmentCache::clear() const {
+  std::unique_lock lock(mutex);
+  entries.clear();
+}
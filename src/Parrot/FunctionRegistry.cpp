@@ -0,0 +1,72 @@
+// ========================================================================== //
+// dependencies
+
+// STL
+#include <stdexcept>
+
+#include <string>
+using namespace std::string_literals;
+
+// own
+#include "BCG.hpp"
+#include "Parrot/FunctionRegistry.hpp"
+
+using namespace Parrot;
+
+// ========================================================================== //
+// local macro
+
+#define THROWTEXT(msg) ("RUNTIME EXCEPTION IN "s + (__PRETTY_FUNCTION__) + "\n"s + msg)
+
+// ========================================================================== //
+// private functions
+
+std::string FunctionRegistry::normalize(const std::string & keyword) {
+  auto reVal = keyword;
+  BCG::trim        (reVal);
+  BCG::to_uppercase(reVal);
+  return reVal;
+}
+
+// ========================================================================== //
+// Getters
+
+FunctionRegistry::PreParser         FunctionRegistry::getPreParser        (const std::string & keyword) const {
+  auto it = preParsers.find( normalize(keyword) );
+  return it == preParsers.end() ? PreParser() : it->second;
+}
+// .......................................................................... //
+FunctionRegistry::PreParseFunction  FunctionRegistry::getPreParseFunction (const std::string & keyword, size_t index) const {
+  auto it = preParseFunctions.find( normalize(keyword) );
+  if (it == preParseFunctions.end() || index >= it->second.size()) {
+    throw InvalidFunctionError(THROWTEXT("    no pre-parse validation function #" + std::to_string(index) + " registered for keyword '" + keyword + "'"));
+  }
+  return it->second[index];
+}
+// .......................................................................... //
+const FunctionRegistry::Binder &    FunctionRegistry::getAftParseFunction (const std::string & keyword, size_t index) const {
+  auto it = aftParseFunctions.find( normalize(keyword) );
+  if (it == aftParseFunctions.end() || index >= it->second.size()) {
+    throw InvalidFunctionError(THROWTEXT("    no after-parse validation function #" + std::to_string(index) + " registered for keyword '" + keyword + "'"));
+  }
+  return it->second[index];
+}
+
+// ========================================================================== //
+// Setters
+
+void FunctionRegistry::setPreParser        (const std::string & keyword, const PreParser & uFunc) {
+  if ( !uFunc ) {throw InvalidFunctionError(THROWTEXT("    Uninitialized preparser for keyword '" + keyword + "'"));}
+  preParsers[normalize(keyword)] = uFunc;
+}
+// .......................................................................... //
+void FunctionRegistry::addPreParseFunction (const std::string & keyword, const PreParseFunction & uFunc) {
+  if ( !uFunc ) {throw InvalidFunctionError(THROWTEXT("    Uninitialized validation function for keyword '" + keyword + "'"));}
+  preParseFunctions[normalize(keyword)].push_back(uFunc);
+}
+// -------------------------------------------------------------------------- //
+void FunctionRegistry::clear() {
+  preParsers       .clear();
+  preParseFunctions.clear();
+  aftParseFunctions.clear();
+}
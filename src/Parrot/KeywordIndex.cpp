@@ -0,0 +1,167 @@
+// ========================================================================== //
+// dependencies
+
+// STL
+#include <stdexcept>
+
+#include <fstream>
+#include <filesystem>
+
+#include <string>
+using namespace std::string_literals;
+
+#include <algorithm>
+
+// own
+#include "Parrot/KeywordIndex.hpp"
+
+using namespace Parrot;
+
+// ========================================================================== //
+// local macro
+
+#define THROWTEXT(msg) ("RUNTIME EXCEPTION IN "s + (__PRETTY_FUNCTION__) + "\n"s + msg)
+
+// ========================================================================== //
+// local helpers
+
+namespace {
+  const std::string indexFileMagic = "PARROT-KEYWORDINDEX 1";
+
+  void        writeString(std::ostream & hFile, const std::string & text) {hFile << text.size() << ' ' << text;}
+  std::string readString (std::istream & hFile) {
+    size_t length = 0;
+    hFile >> length;
+    hFile.get();                                                                // separating blank
+
+    std::string reVal(length, '\0');
+    hFile.read(reVal.data(), length);
+    return reVal;
+  }
+
+  std::int64_t fileTimeOf(const std::string & source) {
+    return std::filesystem::last_write_time(source).time_since_epoch().count();
+  }
+}
+
+// ========================================================================== //
+// CTors
+
+KeywordIndex KeywordIndex::load(const std::string & filename) {
+  std::ifstream hFile(filename, std::ios::binary);
+  if (!hFile) {throw std::runtime_error(THROWTEXT("    could not open '" + filename + "'"));}
+
+  std::string magic;
+  std::getline(hFile, magic);
+  if (magic != indexFileMagic) {throw std::runtime_error(THROWTEXT("    '" + filename + "' is not a keyword index"));}
+
+  KeywordIndex reVal;
+  size_t       N = 0;
+
+  reVal.source    = readString(hFile);
+  hFile >> reVal.fileSize >> reVal.fileTime;
+  reVal.signature = readString(hFile);
+  hFile >> N;
+
+  for (auto i = 0u; i < N; ++i) {
+    auto   keyword = readString(hFile);
+    auto & entry   = reVal.entries[keyword];
+    size_t spans   = 0;
+
+    entry.section  = readString(hFile);
+    hFile >> spans;
+    entry.spans.resize(spans);
+    for (auto & span : entry.spans) {hFile >> span.offset >> span.length >> span.firstLine;}
+  }
+
+  if (!hFile) {throw std::runtime_error(THROWTEXT("    '" + filename + "' is truncated"));}
+
+  return reVal;
+}
+
+// ========================================================================== //
+// Getters
+
+const std::string &                                 KeywordIndex::getSource    ()                            const {return source          ;}
+const std::string &                                 KeywordIndex::getSignature ()                            const {return signature       ;}
+size_t                                              KeywordIndex::size         ()                            const {return entries.size()  ;}
+bool                                                KeywordIndex::hasKeyword   (const std::string & keyword) const {return entries.contains(keyword);}
+const KeywordIndex::Entry *                         KeywordIndex::find         (const std::string & keyword) const {
+  auto it = entries.find(keyword);
+  return it == entries.end() ? nullptr : &(it->second);
+}
+std::vector<std::string>                            KeywordIndex::getKeywords  ()                            const {
+  std::vector<std::string> reVal(entries.size());
+
+  std::transform(entries.begin(), entries.end(),
+                 reVal  .begin(),
+                 [] (const auto & pair) {return pair.first;}
+  );
+
+  return reVal;
+}
+const std::map<std::string, KeywordIndex::Entry> &  KeywordIndex::getEntries   ()                            const {return entries         ;}
+// -------------------------------------------------------------------------- //
+bool KeywordIndex::isCurrent(const std::string & source, const std::string & signature) const {
+  std::error_code error;
+
+  auto size = std::filesystem::file_size(source, error);
+  if (error) {return false;}
+
+  return source    == this->source    &&
+         signature == this->signature &&
+         size      == fileSize        &&
+         fileTimeOf(source) == fileTime;
+}
+
+// ========================================================================== //
+// Setters
+
+void KeywordIndex::reset() {
+  entries  .clear();
+  source   .clear();
+  signature.clear();
+  fileSize = 0;
+  fileTime = 0;
+}
+// -------------------------------------------------------------------------- //
+void KeywordIndex::setSource (const std::string & source, const std::string & signature) {
+  std::error_code error;
+
+  auto size = std::filesystem::file_size(source, error);
+  if (error) {throw std::runtime_error(THROWTEXT("    could not access '" + source + "'"));}
+
+  this->source    = source;
+  this->signature = signature;
+  fileSize        = size;
+  fileTime        = fileTimeOf(source);
+}
+// .......................................................................... //
+void KeywordIndex::add       (const std::string & keyword, const std::string & section, const Span & span) {
+  auto & entry = entries[keyword];
+  entry.section = section;
+  entry.spans.push_back(span);
+}
+
+// ========================================================================== //
+// I/O
+
+void KeywordIndex::save(const std::string & filename) const {
+  std::ofstream hFile(filename, std::ios::binary);
+  if (!hFile) {throw std::runtime_error(THROWTEXT("    could not open '" + filename + "' for writing"));}
+
+  hFile << indexFileMagic << '\n';
+  writeString(hFile, source);                         hFile << '\n';
+  hFile << fileSize << ' ' << fileTime                      << '\n';
+  writeString(hFile, signature);                      hFile << '\n';
+  hFile << entries.size()                                   << '\n';
+
+  for (const auto & [keyword, entry] : entries) {
+    writeString(hFile, keyword      ); hFile << ' ';
+    writeString(hFile, entry.section); hFile << ' ' << entry.spans.size();
+    for (const auto & span : entry.spans) {hFile << ' ' << span.offset << ' ' << span.length << ' ' << span.firstLine;}
+    hFile << '\n';
+  }
+
+  if (!hFile) {throw std::runtime_error(THROWTEXT("    could not write '" + filename + "'"));}
+}
@@ -0,0 +1,65 @@
+// ========================================================================== //
+// dependencies
+
+// STL
+#include <stdexcept>
+
+#include <string>
+using namespace std::string_literals;
+
+// own
+#include "Parrot/KeywordTable.hpp"
+
+using namespace Parrot;
+
+// ========================================================================== //
+// local macro
+
+#define THROWTEXT(msg) ("RUNTIME EXCEPTION IN "s + (__PRETTY_FUNCTION__) + "\n"s + msg)
+
+// ========================================================================== //
+// CTors
+
+KeywordTable::KeywordTable(const KeywordTable & other) {*this = other;}
+// .......................................................................... //
+KeywordTable & KeywordTable::operator= (const KeywordTable & other) {
+  if (this == &other) {return *this;}
+
+  clear();
+  for (const auto & name : other.names) {intern(name);}                         // rebuild the views into our own names
+
+  return *this;
+}
+
+// ========================================================================== //
+// Getters
+
+size_t              KeywordTable::size    ()                         const {return names.size();}
+bool                KeywordTable::contains(std::string_view keyword) const {return ids.contains(keyword);}
+KeywordTable::ID    KeywordTable::find    (std::string_view keyword) const {
+  auto it = ids.find(keyword);
+  return it == ids.end() ? npos : it->second;
+}
+const std::string & KeywordTable::name    (ID id)                    const {
+  if (id >= names.size()) {throw std::out_of_range(THROWTEXT("    invalid keyword ID " + std::to_string(id)));}
+  return names[id];
+}
+
+// ========================================================================== //
+// Setters
+
+KeywordTable::ID    KeywordTable::intern  (const std::string & keyword) {
+  auto id = find(keyword);
+  if (id != npos) {return id;}
+
+  id = names.size();
+  names.push_back(keyword);
+  ids.emplace(names.back(), id);
+
+  return id;
+}
+// .......................................................................... //
+void                KeywordTable::clear   () {
+  ids  .clear();
+  names.clear();
+}
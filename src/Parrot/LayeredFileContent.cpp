@@ -0,0 +1,116 @@
+// ========================================================================== //
+// dependencies
+
+// STL
+#include <stdexcept>
+
+#include <string>
+using namespace std::string_literals;
+
+#include <algorithm>
+
+// own
+#include "BCG.hpp"
+#include "Parrot/LayeredFileContent.hpp"
+
+using namespace Parrot;
+
+// ========================================================================== //
+// local macro
+
+#define THROWTEXT(msg) ("RUNTIME EXCEPTION IN "s + (__PRETTY_FUNCTION__) + "\n"s + msg)
+
+// ========================================================================== //
+// Private Functions
+
+const LayeredFileContent::Location & LayeredFileContent::locate(const std::string & key) const {
+  auto it = index.find(key);
+  if (it == index.end()) {throw ValueAccessError(THROWTEXT("    keyword '" + key + "' does not exist in any layer."));}
+  return it->second;
+}
+
+// ========================================================================== //
+// CTors
+
+LayeredFileContent::LayeredFileContent(std::vector<FileContent> && layers) {
+  for (auto & layer : layers) {addLayer( std::move(layer) );}
+}
+
+// ========================================================================== //
+// Getters
+
+size_t                                                    LayeredFileContent::getLayerCount() const {return layers.size();}
+const std::vector<std::shared_ptr<const FileContent>> &   LayeredFileContent::getLayers    () const {return layers;}
+const FileContent &                                       LayeredFileContent::getLayer     (size_t idx) const {
+  if (idx >= layers.size()) {throw ValueAccessError(THROWTEXT("    no layer " + std::to_string(idx) + "."));}
+  return *layers[idx];
+}
+// -------------------------------------------------------------------------- //
+bool                                LayeredFileContent::empty        () const {return index.empty();}
+size_t                              LayeredFileContent::size         () const {return index.size();}
+bool                                LayeredFileContent::hasKeyword   (const std::string & key) const {return index.contains(key);}
+std::vector<std::string>            LayeredFileContent::getKeywords  () const {
+  std::vector<std::string> reVal;
+  reVal.reserve(index.size());
+
+  for (const auto & [key, location] : index) {reVal.push_back(key);}
+
+  std::sort(reVal.begin(), reVal.end());
+  return reVal;
+}
+// .......................................................................... //
+const FileContent::ContentType &    LayeredFileContent::get          (const std::string & key) const {return                                 *locate(key).data ;}
+const std::any &                    LayeredFileContent::getAny       (const std::string & key) const {return std::get<FileContent::Value    >(*locate(key).data);}
+ValueTypeID                         LayeredFileContent::getValueType (const std::string & key) const {return std::get<FileContent::ValueType>(*locate(key).data);}
+LayeredFileContent::Provenance      LayeredFileContent::getProvenance(const std::string & key) const {
+  const auto & location = locate(key);
+  const auto & layer    = *layers[location.layer];
+
+  return {location.layer, layer.getSource(), layer.getLine(key)};
+}
+
+// ========================================================================== //
+// Value Access
+
+FileContent::TypeConverterClass LayeredFileContent::operator[](const std::string & key) const {return getAny(key);}
+
+// ========================================================================== //
+// Setters
+
+void LayeredFileContent::addLayer(FileContent && layer) {addLayer( std::make_shared<const FileContent>(std::move(layer)) );}
+// .......................................................................... //
+void LayeredFileContent::addLayer(std::shared_ptr<const FileContent> layer) {
+  if (!layer) {throw std::invalid_argument(THROWTEXT("    no layer given"));}
+
+  auto idx = layers.size();
+  for (const auto & key : layer->getKeywords()) {
+    auto data = layer->find(key);
+    auto it   = index.find(key);
+
+    if (it == index.end()) {index.emplace(key, Location {idx, data}); continue;}
+
+    // a default filled in by the Reader does not hide a value from a file
+    if ( std::get<FileContent::FoundInFile>(*data) || !std::get<FileContent::FoundInFile>(*it->second.data) ) {it->second = {idx, data};}
+  }
+
+  layers.push_back( std::move(layer) );
+}
+// -------------------------------------------------------------------------- //
+FileContent LayeredFileContent::flatten(const std::string & source) const {
+  auto sameTable = !layers.empty() && std::all_of(layers.begin(), layers.end(), [this] (const auto & layer) {
+    return layer->getKeywordTable() == layers.front()->getKeywordTable();
+  });
+  auto keywords  = sameTable ? layers.front()->getKeywordTable() : nullptr;
+
+  FileContent reVal(source, keywords, std::pmr::get_default_resource());
+
+  for (const auto & [key, location] : index) {
+    const auto & [value, valueType, foundInFile, triggeredWarning] = *location.data;
+
+    if (value.has_value()) {reVal.setElement(key, value    , foundInFile, triggeredWarning);}
+    else                   {reVal.setElement(key, valueType, foundInFile, triggeredWarning);}
+    reVal.setLine(key, layers[location.layer]->getLine(key));
+  }
+
+  return reVal;
+}
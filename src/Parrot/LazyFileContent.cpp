@@ -0,0 +1,90 @@
+// ========================================================================== //
+// dependencies
+
+// STL
+#include <stdexcept>
+
+#include <string>
+using namespace std::string_literals;
+
+#include <algorithm>
+
+// own
+#include "BCG.hpp"
+#include "Parrot/LazyFileContent.hpp"
+
+using namespace Parrot;
+
+// ========================================================================== //
+// local macro
+
+#define THROWTEXT(msg) ("RUNTIME EXCEPTION IN "s + (__PRETTY_FUNCTION__) + "\n"s + msg)
+
+// ========================================================================== //
+// private functions
+
+std::string LazyFileContent::normalize (const std::string & key) const {
+  auto reVal = key;
+  BCG::trim(reVal);
+  if ( !reader.getKeywordCaseSensitive() ) {BCG::to_uppercase(reVal);}
+  return reVal;
+}
+// .......................................................................... //
+void        LazyFileContent::resolve   (const std::string & key) const {
+  if ( resolved.contains(key) ) {return;}
+
+  reader.parseIndexed(hFile, key, index.find(key), content);
+  resolved.insert(key);
+}
+
+// ========================================================================== //
+// CTors
+
+LazyFileContent::LazyFileContent(const Reader & reader, const KeywordIndex & index) :
+  reader (reader),
+  index  (index),
+  hFile  (index.getSource(), std::ios::in | std::ios::binary),
+  content(index.getSource(), reader.getKeywordTable())
+{
+  if (!hFile) {throw std::runtime_error(THROWTEXT("    could not open '" + index.getSource() + "'"));}
+}
+
+// ========================================================================== //
+// Getters
+
+const std::string &             LazyFileContent::getSource   ()                        const {return index.getSource();}
+const KeywordIndex &            LazyFileContent::getIndex    ()                        const {return index;}
+// -------------------------------------------------------------------------- //
+bool                            LazyFileContent::hasKeyword  (const std::string & key) const {
+  auto normalized = normalize(key);
+  return index.hasKeyword(normalized) || reader.hasKeyword(normalized);
+}
+bool                            LazyFileContent::isParsed    (const std::string & key) const {return resolved.contains( normalize(key) );}
+std::vector<std::string>        LazyFileContent::getKeywords ()                        const {
+  auto reVal = index.getKeywords();
+
+  for (const auto & descriptor : reader.getDescriptors()) {reVal.push_back(descriptor.getQualifiedKey());}
+  std::sort(reVal.begin(), reVal.end());
+  reVal.erase( std::unique(reVal.begin(), reVal.end()), reVal.end() );
+
+  return reVal;
+}
+// -------------------------------------------------------------------------- //
+FileContent::ContentType        LazyFileContent::get         (const std::string & key) const {
+  auto normalized = normalize(key);
+  resolve(normalized);
+  return content.get(normalized);
+}
+std::any                        LazyFileContent::getAny      (const std::string & key) const {return std::get<FileContent::Value    >(get(key));}
+ValueTypeID                     LazyFileContent::getValueType(const std::string & key) const {return std::get<FileContent::ValueType>(get(key));}
+// -------------------------------------------------------------------------- //
+const FileContent &             LazyFileContent::getParsed   ()                        const {return content;}
+const FileContent &             LazyFileContent::materialize ()                        const {
+  for (const auto & key : getKeywords()) {resolve(key);}
+  return content;
+}
+
+// ========================================================================== //
+// Value Access
+
+FileContent::TypeConverterClass LazyFileContent::operator[]  (const std::string & key) const {return getAny(key);}
@@ -0,0 +1,40 @@
+// ========================================================================== //
+// dependencies
+
+// STL
+#include <string>
+using namespace std::string_literals;
+
+// own
+#include "BCG.hpp"
+#include "Parrot/ParseAwaitable.hpp"
+#include "Parrot/Reader.hpp"
+
+using namespace Parrot;
+
+// ========================================================================== //
+// CTor
+
+ParseAwaitable::ParseAwaitable(const Reader * reader, const std::string & source, const CancellationToken & token) :
+  reader(reader),
+  source(source),
+  token (token)
+{}
+
+// ========================================================================== //
+// awaitable interface
+
+bool ParseAwaitable::await_ready() const noexcept {return false;}
+// .......................................................................... //
+void ParseAwaitable::await_suspend(std::coroutine_handle<> handle) {
+  reader->submitParse(source, token, [this, handle] (FileContent * content, std::exception_ptr error) {
+    if (content) {result = std::move(*content);}
+    this->error = error;
+    handle.resume();                                                            // may destroy this object; nothing is touched afterwards
+  });
+}
+// .......................................................................... //
+FileContent ParseAwaitable::await_resume() {
+  if (error) {std::rethrow_exception(error);}
+  return std::move(result);
+}
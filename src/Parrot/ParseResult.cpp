@@ -0,0 +1,72 @@
+// ========================================================================== //
+// dependencies
+
+// STL
+#include <stdexcept>
+
+#include <string>
+using namespace std::string_literals;
+
+#include <algorithm>
+
+// own
+#include "BCG.hpp"
+#include "Parrot/ParseResult.hpp"
+
+using namespace Parrot;
+
+// ========================================================================== //
+// local macro
+
+#define THROWTEXT(msg) ("RUNTIME EXCEPTION IN "s + (__PRETTY_FUNCTION__) + "\n"s + msg)
+
+// ========================================================================== //
+// ParseError
+
+std::string ParseError::message() const {
+  auto reVal = messageTemplate;
+
+  BCG::replaceAll(reVal, "$F", file);
+  BCG::replaceAll(reVal, "$L", lineText);
+  BCG::replaceAll(reVal, "$#", std::to_string(line));
+  BCG::replaceAll(reVal, "$K", keyword);
+  BCG::replaceAll(reVal, "$D", defaultValue);
+  BCG::replaceAll(reVal, "$V", readValue);
+  BCG::replaceAll(reVal, "$T", typeName);
+
+  return reVal;
+}
+
+// ========================================================================== //
+// CTors
+
+ParseResult::ParseResult(FileContent && content, std::vector<ParseError> && errors) :
+  content(std::move(content)),
+  errors (std::move(errors ))
+{}
+
+// ========================================================================== //
+// Getters
+
+bool                            ParseResult::ok           () const {return errors.empty();}
+                                ParseResult::operator bool() const {return errors.empty();}
+// -------------------------------------------------------------------------- //
+const FileContent &             ParseResult::value        () const {
+  if ( !ok() ) {
+    throw ValueAccessError(THROWTEXT("    parse of '" + content.getSource() + "' failed with " + std::to_string(errors.size()) + " error(s); first error:\n" + errors[0].message()));
+  }
+  return content;
+}
+const FileContent &             ParseResult::getContent   () const {return content;}
+const std::vector<ParseError> & ParseResult::getErrors    () const {return errors ;}
+// .......................................................................... //
+std::vector<std::string>        ParseResult::getMessages  () const {
+  std::vector<std::string> reVal(errors.size());
+
+  std::transform(errors.begin(), errors.end(),
+                 reVal .begin(),
+                 [] (const auto & error) {return error.message();}
+  );
+
+  return reVal;
+}
@@ -0,0 +1,178 @@
+// ========================================================================== //
+// dependencies
+
+// STL
+#include <stdexcept>
+
+#include <string>
+using namespace std::string_literals;
+
+#include <algorithm>
+#include <numeric>
+
+// own
+#include "BCG.hpp"
+#include "Parrot/ParseStats.hpp"
+
+using namespace Parrot;
+
+// ========================================================================== //
+// local macro
+
+#define THROWTEXT(msg) ("RUNTIME EXCEPTION IN "s + (__PRETTY_FUNCTION__) + "\n"s + msg)
+
+// ========================================================================== //
+// lookups
+
+const std::string Parrot::parseStageName(const ParseStage & T) {
+  switch (T) {
+    case ParseStage::SplitLine                 : return "splitLine";
+    case ParseStage::IdentifyKeyword           : return "identifyKeyword";
+    case ParseStage::DuplicateCheck            : return "duplicateCheck";
+    case ParseStage::Preparse                  : return "preparse";
+    case ParseStage::ApplyPreParseRestrictions : return "applyPreParseRestrictions";
+    case ParseStage::ConvertToTargetType       : return "convertToTargetType";
+    case ParseStage::ApplyAftParseRestrictions : return "applyAftParseRestrictions";
+    default                                    : return "(invalid state)";
+  }
+}
+
+// ========================================================================== //
+// local helper
+
+namespace {
+  std::string microsecondsText(ParseStats::Duration time) {
+    return std::to_string( std::chrono::duration_cast<std::chrono::microseconds>(time).count() );
+  }
+}
+
+// ========================================================================== //
+// Getters
+
+const ParseStats::StageRecord &                               ParseStats::getStage      (const ParseStage & stage) const {
+  auto idx = static_cast<size_t>(stage);
+  if (idx >= ParseStageCount) {throw std::out_of_range(THROWTEXT("    invalid parse stage!"));}
+  return stages[idx];
+}
+const std::map<std::string, ParseStats::KeywordRecord> &      ParseStats::getKeywords   () const {return keywords ;}
+ParseStats::Duration                                          ParseStats::getIOTime     () const {return ioTime   ;}
+ParseStats::Duration                                          ParseStats::getTotalTime  () const {return totalTime;}
+ParseStats::Duration                                          ParseStats::getParserTime () const {
+  return std::accumulate(stages.begin(), stages.end(),
+                         Duration::zero(),
+                         [] (const auto & acc, const auto & elm) {return acc + elm.time;}
+  );
+}
+ParseStats::Duration                                          ParseStats::getUserTime   () const {
+  return std::accumulate(keywords.begin(), keywords.end(),
+                         Duration::zero(),
+                         [] (const auto & acc, const auto & elm) {return acc + elm.second.userPreParserTime + elm.second.userRestrictionTime;}
+  );
+}
+size_t                                                        ParseStats::getFileCount  () const {return files    ;}
+size_t                                                        ParseStats::getLineCount  () const {return lines    ;}
+
+// ========================================================================== //
+// Setters
+
+void ParseStats::reset() {
+  stages    = {};
+  keywords  .clear();
+  ioTime    = Duration::zero();
+  totalTime = Duration::zero();
+  files     = 0;
+  lines     = 0;
+}
+// -------------------------------------------------------------------------- //
+void ParseStats::addStageTime           (const ParseStage & stage, Duration time) {
+  auto & record = stages[static_cast<size_t>(stage)];
+  record.time  += time;
+  ++record.calls;
+}
+// .......................................................................... //
+void ParseStats::addUserPreParserTime   (const std::string & keyword, Duration time) {
+  auto & record = keywords[keyword];
+  record.userPreParserTime += time;
+  ++record.userPreParserCalls;
+}
+// .......................................................................... //
+void ParseStats::addUserRestrictionTime (const std::string & keyword, Duration time) {
+  auto & record = keywords[keyword];
+  record.userRestrictionTime += time;
+  ++record.userRestrictionCalls;
+}
+// .......................................................................... //
+void ParseStats::addIOTime              (Duration time)               {ioTime += time;}
+void ParseStats::addFile                (Duration time, size_t lines) {
+  totalTime   += time;
+  this->lines += lines;
+  ++files;
+}
+// .......................................................................... //
+void ParseStats::merge                  (const ParseStats & other) {
+  for (auto i = 0u; i < ParseStageCount; ++i) {
+    stages[i].time  += other.stages[i].time;
+    stages[i].calls += other.stages[i].calls;
+  }
+
+  for (const auto & [keyword, record] : other.keywords) {
+    auto & target = keywords[keyword];
+    target.userPreParserTime    += record.userPreParserTime;
+    target.userPreParserCalls   += record.userPreParserCalls;
+    target.userRestrictionTime  += record.userRestrictionTime;
+    target.userRestrictionCalls += record.userRestrictionCalls;
+  }
+
+  ioTime    += other.ioTime;
+  totalTime += other.totalTime;
+  files     += other.files;
+  lines     += other.lines;
+}
+
+// ========================================================================== //
+// Representation
+
+std::string ParseStats::to_string() const {
+  size_t wNames = ("step"s).size();
+  for (auto i = 0u; i < ParseStageCount; ++i) {
+    wNames = std::max(wNames, parseStageName( static_cast<ParseStage>(i) ).size());
+  }
+  for (const auto & [keyword, record] : keywords) {
+    wNames = std::max(wNames, keyword.size() + (" (restriction)"s).size());
+  }
+
+  const size_t wTime  = 12;
+  const size_t wCalls = 10;
+
+  auto row = [&] (const std::string & name, Duration time, size_t calls) {
+    return BCG::justifyLeft(name                     , wNames) + " | " +
+           BCG::justifyLeft(microsecondsText(time)   , wTime ) + " | " +
+                            std::to_string   (calls)           + "\n";
+  };
+
+  std::string reVal = "Parrot::ParseStats object (" + std::to_string(files) + " files, " + std::to_string(lines) + " lines)\n";
+
+  reVal += BCG::center("step"     , wNames) + " | " +
+           BCG::center("time [us]", wTime ) + " | " +
+           BCG::center("calls"    , wCalls) + "\n";
+  reVal += std::string(wNames + 1, '-') + "+" +
+           std::string(wTime  + 2, '-') + "+" +
+           std::string(wCalls + 1, '-') + "\n";
+
+  for (auto i = 0u; i < ParseStageCount; ++i) {
+    reVal += row(parseStageName( static_cast<ParseStage>(i) ), stages[i].time, stages[i].calls);
+  }
+
+  reVal += BCG::justifyLeft("I/O"  , wNames) + " | " + microsecondsText(ioTime   ) + "\n";
+  reVal += BCG::justifyLeft("total", wNames) + " | " + microsecondsText(totalTime) + "\n";
+
+  if ( !keywords.empty() ) {
+    reVal += "time spent in user functions (included in preparse and applyPreParseRestrictions):\n";
+    for (const auto & [keyword, record] : keywords) {
+      if (record.userPreParserCalls  ) {reVal += row(keyword + " (preparser)"  , record.userPreParserTime  , record.userPreParserCalls  );}
+      if (record.userRestrictionCalls) {reVal += row(keyword + " (restriction)", record.userRestrictionTime, record.userRestrictionCalls);}
+    }
+  }
+
+  return reVal;
+}
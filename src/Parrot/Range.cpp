@@ -0,0 +1,90 @@
+// ========================================================================== //
+// dependencies
+
+// STL
+#include <stdexcept>
+
+#include <string>
+using namespace std::string_literals;
+
+#include <cmath>
+#include <sstream>
+
+// own
+#include "Parrot/Range.hpp"
+
+using namespace Parrot;
+
+// ========================================================================== //
+// local macro
+
+#define THROWTEXT(msg) ("RUNTIME EXCEPTION IN "s + (__PRETTY_FUNCTION__) + "\n"s + msg)
+
+// ========================================================================== //
+// CTors
+
+RealRange::RealRange(double start, double stop, size_t count) :
+  start(start),
+  stop (count > 1 ? stop : start),
+  count(count)
+{}
+// .......................................................................... //
+RealRange RealRange::fromStep(double start, double stop, double step) {
+  const auto width = stop - start;
+
+  if ( step == 0 || (std::signbit(step) != std::signbit(width) && width != 0) ) {
+    throw std::invalid_argument(THROWTEXT("    step " + std::to_string(step) + " does not lead from " + std::to_string(start) + " to " + std::to_string(stop)));
+  }
+
+  const auto intervals = static_cast<size_t>( std::floor(width / step + 1e-9) );    // tolerate rounding in width / step
+
+  return RealRange(start, start + intervals * step, intervals + 1);
+}
+
+// ========================================================================== //
+// Getters
+
+double RealRange::getStart() const {return start;}
+double RealRange::getStop () const {return stop ;}
+double RealRange::getStep () const {return count > 1 ? (stop - start) / (count - 1) : 0;}
+// -------------------------------------------------------------------------- //
+size_t RealRange::size    () const {return count;}
+bool   RealRange::empty   () const {return count == 0;}
+// -------------------------------------------------------------------------- //
+double RealRange::min     () const {
+  if (empty()) {throw std::out_of_range(THROWTEXT("    empty range"));}
+  return std::fmin(start, stop);
+}
+double RealRange::max     () const {
+  if (empty()) {throw std::out_of_range(THROWTEXT("    empty range"));}
+  return std::fmax(start, stop);
+}
+
+// ========================================================================== //
+// Element Access
+
+double RealRange::operator[] (size_t index) const {
+  if (index + 1 >= count) {return index ? stop : start;}
+  return std::lerp(start, stop, static_cast<double>(index) / (count - 1));
+}
+double RealRange::at         (size_t index) const {
+  if (index >= count) {throw std::out_of_range(THROWTEXT("    index " + std::to_string(index) + " out of range"));}
+  return (*this)[index];
+}
+// -------------------------------------------------------------------------- //
+RealRange::const_iterator RealRange::begin() const {return const_iterator(this, 0    );}
+RealRange::const_iterator RealRange::end  () const {return const_iterator(this, count);}
+// -------------------------------------------------------------------------- //
+std::vector<double> RealRange::materialize() const {return std::vector<double>(begin(), end());}
+
+// ========================================================================== //
+// Representation
+
+std::string RealRange::to_string() const {
+  std::stringstream stream;
+  stream << start << ":" << stop << ":" << count;
+  return stream.str();
+}
+// .......................................................................... //
+bool RealRange::operator== (const RealRange & other) const {return start == other.start && stop == other.stop && count == other.count;}
+bool RealRange::operator!= (const RealRange & other) const {return !(*this == other);}
@@ -5,16 +5,45 @@
 #include <stdexcept>
 
 #include <string>
+#include <string_view>
 using namespace std::string_literals;
 
 #include <tuple>
+#include <unordered_set>
+#include <sstream>
+#include <memory_resource>
+#include <filesystem>
+#include <streambuf>
+#include <exception>
+#include <future>
+#include <fstream>
+
+#include <thread>
+#include <atomic>
+#include <mutex>
+#include <condition_variable>
 
 #include <algorithm>
+#include <cmath>
+#include <limits>
+#include <cstring>
 
 // own
 #include "BCG.hpp"
 #include "Parrot/Reader.hpp"
 #include "Parrot/FileContent.hpp"
+#include "Parrot/ParseStats.hpp"
+#include "Parrot/Diagnostics.hpp"
+#include "Parrot/ParseResult.hpp"
+#include "Parrot/KeywordIndex.hpp"
+#include "Parrot/LazyFileContent.hpp"
+#include "Parrot/Expression.hpp"
+#include "Parrot/Schema.hpp"
+#include "Parrot/Executor.hpp"
+#include "Parrot/FileLoader.hpp"
+#include "Parrot/DirectoryParseResult.hpp"
+#include "Parrot/FragmentCache.hpp"
+#include "Parrot/ParseAwaitable.hpp"
 
 using namespace Parrot;
 
@@ -27,32 +56,165 @@ using namespace Parrot;
 // Parsing machinery definitions
 
 // -------------------------------------------------------------------------- //
-// Module globals aka state variables, non-exposed
+// Parallel parsing: a file is split into chunks of complete logical lines.
+// Workers do not write to the content, the sink or the error list but record
+// what they would have done as events, which are replayed in file order.
+
+namespace {
+  enum class ParseEventType {
+    Store,                                                                      // contentPtr->addElement
+    Update,                                                                     // contentPtr->updateElement
+    Warning,                                                                    // sinkPtr->write
+    Error,                                                                      // errorsPtr->push_back
+    Exception,                                                                  // rethrow
+    FirstOccurrence,                                                            // first occurrence of a keyword within the chunk, see parseMerge
+    Validate,                                                                   // pendingPtr->push_back, see parseDefer
+    Include                                                                     // parseSplice, see parseInclude
+  };
+
+  struct ParseEvent {
+    ParseEventType      type;
+    std::string         keyword;                                                // Store, Update, FirstOccurrence, Validate
+    std::any            value;                                                  // Store, Update, Validate (empty if superseded)
+    bool                inFile    = false;                                      // Store, Update
+    bool                handled   = false;                                      // Store, Update, Validate
+    DiagnosticRecord    record;                                                 // Warning
+    ParseError          error;                                                  // Error
+    std::exception_ptr  exception;                                              // Exception
+
+    size_t              keywordID = -1;                                         // Store, Update; FirstOccurrence, Validate: state before duplicateCheck ...
+    int                 line      = 0;                                          // ... also Store, Update
+    std::string         lineOriginal;
+    std::string         readValue;
+    size_t              groupSize = 0;                                          // ... and number of events caused by the rest of the line
+
+    std::string         file;                                                   // Validate: file of the keyword; Include: included file
+    std::string         section;                                                // Include: section in effect at the directive
+
+    ParseEvent(ParseEventType type) : type(type) {}
+  };
+
+  struct ParseChunk {
+    size_t                  begin     = 0;                                      // byte offsets into the file
+    size_t                  end       = 0;
+    int                     firstLine = 0;                                      // number of lines before the chunk
+    std::string             section;                                            // section in effect at begin
+    std::string             file;                                               // file the lines stem from, if not the parsed one
+
+    std::vector<ParseEvent> events;
+    size_t                  group     = -1;                                     // index of the open FirstOccurrence event
+    size_t                  linesRead = 0;
+    ParseStats              stats;
+  };
+
+  struct MemoryBuffer : public std::streambuf {                                 // reads a chunk without copying it
+    MemoryBuffer(const char * begin, const char * end) {
+      auto data = const_cast<char *>(begin);
+      setg(data, data, data + (end - begin));
+    }
+  };
+}
+
+struct FragmentCache::Fragment {                                                // an included file, parsed as one chunk
+  ParseChunk chunk;
+};
 
-std::string       filename                      ;                               // $F
-std::string       lineOriginal                  ;                               // $L
-std::string       currentKeyword                ;                               // $K
-std::string       defaultValue                  ;                               // $D
-std::string       readValue                     ;                               // $V
-ValueTypeID       valueTypeID                   ;                               //
-std::string       valueTypeString               ;                               // $T
-std::any          typedValue                    ;                               // use to write to content
-std::vector<bool> foundInFile                   ;                               // indexed with keywordID
-int               linenumber           =      -1;                               // $#
-size_t            keywordID            =      -1;                               // internal index to keywordID and getDescriptor()
-bool              flagConditionHandled =   false;                               // use to write to content
-bool              verboseFlag          =   false;                               //
-FileContent       content                       ;                               //
-const Reader *    instancePtr          = nullptr;                               //
-Descriptor        CurrentDescriptor             ;                               //
+constexpr size_t minimumChunkSize = 1 << 18;                                    // bytes; smaller files are parsed on the calling thread
+constexpr size_t minimumValidationJobs = 16;                                    // keywords per thread in the deferred validation pass
+
+// -------------------------------------------------------------------------- //
+// Module globals aka state variables, non-exposed
+// all are thread_local so that chunks of one file can be parsed concurrently
+
+thread_local std::string       filename                      ;                  // $F
+thread_local std::string       lineOriginal                  ;                  // $L
+thread_local std::string       currentKeyword                ;                  // $K, qualified with currentSection
+thread_local std::string       currentSection                ;                  // set by [section] headers
+thread_local std::string       defaultValue                  ;                  // $D
+thread_local std::string       readValue                     ;                  // $V
+thread_local ValueTypeID       valueTypeID                   ;                  //
+thread_local std::string       valueTypeString               ;                  // $T
+thread_local std::any          typedValue                    ;                  // use to write to content
+thread_local std::vector<bool> foundInFile                   ;                  // indexed with keywordID
+thread_local int               linenumber           =      -1;                  // $#
+thread_local size_t            linesRead            =       0;                  // physical lines read in this call
+thread_local size_t            keywordID            =      -1;                  // internal index to keywordID and getDescriptor()
+thread_local bool              flagConditionHandled =   false;                  // use to write to content
+thread_local bool              verboseFlag          =   false;                  //
+thread_local FileContent *     contentPtr           = nullptr;                  // receives the parsed values
+thread_local const Reader *    instancePtr          = nullptr;                  //
+thread_local const Descriptor * CurrentDescriptor   = nullptr;                  // points into instancePtr's descriptors
+thread_local ParseStats *      statsPtr             = nullptr;                  // profiling is disabled if nullptr
+thread_local DiagnosticSink *  sinkPtr              = nullptr;                  // receives all messages
+thread_local std::vector<ParseError> * errorsPtr    = nullptr;                  // collect errors instead of throwing if set
+thread_local ParseChunk *      chunkPtr             = nullptr;                  // record events instead of writing to content and sink if set
+thread_local std::vector<ParseEvent> * pendingPtr   = nullptr;                  // keywords awaiting the deferred validation pass
+
+thread_local std::vector<std::string> includeStack  ;                           // canonical paths of the files being included, outermost first
+
+namespace {
+  struct ParseFileState {                                                       // the state variables reset by parseResetState(true)
+    std::string       filename;
+    std::string       currentSection;
+    std::vector<bool> foundInFile;
+    int               linenumber;
+    size_t            linesRead;
+    bool              verboseFlag;
+    FileContent *     contentPtr;
+    const Reader *    instancePtr;
+    ParseStats *      statsPtr;
+    DiagnosticSink *  sinkPtr;
+    std::vector<ParseError> * errorsPtr;
+    ParseChunk *      chunkPtr;
+    std::vector<ParseEvent> * pendingPtr;
+  };
+
+  struct IncludeGuard {                                                         // leaves the included file, also on exceptions
+    ~IncludeGuard() {includeStack.pop_back();}
+  };
+}
 
 // -------------------------------------------------------------------------- //
 // parser module local function definitions
 
 std::string parseMessage(std::string message);                                  // returns a copy of <message> with $X replaced with the state string
+void        parseWarning(DiagnosticKind kind, const std::string & message);     // hands <message> to sinkPtr, together with the state
+void        parseError  (DiagnosticKind kind, const std::string & messageTemplate); // stores a ParseError with a snapshot of the state in errorsPtr
+void        parseLines(std::istream & hFile, size_t maxLines);                  // reads up to maxLines physical lines and parses them
 void        parseLine();                                                        // supervises the parsing process, uses the state variables
+void        parseSectionHeader();                                               // sets currentSection from a [section] line
+void        parseMissingKeyword(const Descriptor & descriptor);                 // applies the missing keyword policy
 void        parseShowState ();                                                  // purely for debug, print state vars to stdout
 void        parseResetState(bool fullReset = false);                            // resets the state vars; fullReset also affects file-global states (eg. linenumber)
+ParseFileState parseSaveState();                                                // moves the file-global states out, e.g. to parse another file in between
+void        parseRestoreState(ParseFileState && state);                         // reinstates states saved by parseSaveState
+bool        parseInclude   ();                                                  // handles an include directive; true if the line is one
+void        parseSplice    (const std::string & path, std::string section);     // parses the included file path in place, or replays its fragment
+void        parseIncludeError(DiagnosticKind kind, const std::string & messageTemplate); // throws an IncludeError or stores a ParseError
+bool        parseTimed     (ParseStage stage, bool (*partialParser)());         // runs partialParser and books its time with statsPtr, if set
+bool        parseReadLine  (std::istream & hFile, std::string & linebuffer);    // std::getline, booking the time as I/O with statsPtr, if set
+bool        parseContinued (std::string & linebuffer, char multilineMarker);    // trims a physical line and strips the marker; true if the logical line goes on
+bool        parseAlign     (const std::any & value, std::any & aligned);      // converts numeric lists to AlignedVectors if requested
+double      parseResolve   (const std::string & name);                          // value of an Integer or Real keyword referenced in an expression
+PARROT_TYPE(ValueTypeID::Real   ) parseReal   (const std::string & text, bool strict = false); // std::stod, or an expression if enabled; throws on error
+PARROT_TYPE(ValueTypeID::Integer) parseInteger(const std::string & text, bool strict = false); // std::stoll, or an integral expression if enabled; throws on error
+PARROT_TYPE(ValueTypeID::Float32) parseFloat32(const std::string & text);       // parseReal, narrowed to float; throws if beyond the float range
+bool        parseFitsFloat32(double value);                                     // false for finite values that would become inf as a float
+PARROT_TYPE(ValueTypeID::Complex) parseComplex(const std::string & text);       // reads re, imi, re+imi or (re, im); throws on error
+void        parseStore     (const std::any & value, bool update);              // adds or updates currentKeyword, or records that in chunkPtr
+void        parseDefer     (bool superseded);                                   // records currentKeyword for the validation pass, if it has after parse restrictions
+void        parseValidate  (size_t threads);                                    // applies the after parse restrictions to all keywords in pendingPtr
+void        parseValidateJobs(const std::vector<const ParseEvent *> & sources,  // validates the keywords [first, last) of sources, recording events in jobs
+                              std::vector<ParseChunk> & jobs, size_t first, size_t last, bool profile);
+void        parseConstraints();                                                 // checks the constraints between keywords on the complete content
+
+std::vector<ParseChunk> parsePartition(const std::string & text, size_t count); // splits text into about count chunks of complete logical lines
+void        parseChunk     (const Reader * reader, const std::string & source,  // parses one chunk on the current thread, recording events
+                            std::vector<ParseError> * errors, bool profile,
+                            const std::string & text, ParseChunk & chunk);
+bool        parseChunkLine ();                                                  // parseLine, recording exceptions; true if the chunk cannot continue
+void        parseMerge     (std::vector<ParseChunk> & chunks);                  // replays the events of all chunks in file order
+void        parseReplay    (ParseChunk & chunk);                                // replays the events of one chunk, moving from them
 
 /* partial parsing functions return true if handling the section concludes parsing
  * return value should be false if step successfully passed, or true on severe
@@ -74,25 +236,71 @@ bool applyAftParseRestrictions();
   bool applyAftParseRestrictionsListBased (const Parrot::RestrictionType rType, const std::any & rData);
   bool applyAftParseRestrictionsRangeBased(const std::any & rData);
 
-bool handleMissingKeyowrds();                                                   // ...
+namespace {
+  struct SinkGuard {                                                            // calls endParse on leaving the scope, also on exceptions
+    DiagnosticSink * sink;
+    ~SinkGuard() {sink->endParse();}
+  };
+}
 
 // ========================================================================== //
 // Private Functions
 
 void Reader::descriptorValidityCheck(const Parrot::Descriptor & descriptor) const {
-  auto key = descriptor.getKey();
-  if (  key.empty()          ) {throw InvalidDescriptorError(THROWTEXT("    no keyword name specified!"));}
-  if ( !keywordCaseSensitive ) {BCG::to_uppercase(key);}
-  if (  hasKeyword(key)      ) {throw InvalidDescriptorError(THROWTEXT("    keyword '" + descriptor.getKey() + "' already registered!"));}
+  auto key = descriptor.getQualifiedKey();
+  if (  descriptor.getKey().empty() ) {throw InvalidDescriptorError(THROWTEXT("    no keyword name specified!"));}
+  if ( !keywordCaseSensitive        ) {BCG::to_uppercase(key);}
+  if (  hasKeyword(key)             ) {throw InvalidDescriptorError(THROWTEXT("    keyword '" + descriptor.getQualifiedKey() + "' already registered!"));}
+}
+
+// .......................................................................... //
+KeywordTable::ID Reader::handleID(std::string keyword, ValueTypeID valueType) const {
+  if ( !keywordCaseSensitive ) {BCG::to_uppercase(keyword);}
+
+  auto id = keywordTable->find(keyword);
+  if ( id == KeywordTable::npos ) {throw ValueAccessError(THROWTEXT("    keyword '" + keyword + "' is not registered"));}
+
+  auto expected = descriptors[id].getValueTypeID();
+  if ( expected != valueType ) {
+    throw ValueTypeError(THROWTEXT("    keyword '" + keyword + "' is of type " + valueTypeName(expected) + ", not " + valueTypeName(valueType)));
+  }
+
+  if ( alignNumericLists && (
+         valueType == ValueTypeID::IntegerList || valueType == ValueTypeID::RealList    ||
+         valueType == ValueTypeID::Int32List   || valueType == ValueTypeID::Float32List ||
+         valueType == ValueTypeID::ComplexList )
+  ) {
+    throw ValueTypeError(THROWTEXT("    keyword '" + keyword + "' is stored as an aligned list; read it via FileContent::getSpan_*()"));
+  }
+
+  return id;
+}
+// .......................................................................... //
+void Reader::appendDescriptor(const Parrot::Descriptor & descriptor) {
+  if (!keywordCaseSensitive) {
+    auto descriptorCopy = descriptor;
+    descriptorCopy.setKey    ( BCG::uppercase(descriptor.getKey    ()) );
+    descriptorCopy.setSection( BCG::uppercase(descriptor.getSection()) );
+    descriptors.push_back(descriptorCopy);
+
+  } else {
+    descriptors.push_back(descriptor);
+  }
+
+  keywordTable->intern( descriptors.back().getQualifiedKey() );
+  resetFragments();
 }
+// .......................................................................... //
+void Reader::resetFragments() {fragments = std::make_shared<FragmentCache>();}
 
 // ========================================================================== //
 // CTors
 
+Reader::Reader() {reset();}
+// .......................................................................... //
 Reader::Reader(const std::vector<Descriptor> & descriptors) {
   reset();
-
-  for (const auto & descriptor : descriptors) {addKeyword(descriptor);}
+  addKeywords(descriptors);
 }
 
 // ========================================================================== //
@@ -103,6 +311,19 @@ char                                    Reader::getMultilineMarker      () const
 char                                    Reader::getAssignmentMarker     () const {return assignmentMarker     ;}
 bool                                    Reader::getKeywordCaseSensitive () const {return keywordCaseSensitive ;}
 bool                                    Reader::getVerbose              () const {return verbose              ;}
+size_t                                  Reader::getThreads              () const {return threads              ;}
+bool                                    Reader::getAlignNumericLists    () const {return alignNumericLists    ;}
+const std::shared_ptr<DiagnosticSink> & Reader::getDiagnosticSink       () const {return diagnosticSink       ;}
+const std::shared_ptr<Executor> &       Reader::getExecutor             () const {return executor             ;}
+const std::shared_ptr<Executor> &       Reader::getIOExecutor           () const {return ioExecutor           ;}
+const std::shared_ptr<FileLoader> &     Reader::getFileLoader           () const {return fileLoader           ;}
+const BooleanVocabulary &               Reader::getBooleanVocabulary    () const {return *booleanVocabulary   ;}
+bool                                    Reader::getEvaluateExpressions  () const {return evaluateExpressions  ;}
+bool                                    Reader::getDeferValidation      () const {return deferValidation      ;}
+const ExpressionCache &                 Reader::getExpressionCache      () const {return *expressions         ;}
+const std::map<std::string, double> &   Reader::getConstants            () const {return expressions->getConstants();}
+const std::string &                     Reader::getIncludeKeyword       () const {return includeKeyword       ;}
+const FragmentCache &                   Reader::getFragmentCache        () const {return *fragments           ;}
 // -------------------------------------------------------------------------- //
 const ParsingErrorPolicy &              Reader::getParsingErrorPolicyMandatory    () const {return missingKeywordPolicyMandatory   ;}
 const std::string          &            Reader::getMissingKeywordTextMandatory    () const {return missingKeywordTextMandatory     ;}
@@ -117,23 +338,12 @@ const std::string          &            Reader::getConversionErrorText
 // -------------------------------------------------------------------------- //
 size_t                                  Reader::size            () const {return descriptors.size();}
 // .......................................................................... //
-bool                                    Reader::hasKeyword      (const std::string & keyword) const {
-  auto end = descriptors.end();
-  return std::find_if(descriptors.begin(), end,
-                      [keyword] (const auto & descriptor) {return descriptor.getKey() == keyword;}
-                     ) != end;
-}
-// .......................................................................... //
+bool                                    Reader::hasKeyword      (const std::string & keyword) const {return keywordTable->contains(keyword);}
 size_t                                  Reader::getKeywordIndex (const std::string & keyword) const {
-  auto start = descriptors.begin();
-  auto end   = descriptors.end();
-  auto spot  = std::find_if(start, end,
-                            [keyword] (const auto & descriptor) {return descriptor.getKey() == keyword;}
-                           );
-
-  if (spot == end) {return std::string::npos;}
-  else             {return std::distance(start, spot);}
+  auto id = keywordTable->find(keyword);
+  return id == KeywordTable::npos ? std::string::npos : id;
 }
+std::shared_ptr<const KeywordTable>     Reader::getKeywordTable () const {return keywordTable;}
 // -------------------------------------------------------------------------- //
 const std::vector<Descriptor> & Reader::getDescriptors()                            const {return descriptors;}
 const             Descriptor  & Reader::getDescriptor (const size_t        idx    ) const {
@@ -141,13 +351,14 @@ const             Descriptor  & Reader::getDescriptor (const size_t        idx
   return descriptors[idx];
 }
 const             Descriptor  & Reader::getDescriptor (const std::string & keyword) const {
-  auto end  = descriptors.end();
-  auto spot = std::find_if(descriptors.begin(), end, [keyword] (const auto & descriptor) {return descriptor.getKey() == keyword;});
+  auto id = keywordTable->find(keyword);
 
-  if (spot == end) {throw std::out_of_range(THROWTEXT("    keyword does not exist!"));}
+  if (id == KeywordTable::npos) {throw std::out_of_range(THROWTEXT("    keyword does not exist!"));}
 
-  return *spot;
+  return descriptors[id];
 }
+// .......................................................................... //
+const std::vector<Reader::Constraint> & Reader::getConstraints() const {return constraints;}
 
 // ========================================================================== //
 // Setters
@@ -157,6 +368,17 @@ void Reader::reset() {
   multilineMarker                   = '\\';
   keywordCaseSensitive              = false;
   verbose                           = true;
+  threads                           = 1;
+  alignNumericLists                 = false;
+  evaluateExpressions               = false;
+  deferValidation                   = false;
+  diagnosticSink                    = std::make_shared<StderrDiagnosticSink>();
+  executor                          = nullptr;
+  ioExecutor                        = nullptr;
+  fileLoader                        = nullptr;
+  booleanVocabulary                 = std::make_shared<const BooleanVocabulary>();
+  expressions                       = std::make_shared<ExpressionCache>();
+  includeKeyword                    = "";
 
   missingKeywordPolicyNonMandatory  = ParsingErrorPolicy::Warning;
   missingKeywordTextNonMandatory    = "keyword '$K' was not found; reverting to default ('$D')";
@@ -172,24 +394,61 @@ void Reader::reset() {
   resetKeywords();
 }
 // .......................................................................... //
-void Reader::resetKeywords() {descriptors.clear();}
+void Reader::resetKeywords() {
+  descriptors.clear();
+  constraints.clear();
+  keywordTable = std::make_shared<KeywordTable>();                              // results keep the old table
+  resetFragments();
+}
 // -------------------------------------------------------------------------- //
-void Reader::setParsingErrorPolicyMandatory    (const ParsingErrorPolicy & newVal)   {missingKeywordPolicyMandatory     = newVal;}
-void Reader::setMissingKeywordTextMandatory    (const std::string          & newVal) {missingKeywordTextMandatory       = newVal;}
-void Reader::setMissingKeywordPoliyNonMandatory(const ParsingErrorPolicy & newVal)   {missingKeywordPolicyNonMandatory  = newVal;}
-void Reader::setMissingKeywordTextNonMandatory (const std::string          & newVal) {missingKeywordTextNonMandatory    = newVal;}
-void Reader::setUnexpectedKeywordPolicy        (const ParsingErrorPolicy & newVal)   {unexpectedKeywordPolicy           = newVal;}
-void Reader::setUnexpectedKeywordText          (const std::string          & newVal) {unexpectedKeywordText             = newVal;}
-void Reader::setDuplicateKeywordPolicy         (const ParsingErrorPolicy & newVal)   {duplicateKeywordPolicy            = newVal;}
-void Reader::setDuplicateKeywordText           (const std::string          & newVal) {duplicateKeywordText              = newVal;}
-void Reader::setConversionErrorPolicy          (const ParsingErrorPolicy & newVal)   {conversionErrorPolicy             = newVal;}
-void Reader::setConversionErrorText            (const std::string          & newVal) {conversionErrorText               = newVal;}
+void Reader::setParsingErrorPolicyMandatory    (const ParsingErrorPolicy & newVal)   {missingKeywordPolicyMandatory     = newVal; resetFragments();}
+void Reader::setMissingKeywordTextMandatory    (const std::string          & newVal) {missingKeywordTextMandatory       = newVal; resetFragments();}
+void Reader::setMissingKeywordPoliyNonMandatory(const ParsingErrorPolicy & newVal)   {missingKeywordPolicyNonMandatory  = newVal; resetFragments();}
+void Reader::setMissingKeywordTextNonMandatory (const std::string          & newVal) {missingKeywordTextNonMandatory    = newVal; resetFragments();}
+void Reader::setUnexpectedKeywordPolicy        (const ParsingErrorPolicy & newVal)   {unexpectedKeywordPolicy           = newVal; resetFragments();}
+void Reader::setUnexpectedKeywordText          (const std::string          & newVal) {unexpectedKeywordText             = newVal; resetFragments();}
+void Reader::setDuplicateKeywordPolicy         (const ParsingErrorPolicy & newVal)   {duplicateKeywordPolicy            = newVal; resetFragments();}
+void Reader::setDuplicateKeywordText           (const std::string          & newVal) {duplicateKeywordText              = newVal; resetFragments();}
+void Reader::setConversionErrorPolicy          (const ParsingErrorPolicy & newVal)   {conversionErrorPolicy             = newVal; resetFragments();}
+void Reader::setConversionErrorText            (const std::string          & newVal) {conversionErrorText               = newVal; resetFragments();}
 // -------------------------------------------------------------------------- //
-void Reader::setCommentMarker                  (char                         newVal) {commentMarker         = newVal;}
-void Reader::setMultilineMarker                (char                         newVal) {multilineMarker       = newVal;}
-void Reader::setAssignmentMarker               (char                         newVal) {assignmentMarker      = newVal;}
-void Reader::setKeywordCaseSensitive           (bool                         newVal) {keywordCaseSensitive  = newVal;}
-void Reader::setVerbose                        (bool                         newVal) {verbose               = newVal;}
+void Reader::setCommentMarker                  (char                         newVal) {commentMarker         = newVal; resetFragments();}
+void Reader::setMultilineMarker                (char                         newVal) {multilineMarker       = newVal; resetFragments();}
+void Reader::setAssignmentMarker               (char                         newVal) {assignmentMarker      = newVal; resetFragments();}
+void Reader::setKeywordCaseSensitive           (bool                         newVal) {keywordCaseSensitive  = newVal; resetFragments();}
+void Reader::setVerbose                        (bool                         newVal) {verbose               = newVal; resetFragments();}
+void Reader::setAlignNumericLists              (bool                         newVal) {alignNumericLists     = newVal; resetFragments();}
+void Reader::setEvaluateExpressions            (bool                         newVal) {evaluateExpressions   = newVal;}
+void Reader::setDeferValidation                (bool                         newVal) {deferValidation       = newVal; resetFragments();}
+void Reader::setIncludeKeyword                 (const std::string &          newVal) {
+  includeKeyword = newVal;
+  BCG::trim(includeKeyword);
+  resetFragments();
+}
+void Reader::setThreads                        (size_t                       newVal) {
+  threads = newVal ? newVal : std::max(1u, std::thread::hardware_concurrency());
+}
+void Reader::setDiagnosticSink                 (const std::shared_ptr<DiagnosticSink> & newVal) {
+  diagnosticSink = newVal ? newVal : std::make_shared<StderrDiagnosticSink>();
+}
+void Reader::setExecutor                       (const std::shared_ptr<Executor> & newVal) {executor   = newVal;}
+void Reader::setIOExecutor                     (const std::shared_ptr<Executor> & newVal) {ioExecutor = newVal;}
+void Reader::setFileLoader                     (const std::shared_ptr<FileLoader> & newVal) {fileLoader = newVal;}
+void Reader::setBooleanVocabulary              (const BooleanVocabulary &    newVal) {
+  booleanVocabulary = std::make_shared<const BooleanVocabulary>(newVal);
+  resetFragments();
+}
+void Reader::setConstant                       (const std::string & name, double value) {
+  auto key = name;
+  BCG::trim(key);
+  BCG::to_uppercase(key);
+
+  if ( key.empty() ) {throw std::invalid_argument(THROWTEXT("    empty constant name"));}
+
+  auto constants = expressions->getConstants();
+  constants[key] = value;
+  expressions = std::make_shared<ExpressionCache>(constants);                   // programs compiled so far hold the old value
+}
 // -------------------------------------------------------------------------- //
 void Reader::addKeyword                  (const std::string &                           keyword,
                                           ValueTypeID                                   valueType,
@@ -218,22 +477,45 @@ void Reader::addKeyword                  (const Parrot::Reader::MinimalDescripto
 // .......................................................................... //
 void Reader::addKeyword                  (const             Parrot::Descriptor  & descriptor ) {
   descriptorValidityCheck(descriptor);
-  if (!keywordCaseSensitive) {
-    auto descriptorCopy = descriptor;
-    descriptorCopy.setKey( BCG::uppercase(descriptor.getKey()) );
-    descriptors.push_back(descriptorCopy);
 
-  } else {
-    descriptors.push_back(descriptor);
+  if (keywordTable.use_count() > 1) {keywordTable = std::make_shared<KeywordTable>(*keywordTable);}
+  appendDescriptor(descriptor);
+}
+// -------------------------------------------------------------------------- //
+void Reader::addConstraint               (const std::vector<std::string> &              keywords,
+                                          const std::function<bool (const FileContent &)> & check,
+                                          RestrictionViolationPolicy                    policy,
+                                          const std::string &                           restrictionViolationText
+) {
+  if ( !check ) {throw Parrot::InvalidFunctionError(THROWTEXT("    Uninitialized constraint function"));}
+
+  Constraint constraint {keywords, check, policy, restrictionViolationText};
+  for (auto & keyword : constraint.keywords) {
+    if ( !keywordCaseSensitive ) {BCG::to_uppercase(keyword);}
+    if ( !hasKeyword(keyword)  ) {throw std::invalid_argument(THROWTEXT("    keyword '" + keyword + "' is not registered"));}
   }
+
+  constraints.push_back(std::move(constraint));
 }
+// .......................................................................... //
+void Reader::clearConstraints            () {constraints.clear();}
 // -------------------------------------------------------------------------- //
-void Reader::addKeywords                 (const std::vector<Parrot::Descriptor> & descriptors) {
-  std::cout << "*** via full descriptor list" << std::endl;
-  for (auto & descriptor : descriptors) {
+void Reader::addKeywords                 (const std::vector<Parrot::Descriptor> & newDescriptors) {
+  // check the whole batch first, so a failing batch leaves the reader unchanged
+  std::unordered_set<std::string> batch;
+  batch.reserve(newDescriptors.size());
+
+  for (const auto & descriptor : newDescriptors) {
     descriptorValidityCheck(descriptor);
-    addKeyword(descriptor);
+
+    auto key = descriptor.getQualifiedKey();
+    if ( !keywordCaseSensitive      ) {BCG::to_uppercase(key);}
+    if ( !batch.insert(key).second  ) {throw InvalidDescriptorError(THROWTEXT("    keyword '" + descriptor.getQualifiedKey() + "' registered twice!"));}
   }
+
+  descriptors.reserve(descriptors.size() + newDescriptors.size());
+  if (keywordTable.use_count() > 1) {keywordTable = std::make_shared<KeywordTable>(*keywordTable);}
+  for (const auto & descriptor : newDescriptors) {appendDescriptor(descriptor);}
 }
 // .......................................................................... //
 void Reader::addKeywords                 (const std::vector<Parrot::Reader::MinimalDescriptor> & descriptors) {
@@ -268,6 +550,11 @@ void Reader::addKeywords                 (const std::vector<std::string> &
 
   for (auto i = 0u; i < N; ++i) {addKeyword(keywords[i], defaultValues[i], useMandatory ? mandatory[i] : true);}
 }
+// .......................................................................... //
+void Reader::loadSchema                  (const std::string &                           source) {addKeywords( Schema::load(source).getDescriptors() );}
+void Reader::loadSchemaImage             (const std::string &                           filename,
+                                          const FunctionRegistry &                      registry
+) {addKeywords( Schema::loadImage(filename, registry).getDescriptors() );}
 // -------------------------------------------------------------------------- //
 void Reader::addKeywordRanged            (const std::string &                           keyword,
                                           ValueTypeID                                   valueType,
@@ -279,8 +566,7 @@ void Reader::addKeywordRanged            (const std::string &
 ) {
   auto descriptor = Descriptor();
   descriptor.makeRanged(keyword, valueType, min, max, policy, restrictionViolationText, mandatory);
-  descriptorValidityCheck (descriptor);
-  addKeyword              (descriptor);
+  addKeyword(descriptor);
 }
 // .......................................................................... //
 void Reader::addKeywordListboundPreParse (const std::string &                           keyword,
@@ -293,8 +579,7 @@ void Reader::addKeywordListboundPreParse (const std::string &
 ) {
   auto descriptor = Descriptor();
   descriptor.makeListboundPreParse(keyword, valueType, list, forbiddenList, policy, restrictionViolationText, mandatory);
-  descriptorValidityCheck (descriptor);
-  addKeyword              (descriptor);
+  addKeyword(descriptor);
 }
 // .......................................................................... //
 void Reader::addKeywordUserboundPreParse (const std::string &                           keyword,
@@ -306,180 +591,1380 @@ void Reader::addKeywordUserboundPreParse (const std::string &
 ) {
   auto descriptor = Descriptor();
   descriptor.makeUserboundPreParse(keyword, valueType, uFunc, policy, restrictionViolationText, mandatory);
-  descriptorValidityCheck (descriptor);
-  addKeyword              (descriptor);
+  addKeyword(descriptor);
 }
 
 // ========================================================================== //
 // I/O
 
-Parrot::FileContent Reader::operator() (const std::string & source) const {
-  std::fstream hFile = BCG::openThrow(source, std::fstream::in);
+Parrot::FileContent Reader::operator() (const std::string & source                    ) const {return parse(source, {});}
+Parrot::FileContent Reader::operator() (const std::string & source, ParseStats & stats) const {return parse(source, {.stats = &stats});}
+Parrot::FileContent Reader::operator() (const std::string & source, std::pmr::memory_resource & resource) const {return parse(source, {.resource = &resource});}
+// .......................................................................... //
+Parrot::ParseResult Reader::tryParse   (const std::string & source) const {
+  std::vector<ParseError> errors;
+  auto content = parse(source, {.errors = &errors});
+  return ParseResult(std::move(content), std::move(errors));
+}
+// .......................................................................... //
+auto fulfil(std::shared_ptr<std::promise<FileContent>> promise) {               // completion handler setting promise
+  return [promise] (FileContent * content, std::exception_ptr error) {
+    if (error) {promise->set_exception(error);}
+    else       {promise->set_value(std::move(*content));}
+  };
+}
+// .......................................................................... //
+std::future<FileContent> Reader::parseAsync(const std::string & source, const CancellationToken & token) const {
+  auto promise = std::make_shared<std::promise<FileContent>>();
+  auto reVal   = promise->get_future();
+
+  submitParse(source, token, fulfil(promise));
+
+  return reVal;
+}
+// .......................................................................... //
+ParseAwaitable Reader::parseAwaitable(const std::string & source, const CancellationToken & token) const {
+  return ParseAwaitable(this, source, token);
+}
+// .......................................................................... //
+std::vector<std::future<FileContent>> Reader::parseBatch(const std::vector<std::string> & sources, const CancellationToken & token) const {
+  std::vector<std::shared_ptr<std::promise<FileContent>>> promises;
+  std::vector<std::future<FileContent>>                   reVal;
+  for (auto i = 0u; i < sources.size(); ++i) {
+    promises.push_back( std::make_shared<std::promise<FileContent>>() );
+    reVal   .push_back( promises.back()->get_future() );
+  }
+
+  auto pool   = executor   ? executor   : defaultExecutor();
+  auto loader = fileLoader ? fileLoader : defaultFileLoader();
+
+  loader->load(sources, [&] (size_t index, std::string && text, std::exception_ptr error) {
+    if (error) {promises[index]->set_exception(error); return;}
+
+    pool->submit([this, source = sources[index], text = std::make_shared<std::string>(std::move(text)), token, done = fulfil(promises[index])] () {
+      runParse(source, text, token, done);
+    });
+  });
+
+  return reVal;
+}
+// .......................................................................... //
+bool globMatch(std::string_view pattern, std::string_view text) {              // see Reader::parseDirectory for the syntax
+  while ( !pattern.empty() ) {
+    if (pattern[0] == '*') {
+      auto crossDirectories = pattern.starts_with("**");
+      auto rest             = pattern.substr(crossDirectories ? 2 : 1);
+
+      if (crossDirectories && rest.starts_with('/') && globMatch(rest.substr(1), text)) {return true;} // **/ also matches no directory
+
+      for (auto i = 0u; i <= text.size(); ++i) {
+        if (globMatch(rest, text.substr(i))) {return true;}
+        if (i < text.size() && text[i] == '/' && !crossDirectories) {return false;}
+      }
+      return false;
+    }
+
+    if (text.empty()) {return false;}
+
+    if (pattern[0] == '?') {
+      if (text[0] == '/') {return false;}
+      pattern.remove_prefix(1);
+      text   .remove_prefix(1);
+      continue;
+    }
+
+    if (pattern[0] == '[') {
+      auto first  = (pattern.size() > 1 && (pattern[1] == '!' || pattern[1] == '^')) ? 2u : 1u;
+      auto close  = pattern.find(']', first + 1);                               // a ] right after the opening bracket is a member
+
+      if (close != std::string_view::npos) {
+        auto found = false;
+        for (auto i = first; i < close; ++i) {
+          if (i + 2 < close && pattern[i + 1] == '-') {found = found || (pattern[i] <= text[0] && text[0] <= pattern[i + 2]); i += 2;}
+          else                                        {found = found || (pattern[i] == text[0]);}
+        }
+        if (text[0] == '/' || found == (first == 2)) {return false;}
+
+        pattern.remove_prefix(close + 1);
+        text   .remove_prefix(1);
+        continue;
+      }
+    }
+
+    if (pattern[0] != text[0]) {return false;}
+    pattern.remove_prefix(1);
+    text   .remove_prefix(1);
+  }
+
+  return text.empty();
+}
+// .......................................................................... //
+DirectoryParseResult Reader::parseDirectory(const std::string & root, const std::string & pattern) const {
+  namespace fs = std::filesystem;
+
+  if ( !fs::is_directory(root) ) {throw std::runtime_error(THROWTEXT("    '" + root + "' is not a directory"));}
+
+  auto pool     = executor ? executor : defaultExecutor();
+  auto relative = pattern.find('/') != std::string::npos;
+
+  struct Work {                                                                 // shared with the tasks, which may start after the call returned
+    std::mutex                mtx;
+    std::condition_variable   cvDone;
+    std::vector<std::string>  paths;                                            // matching files found so far
+    size_t                    next     = 0;                                     // first path not yet claimed by a task or the caller
+    size_t                    finished = 0;
+  };
+  auto work  = std::make_shared<Work>();
+  auto claim = [] (Work & work, std::string & path) {
+    std::lock_guard<std::mutex> lock(work.mtx);
+    if (work.next == work.paths.size()) {return false;}
+    path = work.paths[work.next++];
+    return true;
+  };
+
+  BufferedDiagnosticSink              collector;
+  std::map<std::string, ParseResult>  files;
+
+  auto parseFile = [&] (const std::string & path) {                             // only called for claimed paths, i.e. before the call returns
+    std::vector<ParseError> errors;
+    FileContent             content;
+    try {
+      content = parse(path, {.errors = &errors, .sink = &collector});
+    } catch (const std::exception & e) {                                        // not expected with errors collected, but no file is lost
+      ParseError error;
+      error.kind            = DiagnosticKind::InconsistentState;
+      error.file            = path;
+      error.messageTemplate = e.what();
+      errors.push_back(error);
+    }
+
+    ParseResult result(std::move(content), std::move(errors));
+
+    std::lock_guard<std::mutex> lock(work->mtx);
+    files.emplace(path, std::move(result));
+    if (++work->finished == work->paths.size()) {work->cvDone.notify_all();}
+  };
+
+  std::exception_ptr walkError;
+  try {
+    for (const auto & entry : fs::recursive_directory_iterator(root, fs::directory_options::skip_permission_denied)) {
+      std::error_code error;
+      if ( !entry.is_regular_file(error) ) {continue;}
+
+      auto name = relative ? entry.path().lexically_relative(root).generic_string() : entry.path().filename().string();
+      if ( !globMatch(pattern, name) ) {continue;}
+
+      {
+        std::lock_guard<std::mutex> lock(work->mtx);
+        work->paths.push_back(entry.path().string());
+      }
+      pool->submit([work, claim, &parseFile] () {
+        std::string path;
+        if ( claim(*work, path) ) {parseFile(path);}
+      });
+    }
+  } catch (...) {walkError = std::current_exception();}
+
+  // parse what the executor has not taken up yet: on a busy pool, or if called from one of its tasks, this is all of it
+  std::string path;
+  while ( claim(*work, path) ) {parseFile(path);}
+
+  {
+    std::unique_lock<std::mutex> lock(work->mtx);
+    work->cvDone.wait(lock, [&work] {return work->finished == work->paths.size();});
+  }
+  if (walkError) {std::rethrow_exception(walkError);}
+
+  auto diagnostics = collector.getRecords();
+  std::stable_sort(diagnostics.begin(), diagnostics.end(),                     // files write concurrently, but each one in order
+                   [] (const auto & a, const auto & b) {return a.file < b.file;}
+  );
+
+  return DirectoryParseResult(std::move(files), std::move(diagnostics));
+}
+// .......................................................................... //
+void Reader::runParse(const std::string & source, std::shared_ptr<std::string> text, const CancellationToken & token, const ParseCompletion & done) const {
+  if (token.isCancelled()) {
+    done(nullptr, std::make_exception_ptr(ParseCancelledError(THROWTEXT("    parsing of file '" + source + "' was cancelled"))));
+    return;
+  }
+
+  FileContent content;
+  try         {content = parse(source, {.text = text.get()});}
+  catch (...) {done(nullptr, std::current_exception()); return;}
+
+  done(&content, nullptr);
+}
+// .......................................................................... //
+void Reader::submitParse(const std::string & source, const CancellationToken & token, ParseCompletion done) const {
+  auto pool = executor ? executor : defaultExecutor();
+  if (!ioExecutor) {
+    pool->submit([this, source, token, done] () {runParse(source, nullptr, token, done);});
+    return;
+  }
+
+  ioExecutor->submit([this, source, token, done, pool] () {
+    if (token.isCancelled()) {runParse(source, nullptr, token, done); return;}  // reports the cancellation
+
+    std::shared_ptr<std::string> text;
+    try {
+      std::fstream hFile = BCG::openThrow(source, std::fstream::in);
+      std::ostringstream buffer;
+      buffer << hFile.rdbuf();
+      text = std::make_shared<std::string>(std::move(buffer).str());
+    } catch (...) {done(nullptr, std::current_exception()); return;}
+
+    pool->submit([this, source, text, token, done] () {runParse(source, text, token, done);});
+  });
+}
+// .......................................................................... //
+Parrot::FileContent Reader::operator() (const std::string & source, const std::vector<std::string> & sections) const {
+  auto index = indexSections(source);
+  return parse(source, {.sections = &sections, .index = &index});
+}
+Parrot::FileContent Reader::operator() (const std::string & source, const std::vector<std::string> & sections, const SectionIndex & index) const {
+  return parse(source, {.sections = &sections, .index = &index});
+}
+// -------------------------------------------------------------------------- //
+Reader::SectionIndex Reader::indexSections(const std::string & source) const {
+  std::fstream hFile = BCG::openThrow(source, std::fstream::in | std::fstream::binary);
+
+  SectionIndex    reVal;
+  std::string     linebuffer, logical, section;
+  SectionSpan     span;
+  std::streamoff  offset = 0, start = 0;
+  int             lines  = 0, startLine = 0;
+  bool            continued = false;
+
+  // headers are found in logical lines, joined as in parseLines, so that continued lines do not start sections
+  for (;std::getline(hFile, linebuffer); ++lines) {
+    if (!continued) {
+      start     = offset;
+      startLine = lines;
+      logical.clear();
+    }
+    offset = hFile.eof() ? offset + static_cast<std::streamoff>(linebuffer.size()) : static_cast<std::streamoff>(hFile.tellg());  // no newline after the last line
+
+    continued  = parseContinued(linebuffer, multilineMarker);
+    logical   += linebuffer;
+    if (continued) {continue;}
+
+    if (!logical.empty() && logical[0] == '[' && logical.back() == ']') {
+      span.lineCount = startLine - span.firstLine;
+      if (span.lineCount) {reVal[section].push_back(span);}
+
+      section = logical.substr(1, logical.size() - 2);
+      BCG::trim(section);
+      if ( !keywordCaseSensitive ) {BCG::to_uppercase(section);}
+
+      span = {start, startLine, 0};
+    }
+  }
+
+  span.lineCount = lines - span.firstLine;
+  if (span.lineCount) {reVal[section].push_back(span);}
+
+  return reVal;
+}
+// -------------------------------------------------------------------------- //
+Parrot::FileContent Reader::parse      (const std::string & source, const ParseJob & job) const {
+  auto stats  = job.stats;
+  auto errors = job.errors;
+  auto tStart = stats ? ParseStats::Clock::now() : ParseStats::Clock::time_point();
+
+  std::fstream       hFile;
+  std::istringstream hText;                                                     // holds job.text on the sequential paths
+  std::istream &     hInput = job.text ? static_cast<std::istream &>(hText) : hFile;
+
+  if (job.text) {
+    // already read by the caller
+  } else if (errors) {
+    hFile.open(source, std::fstream::in);
+    if (!hFile) {
+      ParseError error;
+      error.kind            = DiagnosticKind::FileAccess;
+      error.file            = source;
+      error.messageTemplate = "could not open file '$F'";
+      errors->push_back(error);
+      return FileContent(source);
+    }
+  } else {
+    hFile = BCG::openThrow(source, std::fstream::in);
+  }
 
   parseResetState(true);
-  content            = FileContent(source);                                     // only sets source in content
+  includeStack.clear();
+  statsPtr           = stats;
+  errorsPtr          = errors;
+  if (statsPtr) {statsPtr->addIOTime(ParseStats::Clock::now() - tStart);}
+
+  sinkPtr            = job.sink ? job.sink : diagnosticSink.get();
+  sinkPtr->beginParse(source);
+  SinkGuard sinkGuard {sinkPtr};
+
+  FileContent reVal(source, keywordTable, job.resource ? job.resource : std::pmr::get_default_resource());
+  std::vector<ParseEvent> pending;
+  contentPtr         = &reVal;
+  pendingPtr         = &pending;
   filename           = source;
   foundInFile        = std::vector<bool> ( descriptors.size() );
   instancePtr        = this;
   verboseFlag        = this->verbose;
 
+  std::vector<std::string> sections;                                            // requested sections, normalized
+  if (job.sections) {
+    sections = *job.sections;
+    for (auto & section : sections) {
+      BCG::trim(section);
+      if ( !keywordCaseSensitive ) {BCG::to_uppercase(section);}
+    }
+  }
+
+  std::error_code error;
+  auto fileSize = job.text ? job.text->size() : std::filesystem::file_size(source, error);
+  auto parallel = !job.sections && threads > 1 && !error && fileSize >= 2 * minimumChunkSize && !evaluateExpressions;
+
+  if (job.text && !parallel) {hText.str(std::move(*job.text));}
+
+  if (parallel) {
+    auto tRead = statsPtr ? ParseStats::Clock::now() : ParseStats::Clock::time_point();
+
+    std::string text;
+    if (job.text) {
+      text = std::move(*job.text);
+    } else {
+      text.resize(fileSize);
+      hFile.read(text.data(), text.size());
+      text.resize(hFile.gcount());
+    }
+
+    if (statsPtr) {statsPtr->addIOTime(ParseStats::Clock::now() - tRead);}
+
+    auto chunks = parsePartition(text, 4 * threads);                            // more chunks than threads to even out the load
+    std::atomic<size_t>      next = 0;
+    std::vector<std::thread> workers;
+
+    for (auto i = 0u; i < std::min(threads, chunks.size()); ++i) {
+      workers.emplace_back([&, errors = errorsPtr, profile = (statsPtr != nullptr)] () {
+        for (auto idx = next++; idx < chunks.size(); idx = next++) {
+          parseChunk(this, source, errors, profile, text, chunks[idx]);
+        }
+      });
+    }
+    for (auto & worker : workers) {worker.join();}
+
+    parseMerge(chunks);
+
+  } else if (!job.sections) {
+    parseLines(hInput, std::string::npos);
+
+  } else {
+    std::vector<SectionSpan> spans;
+    for (const auto & section : sections) {
+      auto it = job.index->find(section);
+      if (it != job.index->end()) {spans.insert(spans.end(), it->second.begin(), it->second.end());}
+    }
+    std::sort(spans.begin(), spans.end(),                                       // keep file order for duplicate handling
+              [] (const auto & a, const auto & b) {return a.offset < b.offset;}
+    );
+
+    for (const auto & span : spans) {
+      hInput.clear();
+      hInput.seekg(span.offset);
+      linenumber     = span.firstLine;
+      currentSection = "";
+      parseLines(hInput, span.lineCount);
+    }
+  }
+
+  if (deferValidation) {parseValidate(threads);}
+
+  auto lineCount = linesRead;
+  linenumber     = -1;
+  for (auto i=0u; i<descriptors.size(); ++i) {
+    if (foundInFile[i]) {continue;}
+    if (job.sections && std::find(sections.begin(), sections.end(), descriptors[i].getSection()) == sections.end()) {continue;}
+
+    parseMissingKeyword(descriptors[i]);
+  }
+
+  parseConstraints();
+
+  if (statsPtr) {
+    statsPtr->addFile(ParseStats::Clock::now() - tStart, lineCount);
+    statsPtr = nullptr;
+  }
+
+  if (verbose) {
+    parseWarning(DiagnosticKind::Summary,
+                 "Completed parsing file '" + source + "' (" + std::to_string(lineCount) + " lines)"
+    );
+  }
+
+  return reVal;
+}
+// -------------------------------------------------------------------------- //
+KeywordIndex Reader::indexKeywords(const std::string & source) const {
+  std::fstream hFile = BCG::openThrow(source, std::fstream::in | std::fstream::binary);
+
+  KeywordIndex    reVal;
+  std::string     linebuffer, logical, section;
+  std::streamoff  offset = 0, start = 0;
+  int             lines  = 0, startLine = 0;
+  bool            continued = false;
+
+  reVal.setSource(source, indexSignature());
+
+  for (;std::getline(hFile, linebuffer); ++lines) {
+    if (!continued) {
+      start     = offset;
+      startLine = lines;
+      logical.clear();
+    }
+    offset = hFile.eof() ? offset + static_cast<std::streamoff>(linebuffer.size()) : static_cast<std::streamoff>(hFile.tellg());  // no newline after the last line
+
+    continued  = parseContinued(linebuffer, multilineMarker);
+    logical   += linebuffer;
+    if (continued) {continue;}
+
+    // a logical line is complete; classify it as parseLine does
+    if (logical.empty() || logical[0] == commentMarker) {continue;}
+
+    if (logical[0] == '[' && logical.back() == ']') {
+      section = logical.substr(1, logical.size() - 2);
+      BCG::trim(section);
+      if ( !keywordCaseSensitive ) {BCG::to_uppercase(section);}
+      continue;
+    }
+
+    auto separationIdx = logical.find('=');
+    if (separationIdx == std::string::npos) {continue;}
+
+    auto keyword = logical.substr(0, separationIdx);
+    BCG::trim(keyword);
+    if ( !keywordCaseSensitive ) {BCG::to_uppercase(keyword);}
+    if ( !section.empty()      ) {keyword = section + "." + keyword;}
+
+    reVal.add(keyword, section, {start, static_cast<size_t>(offset - start), startLine});
+  }
+
+  return reVal;
+}
+// .......................................................................... //
+LazyFileContent Reader::parseLazy(const std::string & source, const std::string & indexFile) const {
+  KeywordIndex index;
+  bool         current = false;
+
+  if ( !indexFile.empty() && std::filesystem::exists(indexFile) ) {
+    try {
+      index   = KeywordIndex::load(indexFile);
+      current = index.isCurrent(source, indexSignature());
+    }
+    catch (const std::runtime_error &) {current = false;}
+  }
+
+  if (!current) {
+    index = indexKeywords(source);
+    if ( !indexFile.empty() ) {index.save(indexFile);}
+  }
+
+  return LazyFileContent(*this, index);
+}
+// .......................................................................... //
+LazyFileContent Reader::parseLazy(const KeywordIndex & index) const {return LazyFileContent(*this, index);}
+// .......................................................................... //
+void Reader::saveSchemaImage(const std::string & filename) const {Schema(descriptors).saveImage(filename);}
+// .......................................................................... //
+std::string Reader::indexSignature() const {
+  return std::string{commentMarker, multilineMarker, keywordCaseSensitive ? 'C' : 'c'};
+}
+// .......................................................................... //
+void Reader::parseIndexed(std::istream &               hFile,
+                          const std::string &          keyword,
+                          const KeywordIndex::Entry *  entry,
+                          FileContent &                target) const {
+  parseResetState(true);
+  sinkPtr            = diagnosticSink.get();
+  sinkPtr->beginParse(target.getSource());
+  SinkGuard sinkGuard {sinkPtr};
+
+  std::vector<ParseEvent> pending;
+  contentPtr         = &target;
+  pendingPtr         = &pending;
+  filename           = target.getSource();
+  foundInFile        = std::vector<bool> ( descriptors.size() );
+  instancePtr        = this;
+  verboseFlag        = this->verbose;
+
+  if (entry) {
+    std::string buffer;
+
+    for (const auto & span : entry->spans) {
+      buffer.resize(span.length);
+      hFile.clear();
+      hFile.seekg(span.offset);
+      hFile.read(buffer.data(), span.length);
+      buffer.resize(hFile.gcount());
+
+      std::istringstream lines(buffer);
+      linenumber     = span.firstLine;
+      currentSection = entry->section;
+      parseLines(lines, std::string::npos);
+    }
+
+    if (deferValidation) {parseValidate(1);}
+
+  } else {
+    auto idx = getKeywordIndex(keyword);
+    linenumber = -1;
+    if (idx != std::string::npos) {parseMissingKeyword(descriptors[idx]);}
+  }
+}
+// -------------------------------------------------------------------------- //
+std::string Reader::to_string() const {
+  std::string reVal = "Parrot::Reader object\n";
+  reVal += "  comment marker                           : "s + (commentMarker         ? std::string(1, commentMarker  ) : "(none)"s) + "\n";
+  reVal += "  line continuation marker                 : "s + (multilineMarker       ? std::string(1, multilineMarker) : "(none)"s) + "\n";
+  reVal += "  assignment marker                        : "s + (assignmentMarker                                                   ) + "\n";
+  reVal += "  treat keywords case sensitively          : "s + (keywordCaseSensitive  ?                           "yes" : "no"     ) + "\n";
+  reVal += "  verbose mode                             : "s + (verbose               ?                           "yes" : "no"     ) + "\n";
+  reVal += "  threads per file                         : "s + std::to_string(threads                                      ) + "\n";
+  reVal += "  align numeric lists                      : "s + (alignNumericLists     ?                           "yes" : "no"     ) + "\n";
+  reVal += "  boolean words                            : "s + booleanVocabulary->to_string()                                + "\n";
+  reVal += "  evaluate numeric expressions             : "s + (evaluateExpressions   ?                           "yes" : "no"     ) + "\n";
+  reVal += "  defer after parse restrictions           : "s + (deferValidation       ?                           "yes" : "no"     ) + "\n";
+  reVal += "  include directive                        : "s + (includeKeyword.empty() ? "(none)"s : includeKeyword              ) + "\n";
+  reVal += "  constraints between keywords             : "s + std::to_string(constraints.size()                           ) + "\n";
+
+  reVal += "  policy for missing non-mandatory keywords: " + parsingErrorPolicyName(missingKeywordPolicyNonMandatory) + "\n";
+  reVal += "    message                                : " +                        missingKeywordTextNonMandatory + "\n";
+  reVal += "  policy for missing mandatory keywords    : " + parsingErrorPolicyName(missingKeywordPolicyMandatory) + "\n";
+  reVal += "    message                                : " +                        missingKeywordTextMandatory + "\n";
+  reVal += "  policy for unexpected keywords           : " + parsingErrorPolicyName(unexpectedKeywordPolicy) + "\n";
+  reVal += "    message                                : " +                        unexpectedKeywordText + "\n";
+  reVal += "  policy for duplicate keywords            : " + parsingErrorPolicyName(duplicateKeywordPolicy) + "\n";
+  reVal += "    message                                : " +                        duplicateKeywordText + "\n";
+
+
+  reVal += "ready to extract these objects:\n";
+
+  for (const auto & descriptor : descriptors) {reVal += descriptor.to_string();}
+
+  return reVal;
+}
+
+
+// ========================================================================== //
+// Parsing Machinery implementation
+
+std::string parseMessage(std::string message) {
+  BCG::replaceAll(message, "$F", filename);
+  BCG::replaceAll(message, "$L", lineOriginal);
+  BCG::replaceAll(message, "$#", std::to_string(linenumber));
+  BCG::replaceAll(message, "$K", currentKeyword);
+  BCG::replaceAll(message, "$D", defaultValue);
+  BCG::replaceAll(message, "$V", readValue);
+  BCG::replaceAll(message, "$T", valueTypeString);
+
+  return message;
+}
+// .......................................................................... //
+void parseWarning(DiagnosticKind kind, const std::string & message) {
+  if (chunkPtr) {
+    ParseEvent event(ParseEventType::Warning);
+    event.record = {kind, filename, linenumber, currentKeyword, message};
+    chunkPtr->events.push_back(std::move(event));
+    return;
+  }
+
+  if (!sinkPtr) {return;}
+  sinkPtr->write({kind, filename, linenumber, currentKeyword, message});
+}
+// .......................................................................... //
+void parseError(DiagnosticKind kind, const std::string & messageTemplate) {
+  ParseError error {kind, filename, linenumber, currentKeyword, messageTemplate,
+                    lineOriginal, defaultValue, readValue, valueTypeString};
+
+  if (chunkPtr) {
+    ParseEvent event(ParseEventType::Error);
+    event.error = std::move(error);
+    chunkPtr->events.push_back(std::move(event));
+    return;
+  }
+
+  errorsPtr->push_back(std::move(error));
+}
+// -------------------------------------------------------------------------- //
+void parseLines(std::istream & hFile, size_t maxLines) {
+  const char  multilineMarker = instancePtr->getMultilineMarker();
   std::string linebuffer;
-  for (;std::getline(hFile, linebuffer);) {
+
+  for (size_t i = 0; i < maxLines && parseReadLine(hFile, linebuffer); ++i) {
     lineOriginal += linebuffer;
     ++linenumber;
+    ++linesRead;
 
-    BCG::trim(linebuffer);
-
-    if (linebuffer.back() == multilineMarker) {
-      linebuffer.pop_back();
+    if ( parseContinued(linebuffer, multilineMarker) ) {
       readValue    += linebuffer;
       lineOriginal += "\n";
       continue;
     }
 
     readValue += linebuffer;
-    parseLine();
+    if      (!chunkPtr       ) {parseLine();}
+    else if (parseChunkLine()) {return;}
     parseResetState();
   }
+}
+// .......................................................................... //
+void parseLine() {
+  // no parsing criteria: empty or comment
 
-  linenumber = -1;
-  for (auto i=0u; i<descriptors.size(); ++i) {
-    if (foundInFile[i]) {continue;}
+  if ( readValue.empty()                               ) {return;}
+  if ( readValue[0] == instancePtr->getCommentMarker() ) {return;}
+
+  // section headers
+
+  if ( readValue[0] == '[' && readValue.back() == ']'  ) {parseSectionHeader(); return;}
+
+  // other files
+
+  if ( parseInclude()                                  ) {return;}
+
+  // ........................................................................ //
+  // partial parsers
+
+  if ( parseTimed(ParseStage::SplitLine                , splitLine                ) ) {return;}
+  if ( parseTimed(ParseStage::IdentifyKeyword          , identifyKeyword          ) ) {return;}
+  if ( parseTimed(ParseStage::DuplicateCheck           , duplicateCheck           ) ) {return;}
+  if ( parseTimed(ParseStage::Preparse                 , preparse                 ) ) {return;}
+  if ( parseTimed(ParseStage::ApplyPreParseRestrictions, applyPreParseRestrictions) ) {return;}
+  if ( parseTimed(ParseStage::ConvertToTargetType      , convertToTargetType      ) ) {return;}
+
+  if      ( instancePtr->getDeferValidation() ) {parseDefer(false);}
+  else if ( parseTimed(ParseStage::ApplyAftParseRestrictions, applyAftParseRestrictions) ) {return;}
+
+  parseStore(typedValue, false);
+}
+// .......................................................................... //
+void parseSectionHeader() {
+  currentSection = readValue.substr(1, readValue.size() - 2);
+  BCG::trim(currentSection);
+  if ( !instancePtr->getKeywordCaseSensitive() ) {BCG::to_uppercase(currentSection);}
+}
+// .......................................................................... //
+bool parseInclude() {
+  const auto & directive = instancePtr->getIncludeKeyword();
+  if ( directive.empty() ) {return false;}
+
+  auto pos = readValue.find('=');                                               // as in splitLine
+  if (pos == std::string::npos) {return false;}
+
+  auto key = readValue.substr(0, pos);
+  BCG::trim(key);
+  if ( instancePtr->getKeywordCaseSensitive() ? key != directive : BCG::uppercase(key) != BCG::uppercase(directive) ) {return false;}
+
+  auto path = readValue.substr(pos + 1);
+  BCG::trim(path);
+  if ( path.size() >= 2 && (path[0] == '"' || path[0] == '\'') && path.back() == path[0] ) {path = path.substr(1, path.size() - 2);}
+
+  std::filesystem::path target = path;
+  if ( target.is_relative() ) {target = std::filesystem::path(filename).parent_path() / target;}
+
+  std::error_code error;
+  auto canonical = std::filesystem::weakly_canonical(target, error);            // one key per file, however it is spelled
+  target = error ? target.lexically_normal() : canonical;
+
+  if (chunkPtr) {
+    ParseEvent event(ParseEventType::Include);
+    event.file         = target.string();
+    event.section      = currentSection;
+    event.line         = linenumber;
+    event.lineOriginal = lineOriginal;
+    chunkPtr->events.push_back(std::move(event));
+    return true;
+  }
+
+  parseSplice(target.string(), currentSection);
+  return true;
+}
+// .......................................................................... //
+void parseSplice(const std::string & path, std::string section) {
+  std::error_code error;
+
+  if ( includeStack.empty() ) {includeStack.push_back( std::filesystem::weakly_canonical(filename, error).string() );}
+  if ( std::find(includeStack.begin(), includeStack.end(), path) != includeStack.end() ) {
+    parseIncludeError(DiagnosticKind::IncludeCycle, "file '" + path + "' includes itself in file '$F', line $#\n$L");
+    return;
+  }
+
+  auto modified = std::filesystem::last_write_time(path, error);
+  auto size     = error ? 0 : std::filesystem::file_size(path, error);
+  std::ifstream hFile(path, std::ios::binary);
+
+  if (error || !hFile) {
+    parseIncludeError(DiagnosticKind::FileAccess, "could not read file '" + path + "' included in file '$F', line $#\n$L");
+    return;
+  }
+
+  includeStack.push_back(path);
+  IncludeGuard includeGuard;
+
+  auto includer     = filename;
+  auto line         = linenumber;
+  auto outerSection = currentSection;
+
+  if ( instancePtr->getEvaluateExpressions() ) {                               // expressions may refer to keywords of the including file
+    parseResetState();
+    filename       = path;
+    linenumber     = 0;
+    currentSection = std::move(section);
+    parseLines(hFile, std::string::npos);
 
-    currentKeyword  = descriptors[i].getKey()  ;
-    typedValue      = descriptors[i].getValue();
-    defaultValue    = getAnyText( typedValue ) ;
-    valueTypeString = valueTypeName(Parrot::ValueTypeID::String);
+  } else {
+    const auto & cache    = instancePtr->getFragmentCache();
+    auto         fragment = cache.find(path, section, errorsPtr != nullptr, modified, size);
+
+    if (!fragment) {
+      std::string text(size, '\0');
+      hFile.read(text.data(), text.size());
+      text.resize(hFile.gcount());
+
+      auto parsed = std::make_shared<FragmentCache::Fragment>();
+      parsed->chunk.end     = text.size();
+      parsed->chunk.section = section;
+
+      auto state = parseSaveState();
+      parseChunk(state.instancePtr, path, state.errorsPtr, false, text, parsed->chunk);
+      parseRestoreState(std::move(state));
+
+      parsed->chunk.file = path;
+      cache.store(path, section, errorsPtr != nullptr, modified, size, parsed);
+      fragment = std::move(parsed);
+    }
+
+    auto chunk = fragment->chunk;                                               // replaying moves from the events
+    parseReplay(chunk);
+  }
+
+  filename       = std::move(includer);
+  linenumber     = line;
+  currentSection = std::move(outerSection);
+}
+// .......................................................................... //
+void parseIncludeError(DiagnosticKind kind, const std::string & messageTemplate) {
+  if (!errorsPtr) {throw IncludeError(THROWTEXT( parseMessage(messageTemplate) ));}
+  parseError(kind, messageTemplate);
+}
+// .......................................................................... //
+void parseMissingKeyword(const Descriptor & descriptor) {
+  currentKeyword  = descriptor.getQualifiedKey();
+  typedValue      = descriptor.getValue();
+  defaultValue    = getAnyText( typedValue ) ;
+  valueTypeString = valueTypeName(Parrot::ValueTypeID::String);
+  parseAlign(typedValue, typedValue);
+
+  const auto   mandatory = descriptor.isMandatory();
+  const auto   policy    = mandatory ? instancePtr->getParsingErrorPolicyMandatory    () : instancePtr->getMissingKeywordPoliyNonMandatory();
+  const auto & text      = mandatory ? instancePtr->getMissingKeywordTextMandatory    () : instancePtr->getMissingKeywordTextNonMandatory ();
+
+  switch (policy) {
+    case Parrot::ParsingErrorPolicy::Ignore :
+      break;
+
+    case Parrot::ParsingErrorPolicy::Silent :
+      contentPtr->addElement(currentKeyword, typedValue, false, true);
+      break;
+
+    case Parrot::ParsingErrorPolicy::Warning :
+      parseWarning(DiagnosticKind::MissingKeyword, parseMessage(text) );
+      contentPtr->addElement(currentKeyword, typedValue, false, true);
+      break;
+
+    case Parrot::ParsingErrorPolicy::Exception :
+      if (!errorsPtr) {throw MissingKeywordError(THROWTEXT( parseMessage(text) ));}
+      parseError(DiagnosticKind::MissingKeyword, text);
+      contentPtr->addElement(currentKeyword, typedValue, false, true);
+      break;
+  }
+}
+// .......................................................................... //
+void parseResetState(bool fullReset) {
+  lineOriginal           .clear() ;
+  currentKeyword         .clear() ;
+  defaultValue           .clear() ;
+  readValue              .clear() ;
+  valueTypeString        .clear() ;
+  typedValue             .reset() ;
+  CurrentDescriptor      = nullptr;
+  keywordID              =      -1;
+  flagConditionHandled   =   false;
+
+  if (fullReset) {
+    filename             .clear() ;
+    currentSection       .clear() ;
+    foundInFile          .clear() ;
+    linenumber           =       0;
+    linesRead            =       0;
+    verboseFlag          =   false;
+    contentPtr           = nullptr;
+    instancePtr          = nullptr;
+    statsPtr             = nullptr;
+    sinkPtr              = nullptr;
+    errorsPtr            = nullptr;
+    chunkPtr             = nullptr;
+    pendingPtr           = nullptr;
+  }
+}
+// .......................................................................... //
+ParseFileState parseSaveState() {
+  return {std::move(filename), std::move(currentSection), std::move(foundInFile), linenumber, linesRead, verboseFlag,
+          contentPtr, instancePtr, statsPtr, sinkPtr, errorsPtr, chunkPtr, pendingPtr};
+}
+// .......................................................................... //
+void parseRestoreState(ParseFileState && state) {
+  filename       = std::move(state.filename      );
+  currentSection = std::move(state.currentSection);
+  foundInFile    = std::move(state.foundInFile   );
+  linenumber     = state.linenumber ;
+  linesRead      = state.linesRead  ;
+  verboseFlag    = state.verboseFlag;
+  contentPtr     = state.contentPtr ;
+  instancePtr    = state.instancePtr;
+  statsPtr       = state.statsPtr   ;
+  sinkPtr        = state.sinkPtr    ;
+  errorsPtr      = state.errorsPtr  ;
+  chunkPtr       = state.chunkPtr   ;
+  pendingPtr     = state.pendingPtr ;
+}
+// .......................................................................... //
+bool parseTimed(ParseStage stage, bool (*partialParser)()) {
+  if (!statsPtr) {return partialParser();}
+
+  auto tStart = ParseStats::Clock::now();
+  bool reVal  = partialParser();
+  statsPtr->addStageTime(stage, ParseStats::Clock::now() - tStart);
+
+  return reVal;
+}
+// .......................................................................... //
+bool parseReadLine(std::istream & hFile, std::string & linebuffer) {
+  if (!statsPtr) {return static_cast<bool>( std::getline(hFile, linebuffer) );}
+
+  auto tStart = ParseStats::Clock::now();
+  bool reVal  = static_cast<bool>( std::getline(hFile, linebuffer) );
+  statsPtr->addIOTime(ParseStats::Clock::now() - tStart);
+
+  return reVal;
+}
+// .......................................................................... //
+bool parseContinued(std::string & linebuffer, char multilineMarker) {
+  BCG::trim(linebuffer);
+
+  if (linebuffer.empty() || linebuffer.back() != multilineMarker) {return false;}
+
+  linebuffer.pop_back();
+  return true;
+}
+// .......................................................................... //
+bool parseAlign(const std::any & value, std::any & aligned) {
+  if ( !instancePtr->getAlignNumericLists() ) {return false;}
+
+  if      (auto list = std::any_cast<PARROT_TYPE(ValueTypeID::IntegerList)>(&value)) {
+    aligned = AlignedVector<PARROT_TYPE(ValueTypeID::Integer)>(list->begin(), list->end());
+  }
+  else if (auto list = std::any_cast<PARROT_TYPE(ValueTypeID::RealList   )>(&value)) {
+    aligned = AlignedVector<PARROT_TYPE(ValueTypeID::Real   )>(list->begin(), list->end());
+  }
+  else if (auto list = std::any_cast<PARROT_TYPE(ValueTypeID::Int32List  )>(&value)) {
+    aligned = AlignedVector<PARROT_TYPE(ValueTypeID::Int32  )>(list->begin(), list->end());
+  }
+  else if (auto list = std::any_cast<PARROT_TYPE(ValueTypeID::Float32List)>(&value)) {
+    aligned = AlignedVector<PARROT_TYPE(ValueTypeID::Float32)>(list->begin(), list->end());
+  }
+  else if (auto list = std::any_cast<PARROT_TYPE(ValueTypeID::ComplexList)>(&value)) {
+    aligned = AlignedVector<PARROT_TYPE(ValueTypeID::Complex)>(list->begin(), list->end());
+  }
+  else {return false;}
+
+  return true;
+}
+// .......................................................................... //
+double parseResolve(const std::string & name) {
+  auto key = name;
+  if ( !instancePtr->getKeywordCaseSensitive() ) {BCG::to_uppercase(key);}
+
+  if (!contentPtr) {throw ExpressionError(THROWTEXT("    cannot refer to '" + name + "' here"));}
+
+  auto local = currentSection.empty() ? key : currentSection + "." + key;
+  if      ( contentPtr->hasKeyword(local) ) {key = local;}
+  else if ( !contentPtr->hasKeyword(key)  ) {throw ExpressionError(THROWTEXT("    '" + name + "' does not name a keyword parsed before"));}
+
+  auto value = contentPtr->getAny(key);
+  if (auto number = std::any_cast<PARROT_TYPE(ValueTypeID::Integer)>(&value)) {return *number;}
+  if (auto number = std::any_cast<PARROT_TYPE(ValueTypeID::Real   )>(&value)) {return *number;}
+
+  throw ExpressionError(THROWTEXT("    '" + name + "' is not a numeric keyword"));
+}
+// .......................................................................... //
+PARROT_TYPE(ValueTypeID::Real) parseReal(const std::string & text, bool strict) {
+  size_t end   = 0;
+  double reVal = 0;
+  bool   plain = false;
+
+  try {
+    reVal = std::stod(text, &end);
+    plain = text.find_first_not_of(" \t", end) == std::string::npos;
+  } catch (const std::exception & e) {
+    if ( !instancePtr->getEvaluateExpressions() ) {throw;}
+  }
+
+  if (plain || !(strict || instancePtr->getEvaluateExpressions())) {return reVal;}
+  if ( !instancePtr->getEvaluateExpressions() ) {throw std::invalid_argument(THROWTEXT("    trailing characters in '" + text + "'"));}
+
+  static const Expression::Resolver resolver = parseResolve;
+  auto trimmed = text;
+  BCG::trim(trimmed);
+  return instancePtr->getExpressionCache().get(trimmed)->evaluate(resolver);
+}
+// .......................................................................... //
+PARROT_TYPE(ValueTypeID::Integer) parseInteger(const std::string & text, bool strict) {
+  size_t                            end   = 0;
+  PARROT_TYPE(ValueTypeID::Integer) reVal = 0;
+  bool                              plain = false;
+
+  try {
+    reVal = std::stoll(text, &end);
+    plain = text.find_first_not_of(" \t", end) == std::string::npos;
+  } catch (const std::exception & e) {
+    if ( !instancePtr->getEvaluateExpressions() ) {throw;}
+  }
+
+  if (plain || !(strict || instancePtr->getEvaluateExpressions())) {return reVal;}
+  if ( !instancePtr->getEvaluateExpressions() ) {throw std::invalid_argument(THROWTEXT("    trailing characters in '" + text + "'"));}
+
+  auto value = parseReal(text, true);
+  if ( std::trunc(value) != value || std::fabs(value) >= 0x1p63 ) {
+    throw ExpressionError(THROWTEXT("    '" + text + "' does not evaluate to an integer"));
+  }
+  return static_cast<PARROT_TYPE(ValueTypeID::Integer)>(value);
+}
+// .......................................................................... //
+PARROT_TYPE(ValueTypeID::Float32) parseFloat32(const std::string & text) {
+  auto value = parseReal(text);
+  if ( !parseFitsFloat32(value) ) {throw std::out_of_range(THROWTEXT("    '" + text + "' is beyond the range of a 32 bit real"));}
+  return static_cast<PARROT_TYPE(ValueTypeID::Float32)>(value);
+}
+// .......................................................................... //
+bool parseFitsFloat32(double value) {
+  return !std::isfinite(value) || std::abs(value) <= std::numeric_limits<PARROT_TYPE(ValueTypeID::Float32)>::max();
+}
+// .......................................................................... //
+PARROT_TYPE(ValueTypeID::Complex) parseComplex(const std::string & text) {
+  auto body = text;
+  BCG::trim(body);
+
+  if (body.size() >= 2 && body.front() == '(' && body.back() == ')') {
+    auto parts = BCG::splitString(body.substr(1, body.size() - 2), ',');
+    if (parts.size() != 2) {throw std::invalid_argument(THROWTEXT("    expected (re, im) in '" + text + "'"));}
+    return {parseReal(parts[0], true), parseReal(parts[1], true)};
+  }
+
+  body.erase(std::remove_if(body.begin(), body.end(), [] (char c) {return c == ' ' || c == '\t';}), body.end());
+
+  auto fail = [&text] () {return std::invalid_argument(THROWTEXT("    '" + text + "' is not a complex number"));};
+  auto unit = [] (const char * c) {return std::strchr("iIjJ", *c) && *c && c[1] == '\0';};   // values may have been upper cased
+
+  const char * begin = body.c_str();
+  char *       end   = nullptr;
+
+  auto first = std::strtod(begin, &end);
+  if (end == begin) {throw fail();}
+  if (*end == '\0') {return {first, 0};}
+  if ( unit(end)  ) {return {0, first};}
+
+  const char * rest   = end;
+  auto         second = std::strtod(rest, &end);
+  if ( end == rest || (*rest != '+' && *rest != '-') || !unit(end) ) {throw fail();}
+
+  return {first, second};
+}
+// .......................................................................... //
+void parseStore(const std::any & typed, bool update) {
+  std::any         aligned;
+  const std::any & value = parseAlign(typed, aligned) ? aligned : typed;
+
+  if (chunkPtr) {
+    ParseEvent event(update ? ParseEventType::Update : ParseEventType::Store);
+    event.keyword   = currentKeyword;
+    event.keywordID = keywordID;
+    event.value     = value;
+    event.inFile  = true;
+    event.handled = flagConditionHandled;
+    event.line    = linenumber;
+    chunkPtr->events.push_back(std::move(event));
+    return;
+  }
+
+  if (keywordID == std::string::npos) {
+    if (update) {contentPtr->updateElement(currentKeyword, value, true, flagConditionHandled);}
+    else        {contentPtr->addElement   (currentKeyword, value, true, flagConditionHandled);}
+    contentPtr->setLine(currentKeyword, linenumber);
+  } else {
+    if (update) {contentPtr->updateElement(keywordID     , value, true, flagConditionHandled);}
+    else        {contentPtr->addElement   (keywordID     , value, true, flagConditionHandled);}
+    contentPtr->setLine(keywordID     , linenumber);
+  }
+}
+// .......................................................................... //
+void parseDefer(bool superseded) {
+  const auto & restrictions = instancePtr->getDescriptor(keywordID).getRestrictions();
+  if ( std::none_of(restrictions.begin(), restrictions.end(),
+                    [] (const auto & restriction) {return restriction.getAftParseRestrictionType() != RestrictionType::None;})
+  ) {return;}
+
+  ParseEvent event(ParseEventType::Validate);
+  event.keyword      = currentKeyword;
+  event.keywordID    = keywordID;
+  event.line         = linenumber;
+  event.lineOriginal = lineOriginal;
+  event.readValue    = readValue;
+  event.handled      = flagConditionHandled;
+  event.file         = filename;
+  if (!superseded) {event.value = typedValue;}                                  // a duplicate only marks the value as replaced
+
+  if (chunkPtr) {chunkPtr->events.push_back(std::move(event));}
+  else          {pendingPtr->push_back(std::move(event));}
+}
+// .......................................................................... //
+void parseValidate(size_t threads) {
+  std::vector<const ParseEvent *> sources;                                      // keywords with a converted value, in file order
+  std::vector<bool>               superseded(instancePtr->size());              // indexed with keywordID
+
+  for (const auto & event : *pendingPtr) {
+    if (event.value.has_value()) {sources.push_back(&event);}
+    else                         {superseded[event.keywordID] = true;}
+  }
+
+  // each keyword records its events separately, so they can be replayed in
+  // file order no matter which thread validated it
+  std::vector<ParseChunk> jobs(sources.size());
+  const bool              profile = (statsPtr != nullptr);
+
+  if (threads > 1 && sources.size() >= 2 * minimumValidationJobs) {
+    std::atomic<size_t>      next = 0;
+    std::vector<std::thread> workers;
+
+    for (auto i = 0u; i < std::min(threads, sources.size() / minimumValidationJobs); ++i) {
+      workers.emplace_back([&, reader = instancePtr, source = filename, verbose = verboseFlag, errors = errorsPtr] () {
+        parseResetState(true);
+        instancePtr = reader;
+        filename    = source;
+        verboseFlag = verbose;
+        errorsPtr   = errors;                                                   // only tested, never written to in a job
+
+        for (auto idx = next++; idx < sources.size(); idx = next++) {parseValidateJobs(sources, jobs, idx, idx + 1, profile);}
+
+        parseResetState(true);
+      });
+    }
+    for (auto & worker : workers) {worker.join();}
+
+  } else {
+    auto stats  = statsPtr;
+    auto source = filename;
+    parseValidateJobs(sources, jobs, 0, sources.size(), profile);
+    statsPtr = stats;
+    filename = source;
+  }
+
+  // a duplicate has replaced the value in the content already; only its messages remain
+  for (auto i = 0u; i < sources.size(); ++i) {
+    if (!superseded[sources[i]->keywordID]) {continue;}
+    std::erase_if(jobs[i].events, [] (const auto & event) {return event.type == ParseEventType::Update;});
+  }
 
-    if (descriptors[i].isMandatory()) {
-      switch (missingKeywordPolicyMandatory) {
-        case Parrot::ParsingErrorPolicy::Ignore :
-          break;
+  parseMerge(jobs);
+  pendingPtr->clear();
+}
+// .......................................................................... //
+void parseValidateJobs(const std::vector<const ParseEvent *> & sources,
+                       std::vector<ParseChunk> & jobs, size_t first, size_t last, bool profile) {
+  for (auto i = first; i < last; ++i) {
+    const auto & source = *sources[i];
 
-        case Parrot::ParsingErrorPolicy::Silent :
-          content.addElement(currentKeyword, typedValue, false, true);
-          break;
+    parseResetState();
+    chunkPtr          = &jobs[i];
+    statsPtr          = profile ? &jobs[i].stats : nullptr;
+    filename          = source.file;
+    currentKeyword    = source.keyword;
+    keywordID         = source.keywordID;
+    linenumber        = source.line;
+    lineOriginal      = source.lineOriginal;
+    readValue         = source.readValue;
+    typedValue        = source.value;
+    CurrentDescriptor = &instancePtr->getDescriptor(keywordID);
+    defaultValue      = getAnyText   ( CurrentDescriptor->getValue() );
+    valueTypeID       = CurrentDescriptor->getValueTypeID();
+    valueTypeString   = valueTypeName( valueTypeID );
+
+    try {parseTimed(ParseStage::ApplyAftParseRestrictions, applyAftParseRestrictions);}
+    catch (...) {
+      ParseEvent event(ParseEventType::Exception);
+      event.exception = std::current_exception();
+      chunkPtr->events.push_back(std::move(event));
+      continue;
+    }
 
-        case Parrot::ParsingErrorPolicy::Warning :
-          BCG::writeWarning( parseMessage( missingKeywordTextMandatory) );
-          content.addElement(currentKeyword, typedValue, false, true);
-          break;
+    if (flagConditionHandled) {parseStore(typedValue, true);}                   // a violation: mark the keyword, and it may have been reverted
+  }
 
-        case Parrot::ParsingErrorPolicy::Exception :
-          throw MissingKeywordError(THROWTEXT( parseMessage(missingKeywordTextMandatory) ));
-          break;
-      }
+  chunkPtr = nullptr;
+  statsPtr = nullptr;
+  parseResetState();
+}
+// .......................................................................... //
+void parseConstraints() {
+  for (const auto & constraint : instancePtr->getConstraints()) {
+    const auto & keywords = constraint.keywords;
+    if ( !std::all_of(keywords.begin(), keywords.end(), [] (const auto & keyword) {return contentPtr->hasKeyword(keyword);}) ) {continue;}
 
-    } else {
-      switch (missingKeywordPolicyNonMandatory) {
-        case Parrot::ParsingErrorPolicy::Ignore :
-          break;
+    parseResetState();
+    linenumber = -1;
+    for (const auto & keyword : keywords) {currentKeyword += (currentKeyword.empty() ? "" : ", ") + keyword;}
+
+    bool valid = true;
+    if (!statsPtr) {valid = constraint.check(*contentPtr);}
+    else {
+      auto tStart = ParseStats::Clock::now();
+      valid = constraint.check(*contentPtr);
+      statsPtr->addUserRestrictionTime(currentKeyword, ParseStats::Clock::now() - tStart);
+    }
+    if (valid) {continue;}
 
-        case Parrot::ParsingErrorPolicy::Silent :
-          content.addElement(currentKeyword, typedValue, false, true);
-          break;
+    bool revert = false;
+    switch (constraint.policy) {
+      case RestrictionViolationPolicy::Warning :
+        parseWarning(DiagnosticKind::RestrictionViolation, parseMessage(constraint.text) );
+        break;
 
-        case Parrot::ParsingErrorPolicy::Warning :
-          BCG::writeWarning( parseMessage( missingKeywordTextNonMandatory) );
-          content.addElement(currentKeyword, typedValue, false, true);
-          break;
+      case RestrictionViolationPolicy::WarningRevert :
+        parseWarning(DiagnosticKind::RestrictionViolation, parseMessage(constraint.text) );
+        revert = true;
+        break;
 
-        case Parrot::ParsingErrorPolicy::Exception :
-          throw MissingKeywordError(THROWTEXT( parseMessage(missingKeywordTextNonMandatory) ));
-          break;
-      }
+      case RestrictionViolationPolicy::Exception :
+        if (!errorsPtr) {
+          throw RestrictionViolationError(THROWTEXT(
+            parseMessage(constraint.text)
+          ));
+        }
+        parseError(DiagnosticKind::RestrictionViolation, constraint.text);
+        revert = true;
+        break;
     }
-  }
 
-  if (verbose) {
-    std::cout << "\nCompleted parsing file '" << source<< "' (" << linenumber << " lines)" << std::endl << std::endl;
+    for (const auto & keyword : keywords) {
+      const auto & descriptor = instancePtr->getDescriptor(keyword);
+      if ( !revert || !descriptor.getValue().has_value() ) {continue;}
+
+      std::any         aligned;
+      const std::any & value = parseAlign(descriptor.getValue(), aligned) ? aligned : descriptor.getValue();
+      contentPtr->updateElement(instancePtr->getKeywordIndex(keyword), value, contentPtr->getFoundInFile(keyword), true);
+    }
   }
 
-  return content;
+  parseResetState();
 }
 // -------------------------------------------------------------------------- //
-std::string Reader::to_string() const {
-  std::string reVal = "Parrot::Reader object\n";
-  reVal += "  comment marker                           : "s + (commentMarker         ? std::string(1, commentMarker  ) : "(none)"s) + "\n";
-  reVal += "  line continuation marker                 : "s + (multilineMarker       ? std::string(1, multilineMarker) : "(none)"s) + "\n";
-  reVal += "  assignment marker                        : "s + (assignmentMarker                                                   ) + "\n";
-  reVal += "  treat keywords case sensitively          : "s + (keywordCaseSensitive  ?                           "yes" : "no"     ) + "\n";
-  reVal += "  verbose mode                             : "s + (verbose               ?                           "yes" : "no"     ) + "\n";
-
-  reVal += "  policy for missing non-mandatory keywords: " + parsingErrorPolicyName(missingKeywordPolicyNonMandatory) + "\n";
-  reVal += "    message                                : " +                        missingKeywordTextNonMandatory + "\n";
-  reVal += "  policy for missing mandatory keywords    : " + parsingErrorPolicyName(missingKeywordPolicyMandatory) + "\n";
-  reVal += "    message                                : " +                        missingKeywordTextMandatory + "\n";
-  reVal += "  policy for unexpected keywords           : " + parsingErrorPolicyName(unexpectedKeywordPolicy) + "\n";
-  reVal += "    message                                : " +                        unexpectedKeywordText + "\n";
-  reVal += "  policy for duplicate keywords            : " + parsingErrorPolicyName(duplicateKeywordPolicy) + "\n";
-  reVal += "    message                                : " +                        duplicateKeywordText + "\n";
+std::vector<ParseChunk> parsePartition(const std::string & text, size_t count) {
+  const char  multilineMarker = instancePtr->getMultilineMarker();
+  const char  commentMarker   = instancePtr->getCommentMarker();
+  const auto  whitespace      = " \t\r\n\v\f";
+  const auto  target          = std::max(text.size() / count, minimumChunkSize);
+
+  std::vector<ParseChunk> reVal(1);
+  std::string             logical, section;                                     // logical is only assembled while it may be a section header
+  bool                    other = false;
+  size_t                  pos   = 0;
+  int                     lines = 0;
+
+  while (pos < text.size()) {
+    auto eol = text.find('\n', pos);
+    auto end = (eol == std::string::npos) ? text.size() : eol + 1;
+    ++lines;
+
+    // same trimming and continuation handling as in parseLines
+    std::string_view piece(text.data() + pos, end - pos);
+    auto first = piece.find_first_not_of(whitespace);
+    auto last  = piece.find_last_not_of (whitespace);
+    piece      = (first == std::string::npos) ? std::string_view() : piece.substr(first, last - first + 1);
+    pos        = end;
+
+    bool continued = !piece.empty() && piece.back() == multilineMarker;
+    if (continued) {piece.remove_suffix(1);}
+
+    if (!other) {
+      logical += piece;
+      other    = !logical.empty() && (logical[0] != '[' || logical[0] == commentMarker);
+    }
+    if (continued) {continue;}
 
+    // a logical line is complete
+    if (!other && !logical.empty() && logical.back() == ']') {
+      section = logical.substr(1, logical.size() - 2);
+      BCG::trim(section);
+      if ( !instancePtr->getKeywordCaseSensitive() ) {BCG::to_uppercase(section);}
+    }
+    logical.clear();
+    other = false;
 
-  reVal += "ready to extract these objects:\n";
+    if (pos - reVal.back().begin >= target && pos < text.size()) {
+      reVal.back().end = pos;
 
-  for (const auto & descriptor : descriptors) {reVal += descriptor.to_string();}
+      auto & chunk = reVal.emplace_back();
+      chunk.begin     = pos;
+      chunk.firstLine = lines;
+      chunk.section   = section;
+    }
+  }
 
+  reVal.back().end = text.size();
   return reVal;
 }
+// .......................................................................... //
+void parseChunk(const Reader * reader, const std::string & source,
+                std::vector<ParseError> * errors, bool profile,
+                const std::string & text, ParseChunk & chunk) {
+  parseResetState(true);
+  chunkPtr       = &chunk;
+  statsPtr       = profile ? &chunk.stats : nullptr;
+  errorsPtr      = errors;                                                      // only tested, never written to in a chunk
+  filename       = source;
+  foundInFile    = std::vector<bool> ( reader->size() );
+  instancePtr    = reader;
+  verboseFlag    = reader->getVerbose();
+  linenumber     = chunk.firstLine;
+  currentSection = chunk.section;
+
+  MemoryBuffer buffer(text.data() + chunk.begin, text.data() + chunk.end);
+  std::istream lines(&buffer);
+
+  try {parseLines(lines, std::string::npos);}
+  catch (...) {
+    ParseEvent event(ParseEventType::Exception);
+    event.exception = std::current_exception();
+    chunk.events.push_back(std::move(event));
+  }
 
+  chunk.linesRead = linesRead;
+  parseResetState(true);
+}
+// .......................................................................... //
+bool parseChunkLine() {
+  bool stop = false;
+
+  try {parseLine();}
+  catch (...) {
+    ParseEvent event(ParseEventType::Exception);
+    event.exception = std::current_exception();
+    chunkPtr->events.push_back(std::move(event));
+
+    // within a first occurrence, the exception only counts if the keyword
+    // turns out not to be a duplicate; otherwise, parsing would end here
+    stop = (chunkPtr->group == static_cast<size_t>(-1));
+  }
 
-// ========================================================================== //
-// Parsing Machinery implementation
-
-std::string parseMessage(std::string message) {
-  BCG::replaceAll(message, "$F", filename);
-  BCG::replaceAll(message, "$L", lineOriginal);
-  BCG::replaceAll(message, "$#", std::to_string(linenumber));
-  BCG::replaceAll(message, "$K", currentKeyword);
-  BCG::replaceAll(message, "$D", defaultValue);
-  BCG::replaceAll(message, "$V", readValue);
-  BCG::replaceAll(message, "$T", valueTypeString);
+  if (chunkPtr->group != static_cast<size_t>(-1)) {
+    chunkPtr->events[chunkPtr->group].groupSize = chunkPtr->events.size() - chunkPtr->group - 1;
+    chunkPtr->group = -1;
+  }
 
-  return message;
+  return stop;
 }
-// -------------------------------------------------------------------------- //
-void parseLine() {
-  // no parsing criteria: empty or comment
+// .......................................................................... //
+void parseMerge(std::vector<ParseChunk> & chunks) {
+  for (auto & chunk : chunks) {parseReplay(chunk);}
+  parseResetState();
+}
+// .......................................................................... //
+void parseReplay(ParseChunk & chunk) {
+  auto & events   = chunk.events;
+  auto   includer = filename;
+
+  if (!chunk.file.empty()) {filename = chunk.file;}
+
+  for (size_t i = 0; i < events.size(); ++i) {
+    auto & event = events[i];
+
+    switch (event.type) {
+      case ParseEventType::Store :
+        if (event.keywordID == std::string::npos) {
+          contentPtr->addElement(event.keyword  , event.value, event.inFile, event.handled);
+          contentPtr->setLine   (event.keyword  , event.line);
+        } else {
+          contentPtr->addElement(event.keywordID, event.value, event.inFile, event.handled);
+          contentPtr->setLine   (event.keywordID, event.line);
+        }
+        break;
 
-  if ( readValue.empty()                               ) {return;}
-  if ( readValue[0] == instancePtr->getCommentMarker() ) {return;}
+      case ParseEventType::Update :
+        if (event.keywordID == std::string::npos) {
+          contentPtr->updateElement(event.keyword  , event.value, event.inFile, event.handled);
+          contentPtr->setLine      (event.keyword  , event.line);
+        } else {
+          contentPtr->updateElement(event.keywordID, event.value, event.inFile, event.handled);
+          contentPtr->setLine      (event.keywordID, event.line);
+        }
+        break;
 
-  // ........................................................................ //
-  // partial parsers
+      case ParseEventType::Warning :
+        if (sinkPtr) {sinkPtr->write(event.record);}
+        break;
 
-  if ( splitLine                () ) {return;}
-  if ( identifyKeyword          () ) {return;}
-  if ( duplicateCheck           () ) {return;}
-  if ( preparse                 () ) {return;}
-  if ( applyPreParseRestrictions() ) {return;}
-  if ( convertToTargetType      () ) {return;}
-  if ( applyAftParseRestrictions() ) {return;}
+      case ParseEventType::Error :
+        errorsPtr->push_back(std::move(event.error));
+        break;
 
-#warning missing: after parse restrictions
+      case ParseEventType::Exception :
+        std::rethrow_exception(event.exception);
 
-  content.addElement(currentKeyword, typedValue, true, flagConditionHandled);
-}
-// .......................................................................... //
-void parseResetState(bool fullReset) {
-  lineOriginal           .clear() ;
-  currentKeyword         .clear() ;
-  defaultValue           .clear() ;
-  readValue              .clear() ;
-  valueTypeString        .clear() ;
-  typedValue             .reset() ;
-  CurrentDescriptor      .reset() ;
-  keywordID              =      -1;
-  flagConditionHandled   =   false;
+      case ParseEventType::FirstOccurrence :
+        if (!foundInFile[event.keywordID]) {
+          foundInFile[event.keywordID] = true;
+          break;
+        }
 
-  if (fullReset) {
-    filename             .clear() ;
-    foundInFile          .clear() ;
-    linenumber           =       0;
-    verboseFlag          =   false;
-    content              .reset() ;
-    instancePtr          = nullptr;
+        // an earlier chunk contains the keyword, so this line is a duplicate:
+        // discard what the chunk did with it and handle it as such
+        i += event.groupSize;
+
+        parseResetState();
+        currentKeyword = event.keyword;
+        keywordID      = event.keywordID;
+        linenumber     = event.line;
+        lineOriginal   = event.lineOriginal;
+        readValue      = event.readValue;
+        duplicateCheck();
+        break;
+
+      case ParseEventType::Validate :
+        pendingPtr->push_back(std::move(event));
+        break;
+
+      case ParseEventType::Include :
+        parseResetState();
+        linenumber   = event.line;
+        lineOriginal = event.lineOriginal;
+        parseSplice(event.file, event.section);
+        break;
+    }
   }
+
+  linesRead += chunk.linesRead;
+  if (statsPtr) {statsPtr->merge(chunk.stats);}
+
+  filename = includer;
 }
 // .......................................................................... //
 void parseShowState () {
@@ -493,7 +1978,7 @@ void parseShowState () {
   std::cout << "keywordID           " << keywordID                          << std::endl;
   std::cout << "flagConditionHandled" << flagConditionHandled               << std::endl;
   std::cout << "verboseFlag         " << verboseFlag                        << std::endl;
-//   std::cout << "content             " << content                            << std::endl;
+//   std::cout << "content             " << contentPtr                         << std::endl;
   std::cout << "instancePtr         " << instancePtr                        << std::endl;
   std::cout << std::string(80, '~') << std::endl;
 }
@@ -503,17 +1988,18 @@ bool splitLine() {
 
   if (separationIdx == std::string::npos) {
     if (verboseFlag) {
-      BCG::writeWarning("found no value in line " + std::to_string(linenumber) + ":\n" +
-                        lineOriginal
+      parseWarning(DiagnosticKind::MalformedLine,
+                   "found no value in line " + std::to_string(linenumber) + ":\n" + lineOriginal
       );
     }
     return true;
   }
 
-  currentKeyword  = readValue.substr(0, separationIdx);
-  readValue       = readValue.substr(separationIdx + 1, std::string::npos);
+  currentKeyword.assign(readValue, 0, separationIdx);                          // in place, keeping the capacity of both buffers
+  readValue     .erase (0, separationIdx + 1);
   BCG::trim(currentKeyword);
   if ( !instancePtr->getKeywordCaseSensitive() ) {BCG::to_uppercase(currentKeyword);}
+  if ( !currentSection.empty()                 ) {currentKeyword = currentSection + "." + currentKeyword;}
   return false;
 }
 // .......................................................................... //
@@ -534,20 +2020,25 @@ bool identifyKeyword() {
       case ParsingErrorPolicy::Warning :
         flagConditionHandled = true;
         update               = true;
-        BCG::writeWarning( parseMessage(instancePtr->getUnexpectedKeywordText()) );
+        parseWarning(DiagnosticKind::UnexpectedKeyword, parseMessage(instancePtr->getUnexpectedKeywordText()) );
         break;
 
       case ParsingErrorPolicy::Exception :
-        throw UndefinedKeywordError(THROWTEXT(
-          parseMessage( instancePtr->getUnexpectedKeywordText() )
-        ));
+        if (!errorsPtr) {
+          throw UndefinedKeywordError(THROWTEXT(
+            parseMessage( instancePtr->getUnexpectedKeywordText() )
+          ));
+        }
+        parseError(DiagnosticKind::UnexpectedKeyword, instancePtr->getUnexpectedKeywordText());
+        flagConditionHandled = true;
+        update               = true;
         break;
     }
   }
 
   if (update) {
     BCG::trim(readValue);
-    content.addElement(currentKeyword, readValue, true, flagConditionHandled);
+    parseStore(readValue, false);
     return true;
   }
 
@@ -570,23 +2061,40 @@ bool duplicateCheck() {
       case ParsingErrorPolicy::Warning :
         flagConditionHandled = true;
         update               = true;
-        BCG::writeWarning( parseMessage( instancePtr->getDuplicateKeywordText() ) );
+        parseWarning(DiagnosticKind::DuplicateKeyword, parseMessage( instancePtr->getDuplicateKeywordText() ) );
         break;
 
       case ParsingErrorPolicy::Exception :
-        throw DuplicateKeywordError(THROWTEXT(
-          parseMessage( instancePtr->getDuplicateKeywordText() )
-        ));
+        if (!errorsPtr) {
+          throw DuplicateKeywordError(THROWTEXT(
+            parseMessage( instancePtr->getDuplicateKeywordText() )
+          ));
+        }
+        parseError(DiagnosticKind::DuplicateKeyword, instancePtr->getDuplicateKeywordText());
+        flagConditionHandled = true;
+        update               = true;
         break;
     }
 
   } else {
     foundInFile[keywordID] = true;
+
+    if (chunkPtr) {                                                             // an earlier chunk may contain the keyword, too
+      ParseEvent event(ParseEventType::FirstOccurrence);
+      event.keyword      = currentKeyword;
+      event.keywordID    = keywordID;
+      event.line         = linenumber;
+      event.lineOriginal = lineOriginal;
+      event.readValue    = readValue;
+      chunkPtr->group    = chunkPtr->events.size();
+      chunkPtr->events.push_back(std::move(event));
+    }
   }
 
   if (update) {
     BCG::trim(readValue);
-    content.updateElement(currentKeyword, readValue, true, flagConditionHandled);
+    parseStore(readValue, true);
+    if ( instancePtr->getDeferValidation() ) {parseDefer(true);}
     return true;
   }
 
@@ -594,20 +2102,27 @@ bool duplicateCheck() {
 }
 // .......................................................................... //
 bool preparse() {
-  CurrentDescriptor = instancePtr->getDescriptor(keywordID);
-  defaultValue    = getAnyText   ( CurrentDescriptor.getValue() );
-  valueTypeID     = CurrentDescriptor.getValueTypeID();
+  CurrentDescriptor = &instancePtr->getDescriptor(keywordID);
+  defaultValue    = getAnyText   ( CurrentDescriptor->getValue() );
+  valueTypeID     = CurrentDescriptor->getValueTypeID();
   valueTypeString = valueTypeName( valueTypeID );
 
-  if (  CurrentDescriptor.isTrimLeadingWhitespaces () ) {BCG::ltrim       (readValue);}
-  if (  CurrentDescriptor.isTrimTrailingWhitespaces() ) {BCG::rtrim       (readValue);}
-  if ( !CurrentDescriptor.isCaseSensitive          () ) {BCG::to_uppercase(readValue);}
+  if (  CurrentDescriptor->isTrimLeadingWhitespaces () ) {BCG::ltrim       (readValue);}
+  if (  CurrentDescriptor->isTrimTrailingWhitespaces() ) {BCG::rtrim       (readValue);}
+  if ( !CurrentDescriptor->isCaseSensitive          () ) {BCG::to_uppercase(readValue);}
 
-  for (const auto & [substituee, substituent] : CurrentDescriptor.getSubstitutions() ) {
+  for (const auto & [substituee, substituent] : CurrentDescriptor->getSubstitutions() ) {
     BCG::replaceAll(readValue, substituee, substituent);
   }
 
-  if ( CurrentDescriptor.getUserPreParser         () ) {readValue = CurrentDescriptor.getUserPreParser()(readValue);}
+  if ( CurrentDescriptor->getUserPreParser         () ) {
+    if (!statsPtr) {readValue = CurrentDescriptor->getUserPreParser()(readValue);}
+    else {
+      auto tStart = ParseStats::Clock::now();
+      readValue = CurrentDescriptor->getUserPreParser()(readValue);
+      statsPtr->addUserPreParserTime(currentKeyword, ParseStats::Clock::now() - tStart);
+    }
+  }
 
   return false;
 }
@@ -615,11 +2130,11 @@ bool preparse() {
 bool applyPreParseRestrictions() {
   bool trigger = false;
 
-  for (const auto & restriction : CurrentDescriptor.getRestrictions()) {
+  for (const auto & restriction : CurrentDescriptor->getRestrictions()) {
     trigger = false;
 
-    auto rType = restriction.getPreParseRestrictionType();
-    auto rData = restriction.getPreParseRestriction    ();
+    const auto   rType = restriction.getPreParseRestrictionType();
+    const auto & rData = restriction.getPreParseRestriction    ();
 
     // ...................................................................... //
     // check whether a restriction has been violated
@@ -631,7 +2146,7 @@ bool applyPreParseRestrictions() {
 
       case RestrictionType::AllowedList :
         {
-          auto rList = std::any_cast<PARROT_TYPE(ValueTypeID::StringList)>(rData);
+          const auto & rList = std::any_cast<const PARROT_TYPE(ValueTypeID::StringList) &>(rData);
           auto it = std::find(rList.begin(), rList.end(), readValue);
           trigger = (it == rList.end());
         }
@@ -639,7 +2154,7 @@ bool applyPreParseRestrictions() {
 
       case RestrictionType::ForbiddenList :
         {
-          auto rList = std::any_cast<PARROT_TYPE(ValueTypeID::StringList)>(rData);
+          const auto & rList = std::any_cast<const PARROT_TYPE(ValueTypeID::StringList) &>(rData);
           auto it = std::find(rList.begin(), rList.end(), readValue);
           trigger = (it != rList.end());
         }
@@ -647,14 +2162,19 @@ bool applyPreParseRestrictions() {
 
       case RestrictionType::Range :
         if (verboseFlag) {
-          BCG::writeWarning("inconsistent state of memory -- range-based preParse restriction indicated!");
+          parseWarning(DiagnosticKind::InconsistentState, "inconsistent state of memory -- range-based preParse restriction indicated!");
         }
         break;
 
       case RestrictionType::Function :
         {
-          auto uFunc = std::any_cast<std::function<bool (const PARROT_TYPE(ValueTypeID::String) &)>>(rData);
-          trigger = !uFunc(readValue);
+          const auto & uFunc = std::any_cast<const std::function<bool (const PARROT_TYPE(ValueTypeID::String) &)> &>(rData);
+          if (!statsPtr) {trigger = !uFunc(readValue);}
+          else {
+            auto tStart = ParseStats::Clock::now();
+            trigger = !uFunc(readValue);
+            statsPtr->addUserRestrictionTime(currentKeyword, ParseStats::Clock::now() - tStart);
+          }
         }
         break;
     }
@@ -667,18 +2187,22 @@ bool applyPreParseRestrictions() {
 
       switch ( restriction.getRestrictionViolationPolicy() ) {
         case RestrictionViolationPolicy::Warning :
-          BCG::writeWarning( parseMessage(restriction.getRestrictionViolationText()) );
+          parseWarning(DiagnosticKind::RestrictionViolation, parseMessage(restriction.getRestrictionViolationText()) );
           break;
 
         case RestrictionViolationPolicy::WarningRevert :
-          BCG::writeWarning( parseMessage(restriction.getRestrictionViolationText()) );
+          parseWarning(DiagnosticKind::RestrictionViolation, parseMessage(restriction.getRestrictionViolationText()) );
           readValue = defaultValue;
           break;
 
         case RestrictionViolationPolicy::Exception :
-          throw RestrictionViolationError(THROWTEXT(
-            parseMessage(restriction.getRestrictionViolationText())
-          ));
+          if (!errorsPtr) {
+            throw RestrictionViolationError(THROWTEXT(
+              parseMessage(restriction.getRestrictionViolationText())
+            ));
+          }
+          parseError(DiagnosticKind::RestrictionViolation, restriction.getRestrictionViolationText());
+          readValue = defaultValue;
           break;
       }
     }
@@ -692,7 +2216,7 @@ bool convertToTargetType() {
 
   switch (valueTypeID) {
     case ValueTypeID::None :
-      BCG::writeWarning("inconsistent state of memory -- none type indicated!");
+      parseWarning(DiagnosticKind::InconsistentState, "inconsistent state of memory -- none type indicated!");
       return true;
 
     case ValueTypeID::String :
@@ -700,38 +2224,35 @@ bool convertToTargetType() {
       break;
 
     case ValueTypeID::Integer :
-      try {typedValue = std::stoll(readValue);}
+      try {typedValue = parseInteger(readValue);}
       catch (const std::exception& e) {flag = true;}
       break;
 
     case ValueTypeID::Real :
-      try {typedValue = std::stod(readValue);}
+      try {typedValue = parseReal(readValue);}
       catch (const std::exception& e) {flag = true;}
       break;
 
     case ValueTypeID::Boolean :
       {
-        auto yes = std::find(defaultBooleanTextTrue .begin(), defaultBooleanTextTrue .end(), readValue);
-        auto no  = std::find(defaultBooleanTextFalse.begin(), defaultBooleanTextFalse.end(), readValue);
+        auto value = instancePtr->getBooleanVocabulary().recognize(readValue);
 
-        if (yes == defaultBooleanTextTrue .end() &&
-            no  == defaultBooleanTextFalse.end()
-        )     {flag       = true                                 ;}
-        else  {typedValue = (yes != defaultBooleanTextTrue.end());}
+        if (value) {typedValue = *value;}
+        else       {flag       = true  ;}
       }
       break;
 
     case ValueTypeID::StringList :
-      typedValue = BCG::splitString(readValue, CurrentDescriptor.getListSeparator());
+      typedValue = BCG::splitString(readValue, CurrentDescriptor->getListSeparator());
       break;
 
     case ValueTypeID::IntegerList :
       {
-        auto strList = BCG::splitString(readValue, CurrentDescriptor.getListSeparator());
+        auto strList = BCG::splitString(readValue, CurrentDescriptor->getListSeparator());
         PARROT_TYPE(ValueTypeID::IntegerList) intList;
 
         for (const auto & str : strList) {
-          try {intList.push_back( std::stoll(str) );}
+          try {intList.push_back( parseInteger(str) );}
           catch (const std::exception& e) {flag = true;}
         }
 
@@ -741,11 +2262,11 @@ bool convertToTargetType() {
 
     case ValueTypeID::RealList :
       {
-        auto strList = BCG::splitString(readValue, CurrentDescriptor.getListSeparator());
+        auto strList = BCG::splitString(readValue, CurrentDescriptor->getListSeparator());
         PARROT_TYPE(ValueTypeID::RealList) realList;
 
         for (const auto & str : strList) {
-          try {realList.push_back( std::stod(str) );}
+          try {realList.push_back( parseReal(str) );}
           catch (const std::exception& e) {flag = true;}
         }
 
@@ -754,24 +2275,124 @@ bool convertToTargetType() {
       break;
 
     case ValueTypeID::BooleanList :
-      {
-        auto strList = BCG::splitString(readValue, CurrentDescriptor.getListSeparator());
+      {                                                                         // masks may hold many thousand flags: tokenize in place
+        const auto & vocabulary = instancePtr->getBooleanVocabulary();
+        const auto   separator  = CurrentDescriptor->getListSeparator();
+        std::string_view rest   = readValue;
         PARROT_TYPE(ValueTypeID::BooleanList) boolList;
 
-        decltype(strList.begin()) yes, no;
+        boolList.reserve( std::count(readValue.begin(), readValue.end(), separator) + 1 );
+
+        while (true) {
+          auto end   = rest.find(separator);
+          auto token = rest.substr(0, end);
+
+          auto first = token.find_first_not_of(" \t");
+          auto last  = token.find_last_not_of (" \t");
+          token = (first == std::string_view::npos) ? std::string_view() : token.substr(first, last - first + 1);
+
+          auto value = vocabulary.recognize(token);
+          if (value) {boolList.push_back(*value);}
+          else       {flag = true;}
+
+          if (end == std::string_view::npos) {break;}
+          rest.remove_prefix(end + 1);
+        }
+
+        typedValue = std::move(boolList);
+      }
+      break;
+
+    case ValueTypeID::RealRange :
+      {
+        auto fields = BCG::splitString(readValue, ':');
+        if (fields.size() != 3) {flag = true; break;}
+
+        try {
+          auto start = parseReal   (fields[0], true);                           // strict: reject trailing garbage, e.g. 1.5 as count
+          auto stop  = parseReal   (fields[1], true);
+          auto count = parseInteger(fields[2], true);
+
+          flag = count < 0;
+          if (!flag) {typedValue = RealRange(start, stop, count);}
+        }
+        catch (const std::exception& e) {flag = true;}
+      }
+      break;
+
+    case ValueTypeID::Int32 :
+      try {
+        auto value = parseInteger(readValue);
+        flag = value != static_cast<PARROT_TYPE(ValueTypeID::Int32)>(value);   // out of 32 bit range
+        if (!flag) {typedValue = static_cast<PARROT_TYPE(ValueTypeID::Int32)>(value);}
+      }
+      catch (const std::exception& e) {flag = true;}
+      break;
+
+    case ValueTypeID::Float32 :
+      try {typedValue = parseFloat32(readValue);}
+      catch (const std::exception& e) {flag = true;}
+      break;
+
+    case ValueTypeID::Complex :
+      try {typedValue = parseComplex(readValue);}
+      catch (const std::exception& e) {flag = true;}
+      break;
+
+    case ValueTypeID::Int32List :
+      {
+        auto strList = BCG::splitString(readValue, CurrentDescriptor->getListSeparator());
+        PARROT_TYPE(ValueTypeID::Int32List) intList;
+        intList.reserve(strList.size());
+
+        for (const auto & str : strList) {
+          try {
+            auto value = parseInteger(str);
+            if (value != static_cast<PARROT_TYPE(ValueTypeID::Int32)>(value)) {flag = true; continue;}
+            intList.push_back( static_cast<PARROT_TYPE(ValueTypeID::Int32)>(value) );
+          }
+          catch (const std::exception& e) {flag = true;}
+        }
+
+        typedValue = std::move(intList);
+      }
+      break;
+
+    case ValueTypeID::Float32List :
+      {
+        auto strList = BCG::splitString(readValue, CurrentDescriptor->getListSeparator());
+        PARROT_TYPE(ValueTypeID::Float32List) realList;
+        realList.reserve(strList.size());
 
-        for (auto & str : strList) {
-          BCG::trim(str);
-          yes = std::find(defaultBooleanTextTrue .begin(), defaultBooleanTextTrue .end(), str);
-          no  = std::find(defaultBooleanTextFalse.begin(), defaultBooleanTextFalse.end(), str);
+        for (const auto & str : strList) {
+          try {realList.push_back( parseFloat32(str) );}
+          catch (const std::exception& e) {flag = true;}
+        }
+
+        typedValue = std::move(realList);
+      }
+      break;
 
-          if (yes == defaultBooleanTextTrue .end() &&
-              no  == defaultBooleanTextFalse.end()
-          )     {flag = true; std::cout << "### trigger: '" << str << "'" << std::endl;}
-          else  {boolList.push_back(yes != defaultBooleanTextTrue.end());}
+    case ValueTypeID::ComplexList :
+      {                                                                         // the separator may appear within (re, im)
+        const auto separator = CurrentDescriptor->getListSeparator();
+        PARROT_TYPE(ValueTypeID::ComplexList) complexList;
+
+        size_t begin = 0;
+        int    depth = 0;
+        for (size_t i = 0; i <= readValue.size(); ++i) {
+          if (i < readValue.size()) {
+            if      (readValue[i] == '(') {++depth; continue;}
+            else if (readValue[i] == ')') {--depth; continue;}
+            else if (readValue[i] != separator || depth > 0) {continue;}
+          }
+
+          try {complexList.push_back( parseComplex(readValue.substr(begin, i - begin)) );}
+          catch (const std::exception& e) {flag = true;}
+          begin = i + 1;
         }
 
-        typedValue = boolList;
+        typedValue = std::move(complexList);
       }
       break;
   }
@@ -784,18 +2405,22 @@ bool convertToTargetType() {
         break;
 
       case ParsingErrorPolicy::Silent :
-        typedValue = CurrentDescriptor.getValue();
+        typedValue = CurrentDescriptor->getValue();
         break;
 
       case ParsingErrorPolicy::Warning :
-        typedValue = CurrentDescriptor.getValue();
-        BCG::writeWarning( parseMessage(instancePtr->getConversionErrorText()) );
+        typedValue = CurrentDescriptor->getValue();
+        parseWarning(DiagnosticKind::ConversionError, parseMessage(instancePtr->getConversionErrorText()) );
         break;
 
       case ParsingErrorPolicy::Exception :
-        throw KeywordParseError(THROWTEXT(
-          parseMessage(instancePtr->getConversionErrorText())
-        ));
+        if (!errorsPtr) {
+          throw KeywordParseError(THROWTEXT(
+            parseMessage(instancePtr->getConversionErrorText())
+          ));
+        }
+        parseError(DiagnosticKind::ConversionError, instancePtr->getConversionErrorText());
+        typedValue = CurrentDescriptor->getValue();
         break;
     }
   }
@@ -806,11 +2431,11 @@ bool convertToTargetType() {
 bool applyAftParseRestrictions() {
   bool trigger = false;
 
-  for (const auto & restriction : CurrentDescriptor.getRestrictions()) {
+  for (const auto & restriction : CurrentDescriptor->getRestrictions()) {
     trigger = false;
 
-    auto rType = restriction.getAftParseRestrictionType();
-    auto rData = restriction.getAftParseRestriction    ();
+    const auto   rType = restriction.getAftParseRestrictionType();
+    const auto & rData = restriction.getAftParseRestriction    ();
 
     // ...................................................................... //
     // check whether a restriction has been violated
@@ -829,11 +2454,16 @@ bool applyAftParseRestrictions() {
       // trigger = (trigger != (rType == RestrictionType::ForbiddenList));
 
     } else if (rType == RestrictionType::Range) {
-      applyAftParseRestrictionsRangeBased(rData);
+      trigger = applyAftParseRestrictionsRangeBased(rData);
 
     } else if (rType == RestrictionType::Function) {
-#     warning todo
-
+      const auto & validator = restriction.getAftParseValidator();
+      if (!statsPtr) {trigger = !validator(typedValue);}
+      else {
+        auto tStart = ParseStats::Clock::now();
+        trigger = !validator(typedValue);
+        statsPtr->addUserRestrictionTime(currentKeyword, ParseStats::Clock::now() - tStart);
+      }
     }
 
     // ...................................................................... //
@@ -844,18 +2474,22 @@ bool applyAftParseRestrictions() {
 
       switch ( restriction.getRestrictionViolationPolicy() ) {
         case RestrictionViolationPolicy::Warning :
-          BCG::writeWarning( parseMessage(restriction.getRestrictionViolationText()) );
+          parseWarning(DiagnosticKind::RestrictionViolation, parseMessage(restriction.getRestrictionViolationText()) );
           break;
 
         case RestrictionViolationPolicy::WarningRevert :
-          BCG::writeWarning( parseMessage(restriction.getRestrictionViolationText()) );
+          parseWarning(DiagnosticKind::RestrictionViolation, parseMessage(restriction.getRestrictionViolationText()) );
           typedValue = instancePtr->getDescriptors()[keywordID].getValue();
           break;
 
         case RestrictionViolationPolicy::Exception :
-          throw RestrictionViolationError(THROWTEXT(
-            parseMessage(restriction.getRestrictionViolationText())
-          ));
+          if (!errorsPtr) {
+            throw RestrictionViolationError(THROWTEXT(
+              parseMessage(restriction.getRestrictionViolationText())
+            ));
+          }
+          parseError(DiagnosticKind::RestrictionViolation, restriction.getRestrictionViolationText());
+          typedValue = instancePtr->getDescriptors()[keywordID].getValue();
           break;
       }
     }
@@ -870,13 +2504,13 @@ bool applyAftParseRestrictionsListBased(const Parrot::RestrictionType rType, con
   switch (valueTypeID) {
     case ValueTypeID::None :
       if (verboseFlag) {
-        BCG::writeWarning("inconsistent state of memory -- none-typed object indicated!");
+        parseWarning(DiagnosticKind::InconsistentState, "inconsistent state of memory -- none-typed object indicated!");
       }
       break;
 
     case ValueTypeID::String :
     {
-      auto rList = std::any_cast<PARROT_TYPE(ValueTypeID::StringList)>(rData);
+      const auto & rList = std::any_cast<const PARROT_TYPE(ValueTypeID::StringList) &>(rData);
       auto it    = std::find(rList.begin(), rList.end(),
                              readValue                                      // avoid re-cast as in: std::any_cast<PARROT_TYPE(ValueTypeID::String)>(typedValue)
                             );
@@ -886,7 +2520,7 @@ bool applyAftParseRestrictionsListBased(const Parrot::RestrictionType rType, con
 
     case ValueTypeID::Integer :
     {
-      auto rList = std::any_cast<PARROT_TYPE(ValueTypeID::IntegerList)>(rData);
+      const auto & rList = std::any_cast<const PARROT_TYPE(ValueTypeID::IntegerList) &>(rData);
       auto it    = std::find(rList.begin(), rList.end(),
                              std::any_cast<PARROT_TYPE(ValueTypeID::Integer)>(typedValue)
                             );
@@ -896,7 +2530,7 @@ bool applyAftParseRestrictionsListBased(const Parrot::RestrictionType rType, con
 
     case ValueTypeID::Real :
     {
-      auto rList = std::any_cast<PARROT_TYPE(ValueTypeID::RealList)>(rData);
+      const auto & rList = std::any_cast<const PARROT_TYPE(ValueTypeID::RealList) &>(rData);
       auto it    = std::find(rList.begin(), rList.end(),
                              std::any_cast<PARROT_TYPE(ValueTypeID::Real)>(typedValue)
                             );
@@ -906,14 +2540,14 @@ bool applyAftParseRestrictionsListBased(const Parrot::RestrictionType rType, con
 
     case ValueTypeID::Boolean :
       if (verboseFlag) {
-        BCG::writeWarning("inconsistent state of memory -- list-based aftParse restriction on boolean indicated!");
+        parseWarning(DiagnosticKind::InconsistentState, "inconsistent state of memory -- list-based aftParse restriction on boolean indicated!");
       }
       break;
 
     case ValueTypeID::StringList :
     {
-      auto rList = std::any_cast<PARROT_TYPE(ValueTypeID::StringList)>(rData);
-      auto iList = std::any_cast<PARROT_TYPE(ValueTypeID::StringList)>(typedValue);
+      const auto & rList = std::any_cast<const PARROT_TYPE(ValueTypeID::StringList) &>(rData);
+      const auto & iList = std::any_cast<const PARROT_TYPE(ValueTypeID::StringList) &>(typedValue);
 
       if (rType == RestrictionType::ForbiddenList) {trigger = true;}        // because of later negation...
 
@@ -928,8 +2562,8 @@ bool applyAftParseRestrictionsListBased(const Parrot::RestrictionType rType, con
 
     case ValueTypeID::IntegerList :
     {
-      auto rList = std::any_cast<PARROT_TYPE(ValueTypeID::IntegerList)>(rData);
-      auto iList = std::any_cast<PARROT_TYPE(ValueTypeID::IntegerList)>(typedValue);
+      const auto & rList = std::any_cast<const PARROT_TYPE(ValueTypeID::IntegerList) &>(rData);
+      const auto & iList = std::any_cast<const PARROT_TYPE(ValueTypeID::IntegerList) &>(typedValue);
 
       if (rType == RestrictionType::ForbiddenList) {trigger = true;}        // because of later negation...
 
@@ -944,8 +2578,8 @@ bool applyAftParseRestrictionsListBased(const Parrot::RestrictionType rType, con
 
     case ValueTypeID::RealList :
     {
-      auto rList = std::any_cast<PARROT_TYPE(ValueTypeID::RealList)>(rData);
-      auto iList = std::any_cast<PARROT_TYPE(ValueTypeID::RealList)>(typedValue);
+      const auto & rList = std::any_cast<const PARROT_TYPE(ValueTypeID::RealList) &>(rData);
+      const auto & iList = std::any_cast<const PARROT_TYPE(ValueTypeID::RealList) &>(typedValue);
 
       if (rType == RestrictionType::ForbiddenList) {trigger = true;}        // because of later negation...
 
@@ -961,7 +2595,85 @@ bool applyAftParseRestrictionsListBased(const Parrot::RestrictionType rType, con
 
     case ValueTypeID::BooleanList :
       if (verboseFlag) {
-        BCG::writeWarning("inconsistent state of memory -- list-based aftParse restriction on boolean list indicated!");
+        parseWarning(DiagnosticKind::InconsistentState, "inconsistent state of memory -- list-based aftParse restriction on boolean list indicated!");
+      }
+      break;
+
+    case ValueTypeID::RealRange :
+    {
+      const auto & rList = std::any_cast<const PARROT_TYPE(ValueTypeID::RealList ) &>(rData);
+      const auto & range = std::any_cast<const PARROT_TYPE(ValueTypeID::RealRange) &>(typedValue);
+
+      if (rType == RestrictionType::ForbiddenList) {trigger = true;}        // because of later negation...
+
+      for (auto item : range) {                                             // no way around visiting each element here
+        auto it = std::find(rList.begin(), rList.end(), item);
+
+        if (rType == RestrictionType::ForbiddenList)  {trigger &= (it == rList.end());}
+        else                                          {trigger |= (it == rList.end());}
+      }
+    }
+      break;
+
+    case ValueTypeID::Int32 :
+    {
+      const auto & rList = std::any_cast<const PARROT_TYPE(ValueTypeID::IntegerList) &>(rData);
+      auto it    = std::find(rList.begin(), rList.end(),
+                             std::any_cast<PARROT_TYPE(ValueTypeID::Int32)>(typedValue)
+                            );
+      trigger = (it == rList.end());
+    }
+      break;
+
+    case ValueTypeID::Float32 :
+    {
+      const auto & rList = std::any_cast<const PARROT_TYPE(ValueTypeID::RealList) &>(rData);
+      auto item  = std::any_cast<PARROT_TYPE(ValueTypeID::Float32)>(typedValue);
+      auto it    = std::find_if(rList.begin(), rList.end(),
+                                [item] (auto r) {return parseFitsFloat32(r) && static_cast<PARROT_TYPE(ValueTypeID::Float32)>(r) == item;}   // compare at the stored precision
+                               );
+      trigger = (it == rList.end());
+    }
+      break;
+
+    case ValueTypeID::Int32List :
+    {
+      const auto & rList = std::any_cast<const PARROT_TYPE(ValueTypeID::IntegerList) &>(rData);
+      const auto & iList = std::any_cast<const PARROT_TYPE(ValueTypeID::Int32List  ) &>(typedValue);
+
+      if (rType == RestrictionType::ForbiddenList) {trigger = true;}        // because of later negation...
+
+      for (auto item : iList) {
+        auto it = std::find(rList.begin(), rList.end(), item);
+
+        if (rType == RestrictionType::ForbiddenList)  {trigger &= (it == rList.end());}
+        else                                          {trigger |= (it == rList.end());}
+      }
+    }
+      break;
+
+    case ValueTypeID::Float32List :
+    {
+      const auto & rList = std::any_cast<const PARROT_TYPE(ValueTypeID::RealList   ) &>(rData);
+      const auto & iList = std::any_cast<const PARROT_TYPE(ValueTypeID::Float32List) &>(typedValue);
+
+      if (rType == RestrictionType::ForbiddenList) {trigger = true;}        // because of later negation...
+
+      for (auto item : iList) {
+        auto it = std::find_if(rList.begin(), rList.end(),
+                               [item] (auto r) {return parseFitsFloat32(r) && static_cast<PARROT_TYPE(ValueTypeID::Float32)>(r) == item;}
+                              );
+
+        if (rType == RestrictionType::ForbiddenList)  {trigger &= (it == rList.end());}
+        else                                          {trigger |= (it == rList.end());}
+      }
+    }
+      break;
+
+    case ValueTypeID::Complex     :
+    case ValueTypeID::ComplexList :
+      if (verboseFlag) {
+        parseWarning(DiagnosticKind::InconsistentState, "inconsistent state of memory -- list-based aftParse restriction on complex value indicated!");
       }
       break;
 
@@ -978,13 +2690,13 @@ bool applyAftParseRestrictionsRangeBased(const std::any & rData) {
   switch (valueTypeID) {
     case ValueTypeID::None :
       if (verboseFlag) {
-        BCG::writeWarning("inconsistent state of memory -- none-typed object indicated!");
+        parseWarning(DiagnosticKind::InconsistentState, "inconsistent state of memory -- none-typed object indicated!");
       }
       break;
 
     case ValueTypeID::String :
       if (verboseFlag) {
-        BCG::writeWarning("inconsistent state of memory -- range-based aftParse restriction on string indicated!");
+        parseWarning(DiagnosticKind::InconsistentState, "inconsistent state of memory -- range-based aftParse restriction on string indicated!");
       }
       break;
 
@@ -1006,19 +2718,19 @@ bool applyAftParseRestrictionsRangeBased(const std::any & rData) {
 
     case ValueTypeID::Boolean :
       if (verboseFlag) {
-        BCG::writeWarning("inconsistent state of memory -- range-based aftParse restriction on boolean indicated!");
+        parseWarning(DiagnosticKind::InconsistentState, "inconsistent state of memory -- range-based aftParse restriction on boolean indicated!");
       }
       break;
 
     case ValueTypeID::StringList :
       if (verboseFlag) {
-        BCG::writeWarning("inconsistent state of memory -- range-based aftParse restriction on string list indicated!");
+        parseWarning(DiagnosticKind::InconsistentState, "inconsistent state of memory -- range-based aftParse restriction on string list indicated!");
       }
       break;
 
     case ValueTypeID::IntegerList :
     {
-      auto items = std::any_cast<PARROT_TYPE(ValueTypeID::IntegerList)>(typedValue);
+      const auto & items = std::any_cast<const PARROT_TYPE(ValueTypeID::IntegerList) &>(typedValue);
       for (auto & item : items) {
         trigger |= ( (item < range.first) || (item > range.second) || (std::isnan(item)) );
       }
@@ -1027,7 +2739,7 @@ bool applyAftParseRestrictionsRangeBased(const std::any & rData) {
 
     case ValueTypeID::RealList :
     {
-      auto items = std::any_cast<PARROT_TYPE(ValueTypeID::RealList)>(typedValue);
+      const auto & items = std::any_cast<const PARROT_TYPE(ValueTypeID::RealList) &>(typedValue);
       for (auto & item : items) {
         trigger |= ( (item < range.first) || (item > range.second) || (std::isnan(item)) );
       }
@@ -1036,7 +2748,56 @@ bool applyAftParseRestrictionsRangeBased(const std::any & rData) {
 
     case ValueTypeID::BooleanList :
       if (verboseFlag) {
-        BCG::writeWarning("inconsistent state of memory -- range-based aftParse restriction on boolean list indicated!");
+        parseWarning(DiagnosticKind::InconsistentState, "inconsistent state of memory -- range-based aftParse restriction on boolean list indicated!");
+      }
+      break;
+
+    case ValueTypeID::RealRange :
+    {
+      const auto & items = std::any_cast<const PARROT_TYPE(ValueTypeID::RealRange) &>(typedValue);
+      if (!items.empty()) {                                                 // the extremes are the end points: no need to visit each element
+        trigger = ( (items.min() < range.first) || (items.max() > range.second) ||
+                    std::isnan(items.getStart()) || std::isnan(items.getStop()) );
+      }
+    }
+      break;
+
+    case ValueTypeID::Int32 :
+    {
+      auto item  = std::any_cast<PARROT_TYPE(ValueTypeID::Int32)>(typedValue);
+      trigger = ( (item < range.first) || (item > range.second) );
+    }
+      break;
+
+    case ValueTypeID::Float32 :
+    {
+      auto item  = std::any_cast<PARROT_TYPE(ValueTypeID::Float32)>(typedValue);
+      trigger = ( (item < range.first) || (item > range.second) || (std::isnan(item)) );
+    }
+      break;
+
+    case ValueTypeID::Int32List :
+    {
+      const auto & items = std::any_cast<const PARROT_TYPE(ValueTypeID::Int32List) &>(typedValue);
+      for (auto item : items) {
+        trigger |= ( (item < range.first) || (item > range.second) );
+      }
+    }
+      break;
+
+    case ValueTypeID::Float32List :
+    {
+      const auto & items = std::any_cast<const PARROT_TYPE(ValueTypeID::Float32List) &>(typedValue);
+      for (auto item : items) {
+        trigger |= ( (item < range.first) || (item > range.second) || (std::isnan(item)) );
+      }
+    }
+      break;
+
+    case ValueTypeID::Complex     :
+    case ValueTypeID::ComplexList :
+      if (verboseFlag) {
+        parseWarning(DiagnosticKind::InconsistentState, "inconsistent state of memory -- range-based aftParse restriction on complex value indicated!");
       }
       break;
   }
@@ -23,121 +23,6 @@ using namespace Parrot;
 
 #define THROWTEXT(msg) ("RUNTIME EXCEPTION IN "s + (__PRETTY_FUNCTION__) + "\n"s + msg)
 
-// ========================================================================== //
-// Rectifyers
-
-void Restriction::rectify_AftParseValidationList () {
-  /* You can pass a std::vector<T> as a restriction list, but in the end they
-   * have to be regular Parrot types. This function attempts to convert to the
-   * supported types.
-   *
-   * Essentially, this is a long type name lookup.
-   */
-
-  auto t_ID = aftParseRestriction.type().name();
-
-  // do nothing if the list type is a parrot native list
-  if (
-    t_ID == TypeIDString_StringList  ||
-    t_ID == TypeIDString_IntegerList ||
-    t_ID == TypeIDString_RealList
-  ) {return;}
-
-  // otherwise, try to find and convert to an apt list type
-  auto type = BCG::demangle( aftParseRestriction.type().name() );
-
-  // ........................................................................ //
-  // int types
-  if        (type == "std::vector<char, std::allocator<char> >"              ) {
-    std::vector<PARROT_TYPE(ValueTypeID::Integer)> newVal;
-
-    auto src = std::any_cast< std::vector<char> >(aftParseRestriction);
-    newVal.reserve(src.size());
-    std::transform(src.begin(), src.end(),
-                   std::back_inserter(newVal),
-                   [] (auto & v) {return PARROT_TYPE(ValueTypeID::Integer)(v);}
-                   );
-
-    aftParseRestriction    = newVal;
-
-  } else if (type == "std::vector<short, std::allocator<short> >"            ) {
-    std::vector<PARROT_TYPE(ValueTypeID::Integer)> newVal;
-
-    auto src = std::any_cast< std::vector<short> >(aftParseRestriction);
-    newVal.reserve(src.size());
-    std::transform(src.begin(), src.end(),
-                   std::back_inserter(newVal),
-                   [] (auto & v) {return PARROT_TYPE(ValueTypeID::Integer)(v);}
-                   );
-
-    aftParseRestriction    = newVal;
-
-  } else if (type == "std::vector<int, std::allocator<int> >"                ) {
-    std::vector<PARROT_TYPE(ValueTypeID::Integer)> newVal;
-
-    auto src = std::any_cast< std::vector<int> >(aftParseRestriction);
-    newVal.reserve(src.size());
-    std::transform(src.begin(), src.end(),
-                   std::back_inserter(newVal),
-                   [] (auto & v) {return PARROT_TYPE(ValueTypeID::Integer)(v);}
-                   );
-
-    aftParseRestriction    = newVal;
-
-  } else if (type == "std::vector<long, std::allocator<long> >"              ) {
-    std::vector<PARROT_TYPE(ValueTypeID::Integer)> newVal;
-
-    auto src = std::any_cast< std::vector<long> >(aftParseRestriction);
-    newVal.reserve(src.size());
-    std::transform(src.begin(), src.end(),
-                   std::back_inserter(newVal),
-                   [] (auto & v) {return PARROT_TYPE(ValueTypeID::Integer)(v);}
-                   );
-
-    aftParseRestriction    = newVal;
-
-
-  // ........................................................................ //
-  // real types
-
-  } else if (type == "std::vector<float, std::allocator<float> >"            ) {
-    std::vector<PARROT_TYPE(ValueTypeID::Real)> newVal;
-
-    auto src = std::any_cast< std::vector<float> >(aftParseRestriction);
-    newVal.reserve(src.size());
-    std::transform(src.begin(), src.end(),
-                   std::back_inserter(newVal),
-                   [] (auto & v) {return PARROT_TYPE(ValueTypeID::Real)(v);}
-                   );
-
-    aftParseRestriction = newVal;
-
-  } else if (type == "std::vector<long double, std::allocator<long double> >") {
-    std::vector<PARROT_TYPE(ValueTypeID::Real)> newVal;
-
-    auto src = std::any_cast< std::vector<long double> >(aftParseRestriction);
-    newVal.reserve(src.size());
-    std::transform(src.begin(), src.end(),
-                   std::back_inserter(newVal),
-                   [] (auto & v) {return PARROT_TYPE(ValueTypeID::Real)(v);}
-                   );
-
-
-    aftParseRestriction = newVal;
-
-
-  // ........................................................................ //
-  // string types
-
-  } else if (type == "std::vector<char const*, std::allocator<char const*> >") {
-    const auto & old = std::any_cast< std::vector<char const *> >(aftParseRestriction);
-    aftParseRestriction = std::vector<PARROT_TYPE(ValueTypeID::String)>(old.begin(), old.end());
-
-
-
-  } else {throw Parrot::ValueTypeError(THROWTEXT("    List type "s + type + " not compatible with Parrot."));}
-}
-
 // ========================================================================== //
 // CTor, DTor
 
@@ -183,6 +68,7 @@ const std::any &  Restriction::getPreParseRestriction    () const {return prePar
 // -------------------------------------------------------------------------- //
 RestrictionType   Restriction::getAftParseRestrictionType() const {return aftParseRestrictionType;}
 const std::any &  Restriction::getAftParseRestriction    () const {return aftParseRestriction;}
+const Validator & Restriction::getAftParseValidator      () const {return aftParseValidator;}
 // -------------------------------------------------------------------------- //
 const std::pair<PARROT_TYPE(ValueTypeID::Real), PARROT_TYPE(ValueTypeID::Real)> Restriction::getAftParseRange() const {
   if (aftParseRestrictionType != RestrictionType::Range) {
@@ -242,11 +128,13 @@ void Restriction::resetAftParseRestriction() {
   restrictionValueTypeID  = RestrictionValueTypeID::None;
   aftParseRestrictionType = RestrictionType::None;
   aftParseRestriction.reset();
+  aftParseValidator       = Validator();
 }
 // -------------------------------------------------------------------------- //
 void Restriction::setAftParseRange(const PARROT_TYPE(ValueTypeID::Real) min, const PARROT_TYPE(ValueTypeID::Real) max) {
   aftParseRestrictionType = RestrictionType::Range;
   aftParseRestriction     = std::make_pair(min, max);
+  aftParseValidator       = Validator();
   restrictionValueTypeID  = RestrictionValueTypeID::Numeric;
 }
 // -------------------------------------------------------------------------- //
@@ -274,101 +162,27 @@ void Restriction::setPreParseValidationFunction(const std::function<bool (const
   preParseRestriction     = uFunc;
 }
 // -------------------------------------------------------------------------- //
-/* These functions below are given type-explicit for two reasons:
- * * functions need to be re-cast from any. Getting that right from the typeID
- *    is ridiculously hard to get right, with all the const, ref, ... degrees of
- *    freedom. Like this, I just fix the form
- * * They actually differ by what restrictionValueTypeID they set. Generalizing
- *    this is just not worth it.
+/* These functions below are given type-explicit since they differ by what
+ * restrictionValueTypeID they set, and since overloads let the compiler pick
+ * the right function type from a plain function pointer. The actual work is
+ * done by setAftParseValidator, which binds the function to its ValueTypeID.
  */
 // .......................................................................... //
-void Restriction::setAftParseValidationFunction(const std::function<bool (const PARROT_TYPE(ValueTypeID::String     ) &)> & uFunc) {
-  if ( !uFunc ) {throw Parrot::InvalidFunctionError(THROWTEXT("    Uninitialized parsing function"));}
-
-  auto ptr = (void *) uFunc.target<bool(*) (const PARROT_TYPE(ValueTypeID::String) &)>();
-  if ( !ptr   ) {throw Parrot::InvalidFunctionError(THROWTEXT("    Uninitialized validation function"));}
-
-  aftParseRestrictionType = RestrictionType::Function;
-  aftParseRestriction     = uFunc;
-  restrictionValueTypeID  = RestrictionValueTypeID::String;
-}
-// .......................................................................... //
-void Restriction::setAftParseValidationFunction(const std::function<bool (const PARROT_TYPE(ValueTypeID::Integer    ) &)> & uFunc) {
-  if ( !uFunc ) {throw Parrot::InvalidFunctionError(THROWTEXT("    Uninitialized parsing function"));}
-
-  auto ptr = (void *) uFunc.target<bool(*) (const PARROT_TYPE(ValueTypeID::Integer) &)>();
-  if ( !ptr   ) {throw Parrot::InvalidFunctionError(THROWTEXT("    Uninitialized validation function"));}
-
-  aftParseRestrictionType = RestrictionType::Function;
-  aftParseRestriction     = uFunc;
-  restrictionValueTypeID  = RestrictionValueTypeID::Integer;
-}
-// .......................................................................... //
-void Restriction::setAftParseValidationFunction(const std::function<bool (const PARROT_TYPE(ValueTypeID::Real       ) &)> & uFunc) {
-  if ( !uFunc ) {throw Parrot::InvalidFunctionError(THROWTEXT("    Uninitialized parsing function"));}
-
-  auto ptr = (void *) uFunc.target<bool(*) (const PARROT_TYPE(ValueTypeID::Real) &)>();
-  if ( !ptr   ) {throw Parrot::InvalidFunctionError(THROWTEXT("    Uninitialized validation function"));}
-
-  aftParseRestrictionType = RestrictionType::Function;
-  aftParseRestriction     = uFunc;
-  restrictionValueTypeID  = RestrictionValueTypeID::Real;
-}
-// .......................................................................... //
-void Restriction::setAftParseValidationFunction(const std::function<bool (const PARROT_TYPE(ValueTypeID::Boolean    ) &)> & uFunc) {
-  if ( !uFunc ) {throw Parrot::InvalidFunctionError(THROWTEXT("    Uninitialized parsing function"));}
-
-  auto ptr = (void *) uFunc.target<bool(*) (const PARROT_TYPE(ValueTypeID::Boolean) &)>();
-  if ( !ptr   ) {throw Parrot::InvalidFunctionError(THROWTEXT("    Uninitialized validation function"));}
-
-  aftParseRestrictionType = RestrictionType::Function;
-  aftParseRestriction     = uFunc;
-  restrictionValueTypeID  = RestrictionValueTypeID::Boolean;
-}
-// .......................................................................... //
-void Restriction::setAftParseValidationFunction(const std::function<bool (const PARROT_TYPE(ValueTypeID::StringList ) &)> & uFunc) {
-  if ( !uFunc ) {throw Parrot::InvalidFunctionError(THROWTEXT("    Uninitialized parsing function"));}
-
-  auto ptr = (void *) uFunc.target<bool(*) (const PARROT_TYPE(ValueTypeID::StringList) &)>();
-  if ( !ptr   ) {throw Parrot::InvalidFunctionError(THROWTEXT("    Uninitialized validation function"));}
-
-  aftParseRestrictionType = RestrictionType::Function;
-  aftParseRestriction     = uFunc;
-  restrictionValueTypeID  = RestrictionValueTypeID::StringList;
-}
-// .......................................................................... //
-void Restriction::setAftParseValidationFunction(const std::function<bool (const PARROT_TYPE(ValueTypeID::IntegerList) &)> & uFunc) {
-  if ( !uFunc ) {throw Parrot::InvalidFunctionError(THROWTEXT("    Uninitialized parsing function"));}
-
-  auto ptr = (void *) uFunc.target<bool(*) (const PARROT_TYPE(ValueTypeID::IntegerList) &)>();
-  if ( !ptr   ) {throw Parrot::InvalidFunctionError(THROWTEXT("    Uninitialized validation function"));}
-
-  aftParseRestrictionType = RestrictionType::Function;
-  aftParseRestriction     = uFunc;
-  restrictionValueTypeID  = RestrictionValueTypeID::IntegerList;
-}
-// .......................................................................... //
-void Restriction::setAftParseValidationFunction(const std::function<bool (const PARROT_TYPE(ValueTypeID::RealList   ) &)> & uFunc) {
-  if ( !uFunc ) {throw Parrot::InvalidFunctionError(THROWTEXT("    Uninitialized parsing function"));}
-
-  auto ptr = (void *) uFunc.target<bool(*) (const PARROT_TYPE(ValueTypeID::RealList) &)>();
-  if ( !ptr   ) {throw Parrot::InvalidFunctionError(THROWTEXT("    Uninitialized validation function"));}
-
-  aftParseRestrictionType = RestrictionType::Function;
-  aftParseRestriction     = uFunc;
-  restrictionValueTypeID  = RestrictionValueTypeID::RealList;
-}
-// .......................................................................... //
-void Restriction::setAftParseValidationFunction(const std::function<bool (const PARROT_TYPE(ValueTypeID::BooleanList) &)> & uFunc) {
-  if ( !uFunc ) {throw Parrot::InvalidFunctionError(THROWTEXT("    Uninitialized parsing function"));}
-
-  auto ptr = (void *) uFunc.target<bool(*) (const PARROT_TYPE(ValueTypeID::BooleanList) &)>();
-  if ( !ptr   ) {throw Parrot::InvalidFunctionError(THROWTEXT("    Uninitialized validation function"));}
-
-  aftParseRestrictionType = RestrictionType::Function;
-  aftParseRestriction     = uFunc;
-  restrictionValueTypeID  = RestrictionValueTypeID::BooleanList;
-}
+void Restriction::setAftParseValidationFunction(const std::function<bool (const PARROT_TYPE(ValueTypeID::String     ) &)> & uFunc) {setAftParseValidator<ValueTypeID::String     >(uFunc, RestrictionValueTypeID::String     );}
+void Restriction::setAftParseValidationFunction(const std::function<bool (const PARROT_TYPE(ValueTypeID::Integer    ) &)> & uFunc) {setAftParseValidator<ValueTypeID::Integer    >(uFunc, RestrictionValueTypeID::Integer    );}
+void Restriction::setAftParseValidationFunction(const std::function<bool (const PARROT_TYPE(ValueTypeID::Real       ) &)> & uFunc) {setAftParseValidator<ValueTypeID::Real       >(uFunc, RestrictionValueTypeID::Real       );}
+void Restriction::setAftParseValidationFunction(const std::function<bool (const PARROT_TYPE(ValueTypeID::Boolean    ) &)> & uFunc) {setAftParseValidator<ValueTypeID::Boolean    >(uFunc, RestrictionValueTypeID::Boolean    );}
+void Restriction::setAftParseValidationFunction(const std::function<bool (const PARROT_TYPE(ValueTypeID::StringList ) &)> & uFunc) {setAftParseValidator<ValueTypeID::StringList >(uFunc, RestrictionValueTypeID::StringList );}
+void Restriction::setAftParseValidationFunction(const std::function<bool (const PARROT_TYPE(ValueTypeID::IntegerList) &)> & uFunc) {setAftParseValidator<ValueTypeID::IntegerList>(uFunc, RestrictionValueTypeID::IntegerList);}
+void Restriction::setAftParseValidationFunction(const std::function<bool (const PARROT_TYPE(ValueTypeID::RealList   ) &)> & uFunc) {setAftParseValidator<ValueTypeID::RealList   >(uFunc, RestrictionValueTypeID::RealList   );}
+void Restriction::setAftParseValidationFunction(const std::function<bool (const PARROT_TYPE(ValueTypeID::BooleanList) &)> & uFunc) {setAftParseValidator<ValueTypeID::BooleanList>(uFunc, RestrictionValueTypeID::BooleanList);}
+void Restriction::setAftParseValidationFunction(const std::function<bool (const PARROT_TYPE(ValueTypeID::RealRange  ) &)> & uFunc) {setAftParseValidator<ValueTypeID::RealRange  >(uFunc, RestrictionValueTypeID::Real       );}
+void Restriction::setAftParseValidationFunction(const std::function<bool (const PARROT_TYPE(ValueTypeID::Int32      ) &)> & uFunc) {setAftParseValidator<ValueTypeID::Int32      >(uFunc, RestrictionValueTypeID::Integer    );}
+void Restriction::setAftParseValidationFunction(const std::function<bool (const PARROT_TYPE(ValueTypeID::Float32    ) &)> & uFunc) {setAftParseValidator<ValueTypeID::Float32    >(uFunc, RestrictionValueTypeID::Real       );}
+void Restriction::setAftParseValidationFunction(const std::function<bool (const PARROT_TYPE(ValueTypeID::Complex    ) &)> & uFunc) {setAftParseValidator<ValueTypeID::Complex    >(uFunc, RestrictionValueTypeID::None       );}
+void Restriction::setAftParseValidationFunction(const std::function<bool (const PARROT_TYPE(ValueTypeID::Int32List  ) &)> & uFunc) {setAftParseValidator<ValueTypeID::Int32List  >(uFunc, RestrictionValueTypeID::IntegerList);}
+void Restriction::setAftParseValidationFunction(const std::function<bool (const PARROT_TYPE(ValueTypeID::Float32List) &)> & uFunc) {setAftParseValidator<ValueTypeID::Float32List>(uFunc, RestrictionValueTypeID::RealList   );}
+void Restriction::setAftParseValidationFunction(const std::function<bool (const PARROT_TYPE(ValueTypeID::ComplexList) &)> & uFunc) {setAftParseValidator<ValueTypeID::ComplexList>(uFunc, RestrictionValueTypeID::None       );}
 // -------------------------------------------------------------------------- //
 void Restriction::setRestrictionViolationPolicy (RestrictionViolationPolicy P, const std::string & T) {
   restrictionViolationPolicy = P;
@@ -452,68 +266,7 @@ std::string Restriction::to_string() const {
       break;
       
     case RestrictionType::Function :
-      switch (restrictionValueTypeID) {
-        case RestrictionValueTypeID::String      :
-        {
-          auto obj = std::any_cast<std::function<bool    (const PARROT_TYPE(ValueTypeID::String) &)>>(aftParseRestriction);
-          auto ptr = obj.target                 <bool(*) (const PARROT_TYPE(ValueTypeID::String) &)>();
-          reVal << "    user defined function at " << (void*) *ptr;
-          break;
-        }
-        case RestrictionValueTypeID::Integer     :
-        {
-          auto obj = std::any_cast<std::function<bool    (const PARROT_TYPE(ValueTypeID::Integer) &)>>(aftParseRestriction);
-          auto ptr = obj.target                 <bool(*) (const PARROT_TYPE(ValueTypeID::Integer) &)>();
-          reVal << "    user defined function at " << (void*) *ptr;
-          break;
-        }
-        case RestrictionValueTypeID::Real        :
-        {
-          auto obj = std::any_cast<std::function<bool    (const PARROT_TYPE(ValueTypeID::Real) &)>>(aftParseRestriction);
-          auto ptr = obj.target                 <bool(*) (const PARROT_TYPE(ValueTypeID::Real) &)>();
-          reVal << "    user defined function at " << (void*) *ptr;
-          break;
-        }
-        case RestrictionValueTypeID::Boolean     :
-        {
-          auto obj = std::any_cast<std::function<bool    (const PARROT_TYPE(ValueTypeID::Boolean) &)>>(aftParseRestriction);
-          auto ptr = obj.target                 <bool(*) (const PARROT_TYPE(ValueTypeID::Boolean) &)>();
-          reVal << "    user defined function at " << (void*) *ptr;
-          break;
-        }
-        case RestrictionValueTypeID::StringList  :
-        {
-          auto obj = std::any_cast<std::function<bool    (const PARROT_TYPE(ValueTypeID::StringList) &)>>(aftParseRestriction);
-          auto ptr = obj.target                 <bool(*) (const PARROT_TYPE(ValueTypeID::StringList) &)>();
-          reVal << "    user defined function at " << (void*) *ptr;
-          break;
-        }
-        case RestrictionValueTypeID::IntegerList :
-        {
-          auto obj = std::any_cast<std::function<bool    (const PARROT_TYPE(ValueTypeID::IntegerList) &)>>(aftParseRestriction);
-          auto ptr = obj.target                 <bool(*) (const PARROT_TYPE(ValueTypeID::IntegerList) &)>();
-          reVal << "    user defined function at " << (void*) *ptr;
-          break;
-        }
-        case RestrictionValueTypeID::RealList    :
-        {
-          auto obj = std::any_cast<std::function<bool    (const PARROT_TYPE(ValueTypeID::RealList) &)>>(aftParseRestriction);
-          auto ptr = obj.target                 <bool(*) (const PARROT_TYPE(ValueTypeID::RealList) &)>();
-          reVal << "    user defined function at " << (void*) *ptr;
-          break;
-        }
-        case RestrictionValueTypeID::BooleanList :
-        {
-          auto obj = std::any_cast<std::function<bool    (const PARROT_TYPE(ValueTypeID::BooleanList) &)>>(aftParseRestriction);
-          auto ptr = obj.target                 <bool(*) (const PARROT_TYPE(ValueTypeID::BooleanList) &)>();
-          reVal << "    user defined function at " << (void*) *ptr;
-          break;
-        }
-        default          :
-          reVal << "### INVALID STATE ###";
-          break;
-      }
-
+      reVal << "    user defined function for " << valueTypeName(aftParseValidator.getValueTypeID()) << " at " << aftParseValidator.getTarget();
       reVal << "\n";
       break;
   }
@@ -0,0 +1,591 @@
+// ========================================================================== //
+// dependencies
+
+// STL
+#include <stdexcept>
+
+#include <string>
+using namespace std::string_literals;
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <limits>
+#include <map>
+#include <unordered_map>
+
+// own
+#include "BCG.hpp"
+#include "Parrot/Schema.hpp"
+#include "Parrot/Reader.hpp"
+#include "Parrot/Restriction.hpp"
+
+using namespace Parrot;
+
+// ========================================================================== //
+// local macro
+
+#define THROWTEXT(msg) ("RUNTIME EXCEPTION IN "s + (__PRETTY_FUNCTION__) + "\n"s + msg)
+
+// ========================================================================== //
+// local helpers
+
+namespace {
+  enum class Property {Type, Default, Mandatory, Min, Max, Allowed, Forbidden, Policy, Message};
+
+  const std::map<std::string, Property> properties = {
+    {"TYPE"     , Property::Type     },
+    {"DEFAULT"  , Property::Default  },
+    {"MANDATORY", Property::Mandatory},
+    {"MIN"      , Property::Min      },
+    {"MAX"      , Property::Max      },
+    {"ALLOWED"  , Property::Allowed  },
+    {"FORBIDDEN", Property::Forbidden},
+    {"POLICY"   , Property::Policy   },
+    {"MESSAGE"  , Property::Message  }
+  };
+  // ........................................................................ //
+  const std::map<std::string, ValueTypeID> valueTypeIDs = {
+    {"STRING"     , ValueTypeID::String     },
+    {"INTEGER"    , ValueTypeID::Integer    },
+    {"REAL"       , ValueTypeID::Real       },
+    {"BOOLEAN"    , ValueTypeID::Boolean    },
+    {"STRINGLIST" , ValueTypeID::StringList },
+    {"INTEGERLIST", ValueTypeID::IntegerList},
+    {"REALLIST"   , ValueTypeID::RealList   },
+    {"BOOLEANLIST", ValueTypeID::BooleanList},
+    {"REALRANGE"  , ValueTypeID::RealRange  },
+    {"INT32"      , ValueTypeID::Int32      },
+    {"FLOAT32"    , ValueTypeID::Float32    },
+    {"COMPLEX"    , ValueTypeID::Complex    },
+    {"INT32LIST"  , ValueTypeID::Int32List  },
+    {"FLOAT32LIST", ValueTypeID::Float32List},
+    {"COMPLEXLIST", ValueTypeID::ComplexList}
+  };
+  // ........................................................................ //
+  const std::map<std::string, RestrictionViolationPolicy> policies = {
+    {"WARNING"      , RestrictionViolationPolicy::Warning      },
+    {"WARNINGREVERT", RestrictionViolationPolicy::WarningRevert},
+    {"EXCEPTION"    , RestrictionViolationPolicy::Exception    }
+  };
+  // ------------------------------------------------------------------------ //
+  template<typename T>
+  T lookup(const std::map<std::string, T> & table, const std::string & name, const std::string & what) {
+    auto it = table.find( BCG::uppercase(name) );
+    if (it == table.end()) {throw ValueTypeError(THROWTEXT("    unknown " + what + " '" + name + "'"));}
+    return it->second;
+  }
+  // ........................................................................ //
+  ValueTypeID listTypeOf(ValueTypeID valueType) {                               // type of allowed and forbidden lists
+    switch (valueType) {
+      case ValueTypeID::String  :                             return ValueTypeID::StringList ;
+      case ValueTypeID::Integer : case ValueTypeID::Int32   : return ValueTypeID::IntegerList;
+      case ValueTypeID::Real    : case ValueTypeID::Float32 : return ValueTypeID::RealList   ;
+      default :
+        throw ValueTypeError(THROWTEXT("    no list restrictions for values of type " + valueTypeName(valueType)));
+    }
+  }
+  // ........................................................................ //
+  Reader makeSchemaReader() {
+    Reader reVal;
+    reVal.setVerbose                (false);
+    reVal.setKeywordCaseSensitive   (true);                                     // keyword names keep their spelling
+    reVal.setUnexpectedKeywordPolicy(ParsingErrorPolicy::Ignore   );            // each pass reads only some of the properties
+    reVal.setDuplicateKeywordPolicy (ParsingErrorPolicy::Exception);
+    reVal.setConversionErrorPolicy  (ParsingErrorPolicy::Exception);
+    return reVal;
+  }
+}
+
+// ========================================================================== //
+// schema image format
+
+/* An image is the magic line, a byte order mark and the number of keywords,
+ * followed by one record per keyword. Numbers are stored in native byte order,
+ * strings and lists are prefixed by their number of elements. Functions are
+ * represented by a flag, to be resolved through a FunctionRegistry on loading.
+ */
+
+namespace {
+  const std::string   imageMagic    = "PARROT SCHEMA IMAGE 1\n";
+  constexpr uint32_t  byteOrderMark = 0x01020304;
+
+  // ------------------------------------------------------------------------ //
+  class ImageWriter {
+  private:
+    std::string buffer;
+
+  public:
+    template<typename T>
+    void pod   (const T & x)                      {buffer.append(reinterpret_cast<const char *>(&x), sizeof(T));}
+    void flag  (bool x)                           {pod<uint8_t>(x);}
+    void raw   (const std::string & x)            {buffer += x;}
+    void text  (const std::string & x)            {pod<uint64_t>(x.size()); raw(x);}
+    void texts (const std::vector<std::string> & x) {
+      pod<uint64_t>(x.size());
+      for (const auto & element : x) {text(element);}
+    }
+
+    template<typename T>
+    void array (const std::vector<T> & x) {
+      pod<uint64_t>(x.size());
+      buffer.append(reinterpret_cast<const char *>(x.data()), x.size() * sizeof(T));
+    }
+
+    const std::string & data() const {return buffer;}
+  };
+  // ........................................................................ //
+  class ImageReader {
+  private:
+    const char *  pos;
+    const char *  end;
+    std::string   filename;
+
+    void need(uint64_t count, size_t size = 1) {
+      if ( count > uint64_t(end - pos) / size ) {throw std::runtime_error(THROWTEXT("    schema image '" + filename + "' is truncated"));}
+    }
+
+  public:
+    ImageReader(const std::string & buffer, const std::string & filename) :
+      pos(buffer.data()), end(buffer.data() + buffer.size()), filename(filename)
+    {}
+
+    template<typename T>
+    T pod() {
+      need(sizeof(T));
+      T reVal;
+      std::memcpy(&reVal, pos, sizeof(T));
+      pos += sizeof(T);
+      return reVal;
+    }
+    bool flag() {return pod<uint8_t>();}
+
+    template<typename E>
+    E enumerator(E last, const std::string & what) {                            // a byte that must not exceed last
+      auto reVal = pod<uint8_t>();
+      if ( reVal > static_cast<uint8_t>(last) ) {throw std::runtime_error(THROWTEXT("    invalid " + what + " in schema image '" + filename + "'"));}
+      return static_cast<E>(reVal);
+    }
+
+    std::string raw(size_t count) {
+      need(count);
+      std::string reVal(pos, count);
+      pos += count;
+      return reVal;
+    }
+
+    std::string text() {return raw( pod<uint64_t>() );}
+    std::vector<std::string> texts() {
+      auto count = pod<uint64_t>();
+      need(count, sizeof(uint64_t));                                            // each element is at least its length
+      std::vector<std::string> reVal(count);
+      for (auto & element : reVal) {element = text();}
+      return reVal;
+    }
+
+    template<typename T>
+    std::vector<T> array() {
+      auto count = pod<uint64_t>();
+      need(count, sizeof(T));
+      std::vector<T> reVal(count);
+      std::memcpy(reVal.data(), pos, count * sizeof(T));
+      pos += count * sizeof(T);
+      return reVal;
+    }
+
+    std::vector<bool> flags() {                                                 // std::vector<bool> is packed, so stored one byte per element
+      auto count = pod<uint64_t>();
+      need(count);
+      std::vector<bool> reVal(count);
+      for (size_t i = 0u; i < reVal.size(); ++i) {reVal[i] = flag();}
+      return reVal;
+    }
+
+    bool atEnd() const {return pos == end;}
+  };
+  // ------------------------------------------------------------------------ //
+  void writeValue(ImageWriter & image, ValueTypeID valueType, const std::any & value) {
+    image.flag( value.has_value() );
+    if ( !value.has_value() ) {return;}
+
+    switch (valueType) {
+      case ValueTypeID::None        :                                                                                         break;
+      case ValueTypeID::String      : image.text ( std::any_cast<const PARROT_TYPE(ValueTypeID::String     ) &>(value) );   break;
+      case ValueTypeID::Integer     : image.pod  ( std::any_cast<const PARROT_TYPE(ValueTypeID::Integer    ) &>(value) );   break;
+      case ValueTypeID::Real        : image.pod  ( std::any_cast<const PARROT_TYPE(ValueTypeID::Real       ) &>(value) );   break;
+      case ValueTypeID::Boolean     : image.flag ( std::any_cast<const PARROT_TYPE(ValueTypeID::Boolean    ) &>(value) );   break;
+      case ValueTypeID::Int32       : image.pod  ( std::any_cast<const PARROT_TYPE(ValueTypeID::Int32      ) &>(value) );   break;
+      case ValueTypeID::Float32     : image.pod  ( std::any_cast<const PARROT_TYPE(ValueTypeID::Float32    ) &>(value) );   break;
+      case ValueTypeID::Complex     : image.pod  ( std::any_cast<const PARROT_TYPE(ValueTypeID::Complex    ) &>(value) );   break;
+      case ValueTypeID::StringList  : image.texts( std::any_cast<const PARROT_TYPE(ValueTypeID::StringList ) &>(value) );   break;
+      case ValueTypeID::IntegerList : image.array( std::any_cast<const PARROT_TYPE(ValueTypeID::IntegerList) &>(value) );   break;
+      case ValueTypeID::RealList    : image.array( std::any_cast<const PARROT_TYPE(ValueTypeID::RealList   ) &>(value) );   break;
+      case ValueTypeID::Int32List   : image.array( std::any_cast<const PARROT_TYPE(ValueTypeID::Int32List  ) &>(value) );   break;
+      case ValueTypeID::Float32List : image.array( std::any_cast<const PARROT_TYPE(ValueTypeID::Float32List) &>(value) );   break;
+      case ValueTypeID::ComplexList : image.array( std::any_cast<const PARROT_TYPE(ValueTypeID::ComplexList) &>(value) );   break;
+
+      case ValueTypeID::BooleanList : {                                         // std::vector<bool> is packed, so store one byte per element
+        const auto & list = std::any_cast<const PARROT_TYPE(ValueTypeID::BooleanList) &>(value);
+        image.pod<uint64_t>(list.size());
+        for (bool element : list) {image.flag(element);}
+      } break;
+
+      case ValueTypeID::RealRange   : {
+        const auto & range = std::any_cast<const PARROT_TYPE(ValueTypeID::RealRange) &>(value);
+        image.pod(range.getStart());
+        image.pod(range.getStop ());
+        image.pod<uint64_t>(range.size());
+      } break;
+    }
+  }
+  // ........................................................................ //
+  std::any readValue(ImageReader & image, ValueTypeID valueType) {
+    if ( !image.flag() ) {return std::any();}
+
+    switch (valueType) {
+      case ValueTypeID::None        : return std::any();
+      case ValueTypeID::String      : return image.text ();
+      case ValueTypeID::Integer     : return image.pod  <PARROT_TYPE(ValueTypeID::Integer)>();
+      case ValueTypeID::Real        : return image.pod  <PARROT_TYPE(ValueTypeID::Real   )>();
+      case ValueTypeID::Boolean     : return image.flag ();
+      case ValueTypeID::Int32       : return image.pod  <PARROT_TYPE(ValueTypeID::Int32  )>();
+      case ValueTypeID::Float32     : return image.pod  <PARROT_TYPE(ValueTypeID::Float32)>();
+      case ValueTypeID::Complex     : return image.pod  <PARROT_TYPE(ValueTypeID::Complex)>();
+      case ValueTypeID::StringList  : return image.texts();
+      case ValueTypeID::IntegerList : return image.array<PARROT_TYPE(ValueTypeID::Integer)>();
+      case ValueTypeID::RealList    : return image.array<PARROT_TYPE(ValueTypeID::Real   )>();
+      case ValueTypeID::Int32List   : return image.array<PARROT_TYPE(ValueTypeID::Int32  )>();
+      case ValueTypeID::Float32List : return image.array<PARROT_TYPE(ValueTypeID::Float32)>();
+      case ValueTypeID::ComplexList : return image.array<PARROT_TYPE(ValueTypeID::Complex)>();
+
+      case ValueTypeID::BooleanList : return image.flags();
+
+      case ValueTypeID::RealRange   : {
+        auto start = image.pod<double  >();
+        auto stop  = image.pod<double  >();
+        auto count = image.pod<uint64_t>();
+        return RealRange(start, stop, count);
+      }
+    }
+
+    throw ValueTypeError(THROWTEXT("    invalid value type in schema image"));
+  }
+}
+
+// ========================================================================== //
+// CTors
+
+Schema::Schema(const std::vector<Descriptor> & descriptors) :
+  descriptors(descriptors)
+{}
+// .......................................................................... //
+Schema Schema::load(const std::string & source) {
+  struct Keyword {
+    std::string                             name;
+    std::streamoff                          offset = std::numeric_limits<std::streamoff>::max();
+    std::map<Property, std::string>         keys;                               // qualified name of each property in the file
+    ValueTypeID                             valueType = ValueTypeID::None;
+  };
+
+  auto reader = makeSchemaReader();
+
+  // ........................................................................ //
+  // find the keywords and their properties
+
+  std::vector<Keyword>                    keywords;
+  std::unordered_map<std::string, size_t> ids;
+
+  const auto index = reader.indexKeywords(source);
+  for (const auto & [key, entry] : index.getEntries()) {
+    if ( entry.section.empty() ) {throw InvalidDescriptorError(THROWTEXT("    property '" + key + "' outside of a keyword section in '" + source + "'"));}
+
+    auto property = properties.find( BCG::uppercase(key.substr(entry.section.size() + 1)) );
+    if (property == properties.end()) {throw InvalidDescriptorError(THROWTEXT("    unknown property '" + key + "' in '" + source + "'"));}
+
+    auto [it, isNew] = ids.try_emplace(entry.section, keywords.size());
+    if (isNew) {keywords.emplace_back().name = entry.section;}
+
+    auto & keyword = keywords[it->second];
+    keyword.keys[property->second] = key;
+    keyword.offset = std::min(keyword.offset, entry.spans.front().offset);
+  }
+
+  std::sort(keywords.begin(), keywords.end(), [] (const Keyword & a, const Keyword & b) {return a.offset < b.offset;});
+
+  auto metaDescriptor = [] (const Keyword & keyword, Property property, ValueTypeID valueType) {
+    auto key = keyword.keys.at(property);
+    auto reVal = Descriptor(key.substr(keyword.name.size() + 1), valueType, false);
+    reVal.setSection      (keyword.name);
+    reVal.setCaseSensitive(true);                                               // defaults keep their spelling
+    return reVal;
+  };
+
+  // ........................................................................ //
+  // first pass: types and everything independent of them
+
+  std::vector<Descriptor> batch;
+  for (const auto & keyword : keywords) {
+    if ( !keyword.keys.contains(Property::Type) ) {throw InvalidDescriptorError(THROWTEXT("    keyword '" + keyword.name + "' has no type in '" + source + "'"));}
+
+    for (const auto & [property, key] : keyword.keys) {
+      switch (property) {
+        case Property::Type      :
+        case Property::Policy    :
+        case Property::Message   : batch.push_back( metaDescriptor(keyword, property, ValueTypeID::String ) ); break;
+        case Property::Mandatory : batch.push_back( metaDescriptor(keyword, property, ValueTypeID::Boolean) ); break;
+        case Property::Min       :
+        case Property::Max       : batch.push_back( metaDescriptor(keyword, property, ValueTypeID::Real   ) ); break;
+        default                  :                                                                           break;
+      }
+    }
+  }
+  reader.addKeywords(batch);
+  const auto attributes = reader(source);
+
+  // ........................................................................ //
+  // second pass: defaults and lists, converted as values of the declared types
+
+  batch.clear();
+  for (auto & keyword : keywords) {
+    keyword.valueType = lookup(valueTypeIDs, attributes.get_String(keyword.keys.at(Property::Type)), "value type");
+
+    for (const auto & [property, key] : keyword.keys) {
+      switch (property) {
+        case Property::Default   : batch.push_back( metaDescriptor(keyword, property,            keyword.valueType ) ); break;
+        case Property::Allowed   :
+        case Property::Forbidden : batch.push_back( metaDescriptor(keyword, property, listTypeOf(keyword.valueType)) ); break;
+        default                  :                                                                                      break;
+      }
+    }
+  }
+
+  FileContent values;
+  if ( !batch.empty() ) {
+    reader.resetKeywords();
+    reader.addKeywords(batch);
+    values = reader(source);
+  }
+
+  // ........................................................................ //
+  // assemble the descriptors
+
+  Schema reVal;
+  reVal.descriptors.reserve(keywords.size());
+
+  for (const auto & keyword : keywords) {
+    auto has = [&keyword] (Property property) {return keyword.keys.contains(property);};
+
+    auto dot         = keyword.name.rfind('.');
+    auto key         = dot == std::string::npos ? keyword.name : keyword.name.substr(dot + 1);
+    auto mandatory   = has(Property::Mandatory) && attributes.get_Boolean( keyword.keys.at(Property::Mandatory) );
+    auto policy      = has(Property::Policy   ) ? lookup(policies, attributes.get_String(keyword.keys.at(Property::Policy)), "restriction violation policy") : RestrictionViolationPolicy::Exception;
+    auto message     = has(Property::Message  ) ? attributes.get_String(keyword.keys.at(Property::Message)) : "value not allowed\n$L"s;
+
+    auto & descriptor = reVal.descriptors.emplace_back(key, keyword.valueType, mandatory);
+    if (dot != std::string::npos  ) {descriptor.setSection( keyword.name.substr(0, dot) );}
+    if ( has(Property::Default)   ) {descriptor.setValueAny( values.getAny(keyword.keys.at(Property::Default)), false );}
+
+    if ( has(Property::Min) || has(Property::Max) ) {
+      constexpr auto infinity = std::numeric_limits<PARROT_TYPE(ValueTypeID::Real)>::infinity();
+      descriptor.addRestriction(Restriction(
+        has(Property::Min) ? attributes.get_Real( keyword.keys.at(Property::Min) ) : -infinity,
+        has(Property::Max) ? attributes.get_Real( keyword.keys.at(Property::Max) ) :  infinity,
+        policy, message
+      ));
+    }
+
+    for (auto property : {Property::Allowed, Property::Forbidden}) {
+      if ( !has(property) ) {continue;}
+
+      Restriction restriction(policy, message);
+      const auto & list = values.getAny( keyword.keys.at(property) );
+      switch ( listTypeOf(keyword.valueType) ) {
+        case ValueTypeID::StringList  : {
+          auto words = std::any_cast<PARROT_TYPE(ValueTypeID::StringList)>(list);
+          for (auto & word : words) {                                           // compare like the values read for the keyword
+            BCG::trim(word);
+            if ( !descriptor.isCaseSensitive() ) {BCG::to_uppercase(word);}
+          }
+          restriction.setAftParseValidationList(words, property == Property::Forbidden);
+        } break;
+        case ValueTypeID::IntegerList : restriction.setAftParseValidationList(std::any_cast<const PARROT_TYPE(ValueTypeID::IntegerList) &>(list), property == Property::Forbidden); break;
+        default                       : restriction.setAftParseValidationList(std::any_cast<const PARROT_TYPE(ValueTypeID::RealList   ) &>(list), property == Property::Forbidden); break;
+      }
+      descriptor.addRestriction(restriction);
+    }
+  }
+
+  return reVal;
+}
+
+// ========================================================================== //
+// Getters
+
+const std::vector<Descriptor> & Schema::getDescriptors() const {return descriptors;}
+size_t                          Schema::size          () const {return descriptors.size();}
+
+// ========================================================================== //
+// I/O
+
+void Schema::saveImage(const std::string & filename) const {
+  ImageWriter image;
+
+  image.raw(imageMagic);
+  image.pod(byteOrderMark);
+  image.pod<uint64_t>(descriptors.size());
+
+  for (const auto & descriptor : descriptors) {
+    image.text               ( descriptor.getKey      () );
+    image.text               ( descriptor.getSection  () );
+    image.pod<uint8_t>       ( static_cast<uint8_t>(descriptor.getValueTypeID()) );
+    writeValue               ( image, descriptor.getValueTypeID(), descriptor.getValue() );
+
+    image.flag               ( descriptor.isCaseSensitive          () );
+    image.flag               ( descriptor.isTrimLeadingWhitespaces () );
+    image.flag               ( descriptor.isTrimTrailingWhitespaces() );
+    image.flag               ( descriptor.isMandatory              () );
+    image.pod                ( descriptor.getListSeparator         () );
+
+    image.pod<uint64_t>      ( descriptor.getSubstitutions().size() );
+    for (const auto & [substituee, substitute] : descriptor.getSubstitutions()) {
+      image.text(substituee);
+      image.text(substitute);
+    }
+
+    image.flag               ( static_cast<bool>(descriptor.getUserPreParser()) );
+
+    image.pod<uint64_t>      ( descriptor.getRestrictions().size() );
+    for (const auto & restriction : descriptor.getRestrictions()) {
+      image.pod<uint8_t>( static_cast<uint8_t>(restriction.getRestrictionViolationPolicy()) );
+      image.text        ( restriction.getRestrictionViolationText() );
+
+      const auto preType = restriction.getPreParseRestrictionType();
+      image.pod<uint8_t>( static_cast<uint8_t>(preType) );
+      if (preType == RestrictionType::AllowedList || preType == RestrictionType::ForbiddenList) {
+        image.texts( restriction.getPreParseValidationList() );
+      }
+
+      const auto aftType = restriction.getAftParseRestrictionType();
+      image.pod<uint8_t>( static_cast<uint8_t>(aftType) );
+      switch (aftType) {
+        case RestrictionType::Range         : {
+          const auto [min, max] = restriction.getAftParseRange();
+          image.pod(min);
+          image.pod(max);
+        } break;
+
+        case RestrictionType::AllowedList   :
+        case RestrictionType::ForbiddenList : {
+          const auto & list     = restriction.getAftParseRestriction();
+          const auto   listType = getAnyValueType(list);
+          image.pod<uint8_t>( static_cast<uint8_t>(listType) );
+          writeValue(image, listType, list);
+        } break;
+
+        default                             : break;                            // functions are taken from the registry
+      }
+    }
+  }
+
+  std::ofstream hFile(filename, std::ios::binary);
+  if ( !hFile ) {throw std::runtime_error(THROWTEXT("    could not open '" + filename + "' for writing"));}
+  hFile.write(image.data().data(), image.data().size());
+  if ( !hFile ) {throw std::runtime_error(THROWTEXT("    could not write schema image '" + filename + "'"));}
+}
+// .......................................................................... //
+Schema Schema::loadImage(const std::string & filename, const FunctionRegistry & registry) {
+  std::ifstream hFile(filename, std::ios::binary | std::ios::ate);
+  if ( !hFile ) {throw std::runtime_error(THROWTEXT("    could not open '" + filename + "'"));}
+
+  std::string buffer(static_cast<size_t>(hFile.tellg()), '\0');
+  hFile.seekg(0);
+  hFile.read(buffer.data(), buffer.size());
+  if ( !hFile ) {throw std::runtime_error(THROWTEXT("    could not read '" + filename + "'"));}
+
+  ImageReader image(buffer, filename);
+  if ( buffer.size() < imageMagic.size() || image.raw(imageMagic.size()) != imageMagic ) {throw std::runtime_error(THROWTEXT("    '" + filename + "' is not a schema image"));}
+  if ( image.pod<uint32_t>() != byteOrderMark ) {throw std::runtime_error(THROWTEXT("    schema image '" + filename + "' was written with a different byte order"));}
+
+  const auto count = image.pod<uint64_t>();
+
+  Schema reVal;
+  for (uint64_t i = 0u; i < count; ++i) {
+    auto key       = image.text();
+    auto section   = image.text();
+    auto valueType = image.enumerator(ValueTypeID::ComplexList, "value type");
+    auto value     = readValue(image, valueType);
+
+    auto & descriptor = reVal.descriptors.emplace_back(key, valueType, false);
+    descriptor.setSection(section);
+    if ( value.has_value() ) {descriptor.setValueAny(value, false);}
+
+    descriptor.setCaseSensitive          ( image.flag() );
+    descriptor.setTrimLeadingWhitespaces ( image.flag() );
+    descriptor.setTrimTrailingWhitespaces( image.flag() );
+    descriptor.setMandatory              ( image.flag() );
+    descriptor.setListSeparator          ( image.pod<char>() );
+
+    const auto substitutions = image.pod<uint64_t>();
+    for (uint64_t j = 0u; j < substitutions; ++j) {
+      auto substituee = image.text();
+      auto substitute = image.text();
+      descriptor.addSubstitution(substituee, substitute);
+    }
+
+    const auto name = descriptor.getQualifiedKey();
+
+    if ( image.flag() ) {
+      auto preParser = registry.getPreParser(name);
+      if ( !preParser ) {throw InvalidFunctionError(THROWTEXT("    no preparser registered for keyword '" + name + "'"));}
+      descriptor.setUserPreParser(preParser);
+    }
+
+    size_t preFunctions = 0u, aftFunctions = 0u;
+    const auto restrictions = image.pod<uint64_t>();
+    for (uint64_t j = 0u; j < restrictions; ++j) {
+      auto policy  = image.enumerator(RestrictionViolationPolicy::Exception, "restriction policy");
+      auto message = image.text();
+      Restriction restriction(policy, message);
+
+      const auto preType = image.enumerator(RestrictionType::Function, "restriction type");
+      switch (preType) {
+        case RestrictionType::AllowedList   :
+        case RestrictionType::ForbiddenList : restriction.setPreParseValidationList    ( image.texts(), preType == RestrictionType::ForbiddenList ); break;
+        case RestrictionType::Function      : restriction.setPreParseValidationFunction( registry.getPreParseFunction(name, preFunctions++)       ); break;
+        default                             :                                                                                                        break;
+      }
+
+      const auto aftType = image.enumerator(RestrictionType::Function, "restriction type");
+      switch (aftType) {
+        case RestrictionType::Range         : {
+          auto min = image.pod<PARROT_TYPE(ValueTypeID::Real)>();
+          auto max = image.pod<PARROT_TYPE(ValueTypeID::Real)>();
+          restriction.setAftParseRange(min, max);
+        } break;
+
+        case RestrictionType::AllowedList   :
+        case RestrictionType::ForbiddenList : {
+          const auto listType  = image.enumerator(ValueTypeID::ComplexList, "value type");
+          const auto list      = readValue(image, listType);
+          const auto forbidden = aftType == RestrictionType::ForbiddenList;
+          switch (listType) {
+            case ValueTypeID::StringList  : restriction.setAftParseValidationList( std::any_cast<const PARROT_TYPE(ValueTypeID::StringList ) &>(list), forbidden ); break;
+            case ValueTypeID::IntegerList : restriction.setAftParseValidationList( std::any_cast<const PARROT_TYPE(ValueTypeID::IntegerList) &>(list), forbidden ); break;
+            case ValueTypeID::RealList    : restriction.setAftParseValidationList( std::any_cast<const PARROT_TYPE(ValueTypeID::RealList   ) &>(list), forbidden ); break;
+            default                       : throw ValueTypeError(THROWTEXT("    invalid validation list type in schema image '" + filename + "'"));
+          }
+        } break;
+
+        case RestrictionType::Function      : registry.getAftParseFunction(name, aftFunctions++)(restriction); break;
+        default                             :                                                                  break;
+      }
+
+      descriptor.addRestriction(restriction);
+    }
+  }
+
+  if ( !image.atEnd() ) {throw std::runtime_error(THROWTEXT("    trailing data in schema image '" + filename + "'"));}
+
+  return reVal;
+}
@@ -6,11 +6,21 @@
 // #include <iomanip>
 
 #include <cstring>
+#include <cstdio>
+#include <fstream>
+#include <sstream>
 #include <string>
 using namespace std::string_literals;
 
 #include <vector>
 #include <tuple>
+#include <algorithm>
+#include <memory>
+#include <memory_resource>
+#include <cstdint>
+#include <future>
+#include <coroutine>
+#include <filesystem>
 
 // own
 #include "BCG.hpp"
@@ -330,9 +340,12 @@ void unittest_FileContent() {
   fc.addElement(empty, Parrot::ValueTypeID::Boolean);
 
   std::cout << "[0] Exposed map" << std::endl;
-  auto fcc = fc.getContent();
+  auto fcc = fc.toMap();
   std::cout << "size: " << fcc.size() << std::endl;
   std::cout << "size of element 'integer': " << sizeof(fcc[integer]) << std::endl;
+  std::cout << "visited without copies:";
+  fc.forEach([] (std::string_view key, const Parrot::FileContent::ContentType &) {std::cout << " " << key;});
+  std::cout << std::endl;
   std::cout << std::endl;
 
   std::cout << "[1] Indirect Map Access" << std::endl;
@@ -501,7 +514,7 @@ void unittest_Reader () {
 
   sophisticatedDescriptor.reset();
   sophisticatedDescriptor.makeRanged("real", 0.0,
-                                     -3.14, 3.14);
+                                     -3.1416, 3.1416);
   sophisticatedDescriptor.addSubstitution("PI", "3.141592654");
   rdr.addKeyword(sophisticatedDescriptor);
 
@@ -517,6 +530,875 @@ void unittest_Reader () {
   auto fc = rdr("unittest.ini");
 
   std::cout << fc.to_string() << std::endl;
+
+  std::cout << "[4] read unittest file with profiling ... " << std::endl;
+  rdr.setVerbose(false);
+  Parrot::ParseStats stats;
+  rdr("unittest.ini", stats);
+  std::cout << stats.to_string() << std::endl;
+
+  std::cout << "[5] read unittest file with buffered diagnostics ... " << std::endl;
+  auto buffer = std::make_shared<Parrot::BufferedDiagnosticSink>();
+  rdr.setDiagnosticSink(buffer);
+  rdr("unittest.ini");
+  for (const auto & record : buffer->getRecords()) {
+    std::cout << Parrot::diagnosticKindName(record.kind) << " in line " << record.line << " (" << record.keyword << ")" << std::endl;
+  }
+  rdr.setDiagnosticSink(nullptr);
+
+  std::cout << "[6] read unittest file into an arena ... " << std::flush;
+  {
+    std::pmr::monotonic_buffer_resource arena;
+    rdr.setDiagnosticSink(buffer);
+    auto arenaContent = rdr("unittest.ini", arena);
+    auto heapContent  = rdr("unittest.ini");
+    rdr.setDiagnosticSink(nullptr);
+    std::cout << (arenaContent.getResource() == &arena ? "allocated from arena" : "allocated from heap") << ", "
+              << (arenaContent.to_string() == heapContent.to_string() ? "same" : "different") << " content" << std::endl;
+
+    std::cout << "~~~ keyword table shared with result ... " << std::flush;
+    auto table = rdr.getKeywordTable();
+    auto id    = table->find(rdr.getDescriptors()[0].getQualifiedKey());
+    std::cout << (heapContent.getKeywordTable() == table ? "shared" : "copied") << ", "
+              << (std::get<Parrot::FileContent::ValueType>(heapContent.get(id)) == heapContent.getValueType(table->name(id)) ? "same" : "different") << " value by ID" << std::endl;
+  }
+
+  std::cout << "~~~ numeric lists in aligned storage ... " << std::flush;
+  {
+    rdr.setDiagnosticSink(buffer);
+    rdr.setAlignNumericLists(true);
+    auto aligned = rdr("unittest.ini");
+    rdr.setAlignNumericLists(false);
+    auto plain   = rdr("unittest.ini");
+    rdr.setDiagnosticSink(nullptr);
+
+    auto reals = aligned.getSpan_RealList   ("REALLIST"   );
+    auto ints  = aligned.getSpan_IntegerList("INTEGERLIST");
+    std::cout << (reinterpret_cast<std::uintptr_t>(reals.data()) % Parrot::numericListAlignment == 0 &&
+                  reinterpret_cast<std::uintptr_t>(ints .data()) % Parrot::numericListAlignment == 0    ? "aligned" : "unaligned") << ", "
+              << (aligned.get_RealList("REALLIST") == plain.get_RealList("REALLIST") &&
+                  aligned.to_string()              == plain.to_string()                                 ? "same" : "different") << " content, "
+              << ints.size() << " integers" << std::endl;
+  }
+
+  std::cout << "[7] tryParse with all policies set to exception ... " << std::endl;
+  rdr.setUnexpectedKeywordPolicy        (Parrot::ParsingErrorPolicy::Exception);
+  rdr.setDuplicateKeywordPolicy         (Parrot::ParsingErrorPolicy::Exception);
+  rdr.setConversionErrorPolicy          (Parrot::ParsingErrorPolicy::Exception);
+  rdr.setMissingKeywordPoliyNonMandatory(Parrot::ParsingErrorPolicy::Exception);
+  auto result = rdr.tryParse("unittest.ini");
+  std::cout << "ok: " << result.ok() << std::endl;
+  for (const auto & message : result.getMessages()) {std::cout << message << std::endl;}
+
+  std::cout << "~~~ tryParse non-existent file ... " << std::flush;
+  result = rdr.tryParse("### this file does not exist ###");
+  std::cout << result.getErrors().size() << " error: " << result.getMessages()[0] << std::endl;
+
+  std::cout << "~~~ custom boolean vocabulary ... " << std::flush;
+  std::ofstream("unittest_booleans.ini") << "flag = Ja\nmask = ja, NEIN, an, aus\n";
+  Parrot::Reader boolRdr;
+  boolRdr.addKeyword("flag", Parrot::ValueTypeID::Boolean    );
+  boolRdr.addKeyword("mask", Parrot::ValueTypeID::BooleanList);
+  boolRdr.setVerbose(false);
+  boolRdr.setBooleanVocabulary( Parrot::BooleanVocabulary({"ja", "an"}, {"nein", "aus"}) );
+  auto booleans = boolRdr("unittest_booleans.ini");
+  std::cout << booleans.getValue<bool>("FLAG") << " ";
+  for (bool bit : booleans.getValue<std::vector<bool>>("MASK")) {std::cout << bit;}
+  std::cout << " (" << boolRdr.getBooleanVocabulary().to_string() << ")" << std::endl;
+  std::remove("unittest_booleans.ini");
+
+  std::cout << "~~~ real ranges ... " << std::flush;
+  std::ofstream("unittest_ranges.ini") << "grid = 0:1:10000001\nsweep = -1:1:5\nbad = 0:1:2.5\n";
+  Parrot::Reader rangeRdr;
+  rangeRdr.addKeyword("grid", Parrot::ValueTypeID::RealRange);
+  rangeRdr.addKeyword("bad" , Parrot::RealRange(0, 1, 2));
+  Parrot::Descriptor sweep;
+  sweep.makeRanged("sweep", Parrot::RealRange(0, 1, 3), 0, 1, Parrot::RestrictionViolationPolicy::WarningRevert);
+  rangeRdr.addKeyword(sweep);
+  rangeRdr.setVerbose(false);
+  auto rangeSink = std::make_shared<Parrot::BufferedDiagnosticSink>();
+  rangeRdr.setDiagnosticSink(rangeSink);
+  auto ranges = rangeRdr("unittest_ranges.ini");
+  auto grid   = ranges.get_RealRange("GRID");
+  std::cout << grid.size() << " points, step " << grid.getStep() << ", grid[5000000] = " << grid[5000000] << ", "
+            << "sweep " << Parrot::getAnyText(ranges.getAny("SWEEP")) << ", bad " << (ranges.hasKeyword("BAD") ? Parrot::getAnyText(ranges.getAny("BAD")) : "rejected"s) << ", "
+            << rangeSink->getRecords().size() << " diagnostics, "
+            << "materialized " << BCG::vector_to_string(Parrot::RealRange::fromStep(0, 1, 0.25).materialize()) << std::endl;
+  std::remove("unittest_ranges.ini");
+
+  std::cout << "~~~ numeric expressions ... " << std::flush;
+  std::ofstream("unittest_expressions.ini") << "n = 2 ^ 3\nx = 2PI\ny = 1E-6*n\nr = 0 : PI/2 : n + 1\n[box]\nn = 4\nside = 2n\nhalf = -x / 2\nbad = 3 / 2\n";
+  Parrot::Reader exprRdr;
+  exprRdr.addKeyword("n"       , Parrot::ValueTypeID::Integer  );
+  exprRdr.addKeyword("x"       , Parrot::ValueTypeID::Real     );
+  exprRdr.addKeyword("y"       , Parrot::ValueTypeID::Real     );
+  exprRdr.addKeyword("r"       , Parrot::ValueTypeID::RealRange);
+  exprRdr.addKeyword("box.n"   , Parrot::ValueTypeID::Integer  );
+  exprRdr.addKeyword("box.side", Parrot::ValueTypeID::Real     );
+  exprRdr.addKeyword("box.half", Parrot::ValueTypeID::Real     );
+  exprRdr.addKeyword("box.bad" , Parrot::ValueTypeID::Integer  );
+  exprRdr.setVerbose(false);
+  exprRdr.setDiagnosticSink(std::make_shared<Parrot::BufferedDiagnosticSink>());
+  exprRdr.setEvaluateExpressions(true);
+  exprRdr.setConstant("tau", 2 * 3.14159265358979);
+  auto exprs = exprRdr("unittest_expressions.ini");
+  std::cout << "n = " << exprs.get_Integer("N") << ", x = " << exprs.get_Real("X") << ", y = " << exprs.get_Real("Y") << ", "
+            << "r = " << exprs.get_RealRange("R").to_string() << ", side = " << exprs.get_Real("BOX.SIDE") << ", half = " << exprs.get_Real("BOX.HALF") << ", "
+            << "bad " << (exprs.hasKeyword("BOX.BAD") ? "accepted"s : "rejected"s) << ", "
+            << exprRdr.getExpressionCache().size() << " compiled, "
+            << "tau^2 folds to " << exprRdr.getExpressionCache().get("tau^2")->to_string() << std::endl;
+  std::remove("unittest_expressions.ini");
+
+  std::cout << "~~~ narrow and complex types ... " << std::flush;
+  std::ofstream("unittest_narrow.ini") << "index = 7\nindices = 1, 2, 3\nhuge = 3000000000\nvast = 1e300\ngain = 0.1\ngains = 0.5, 0.25\n"
+                                      << "z = 1.5-2i\nspectrum = (1, 0), 2i, -1+0.5j\n";
+  Parrot::Reader narrowRdr;
+  narrowRdr.addKeyword("index"   , Parrot::ValueTypeID::Int32      );
+  narrowRdr.addKeyword("indices" , Parrot::ValueTypeID::Int32List  );
+  narrowRdr.addKeyword("huge"    , Parrot::ValueTypeID::Int32      );
+  narrowRdr.addKeyword("vast"    , Parrot::ValueTypeID::Float32    );
+  narrowRdr.addKeyword("gains"   , Parrot::ValueTypeID::Float32List);
+  narrowRdr.addKeyword("z"       , Parrot::ValueTypeID::Complex    );
+  narrowRdr.addKeyword("spectrum", Parrot::ValueTypeID::ComplexList);
+  Parrot::Descriptor gain;
+  gain.makeListboundAftParse("gain", Parrot::ValueTypeID::Float32, std::vector<double>{0.1, 0.2});
+  narrowRdr.addKeyword(gain);
+  narrowRdr.setVerbose(false);
+  narrowRdr.setAlignNumericLists(true);
+  narrowRdr.setDiagnosticSink(std::make_shared<Parrot::BufferedDiagnosticSink>());
+  auto narrow   = narrowRdr("unittest_narrow.ini");
+  auto spectrum = narrow.getSpan_ComplexList("SPECTRUM");
+  std::cout << "index " << narrow.get_Int32("INDEX") << " (" << sizeof(narrow.get_Int32("INDEX")) << " bytes), "
+            << "indices " << Parrot::getAnyText(narrow.getAny("INDICES")) << ", huge " << (narrow.hasKeyword("HUGE") ? "accepted"s : "rejected"s) << ", "
+            << "vast " << (narrow.hasKeyword("VAST") ? "accepted"s : "rejected"s) << ", "
+            << "gain " << narrow.get_Float32("GAIN") << " allowed, gains " << Parrot::getAnyText(narrow.getAny("GAINS")) << ", "
+            << "z = " << Parrot::getAnyText(narrow.getAny("Z")) << ", "
+            << "spectrum " << Parrot::getAnyText(narrow.getAny("SPECTRUM")) << " as " << 2 * spectrum.size() << " interleaved doubles, "
+            << (reinterpret_cast<uintptr_t>(spectrum.data()) % Parrot::numericListAlignment ? "unaligned" : "aligned") << std::endl;
+  std::remove("unittest_narrow.ini");
+
+  std::cout << "~~~ typed validation functions ... " << std::flush;
+  std::ofstream("unittest_validators.ini") << "even = 4\nodd = 5\nsorted = 1, 2, 3\nunsorted = 3, 1\n";
+  std::function<bool (const PARROT_TYPE(Parrot::ValueTypeID::Integer  ) &)> isEven   = +[] (const PARROT_TYPE(Parrot::ValueTypeID::Integer  ) & v) {return v % 2 == 0;};
+  std::function<bool (const PARROT_TYPE(Parrot::ValueTypeID::Int32List) &)> isSorted = +[] (const PARROT_TYPE(Parrot::ValueTypeID::Int32List) & v) {return std::is_sorted(v.begin(), v.end());};
+  Parrot::Reader     validRdr;
+  Parrot::Descriptor validator;
+  for (const auto & key : {"even", "odd"}) {
+    validator.makeUserboundAftParse(key, PARROT_TYPE(Parrot::ValueTypeID::Integer)(0), isEven, Parrot::RestrictionViolationPolicy::WarningRevert, "odd value");
+    validRdr.addKeyword(validator);
+  }
+  for (const auto & key : {"sorted", "unsorted"}) {
+    validator.makeUserboundAftParse(key, Parrot::ValueTypeID::Int32List, isSorted, Parrot::RestrictionViolationPolicy::Warning, "unsorted list");
+    validRdr.addKeyword(validator);
+  }
+  validRdr.setVerbose(false);
+  auto validSink = std::make_shared<Parrot::BufferedDiagnosticSink>();
+  validRdr.setDiagnosticSink(validSink);
+  auto valid = validRdr("unittest_validators.ini");
+  bool mismatch = false;
+  try {validator.makeUserboundAftParse("real", Parrot::ValueTypeID::Real, isEven);}
+  catch (const Parrot::RestrictionTypeError &) {mismatch = true;}
+  std::cout << "even " << valid.get_Integer("EVEN") << ", odd reverted to " << valid.get_Integer("ODD") << ", "
+            << "unsorted " << Parrot::getAnyText(valid.getAny("UNSORTED")) << " kept, "
+            << validSink->getRecords().size() << " diagnostics, "
+            << "Integer function on Real keyword " << (mismatch ? "rejected"s : "accepted"s) << std::endl;
+  std::remove("unittest_validators.ini");
+
+  std::cout << "~~~ deferred validation ... " << std::flush;
+  std::ofstream("unittest_deferred.ini") << [] () {
+    std::string reVal = "N_photons = 3\nN_modes = 5\n";
+    for (auto i = 0; i < 64; ++i) {reVal += "x"s.append(std::to_string(i)) + " = " + std::to_string(i % 3) + "\n";}
+    return reVal;
+  } ();
+  Parrot::Reader deferRdr;
+  deferRdr.addKeyword("N_photons", PARROT_TYPE(Parrot::ValueTypeID::Integer)(10), false);
+  deferRdr.addKeyword("N_modes"  , PARROT_TYPE(Parrot::ValueTypeID::Integer)( 1), false);
+  for (auto i = 0; i < 64; ++i) {
+    deferRdr.addKeywordRanged("x"s.append(std::to_string(i)), Parrot::ValueTypeID::Integer, 0, 1, Parrot::RestrictionViolationPolicy::Warning, "$K = $V in line $#");
+  }
+  deferRdr.addConstraint({"N_photons", "N_modes"}, [] (const Parrot::FileContent & content) {
+    return content.get_Integer("N_PHOTONS") >= content.get_Integer("N_MODES");
+  }, Parrot::RestrictionViolationPolicy::WarningRevert, "$K: fewer photons than modes");
+  deferRdr.setVerbose(false);
+  auto deferParse = [&deferRdr] (bool defer, size_t threads) {
+    auto sink = std::make_shared<Parrot::BufferedDiagnosticSink>();
+    deferRdr.setDiagnosticSink(sink);
+    deferRdr.setDeferValidation(defer);
+    deferRdr.setThreads(threads);
+
+    std::string reVal = deferRdr("unittest_deferred.ini").to_string();
+    for (const auto & record : sink->getRecords()) {reVal += record.message + "\n";}
+    return std::make_pair(reVal, sink->getRecords().back().message);
+  };
+  auto [lineWise, lastMessage] = deferParse(false, 1);
+  std::cout << "equal to line-wise: " << (deferParse(true, 1).first == lineWise ? "yes"s : "no"s) << ", "
+            << "with 4 threads: "     << (deferParse(true, 4).first == lineWise ? "yes"s : "no"s) << ", "
+            << "constraint: " << lastMessage << ", "
+            << "N_photons reverted to " << deferRdr("unittest_deferred.ini").get_Integer("N_PHOTONS") << std::endl;
+  std::remove("unittest_deferred.ini");
+
+  // ........................................................................ //
+  std::cout << "~~~ compile-time conversion ... " << std::flush;
+  Parrot::Descriptor  convDsc("ints", std::vector<unsigned short>{1, 2, 3});
+  Parrot::Restriction convRes;
+  convRes.setAftParseValidationList(std::vector<float>{0.5f, 1.5f});
+  std::cout << convDsc.getValueTypeName() << ": " << Parrot::getAnyText(convDsc.getValue()) << ", "
+            << Parrot::valueTypeName( Parrot::valueTypeIDOf(std::complex<float>(1, 2)) ) << ", "
+            << "validation list: " << Parrot::getAnyText(convRes.getAftParseRestriction()) << ", ";
+  Parrot::Descriptor  anyDsc("any", std::any(2.5));                             // not deduced, but taken from the content
+  std::cout << "from std::any: " << anyDsc.getValueTypeName() << std::endl;
+
+  // ........................................................................ //
+  std::cout << "~~~ schema file ... " << std::flush;
+  std::ofstream("unittest_schema.ini") << "[N_photons]\ntype = Integer\ndefault = 10\nmin = 1\npolicy = WarningRevert\n\n"
+                                          "[optics.mode]\ntype = String\nmandatory = true\nallowed = linear, circular\n\n"
+                                          "[weights]\ntype = RealList\ndefault = 0.5, 1.5\n";
+  std::ofstream("unittest_schemaUse.ini") << "N_photons = 0\n[optics]\nmode = circular\n";
+  Parrot::Reader schemaRdr;
+  schemaRdr.setVerbose(false);
+  schemaRdr.setDiagnosticSink(std::make_shared<Parrot::BufferedDiagnosticSink>());
+  schemaRdr.loadSchema("unittest_schema.ini");
+  auto schemaContent = schemaRdr("unittest_schemaUse.ini");
+  std::cout << schemaRdr.size() << " keywords, first: " << schemaRdr.getDescriptor(0).getKey() << ", "
+            << "N_photons reverted to " << schemaContent.get_Integer("N_PHOTONS") << ", "
+            << "mode: " << schemaContent.get_String("OPTICS.MODE") << ", "
+            << "weights: " << Parrot::getAnyText(schemaContent.getAny("WEIGHTS")) << ", ";
+  try {
+    schemaRdr.addKeywords({Parrot::Descriptor("new", 1), Parrot::Descriptor("weights", 1)});
+  } catch (const Parrot::InvalidDescriptorError & e) {
+    std::cout << "failing batch rejected, still " << schemaRdr.size() << " keywords" << std::endl;
+  }
+
+  std::cout << "~~~ schema image ... " << std::flush;
+  Parrot::Descriptor answerDsc("answer", 42ll, false);
+  Parrot::Restriction answerRst;
+  answerRst.setAftParseValidationFunction(std::function(manualIntValidation));
+  answerRst.setRestrictionViolationPolicy(Parrot::RestrictionViolationPolicy::WarningRevert, "not the answer");
+  answerDsc.addRestriction(answerRst);
+  Parrot::Descriptor tagDsc("tag", "none"s, false);
+  tagDsc.setUserPreParser(userPreparser);
+  schemaRdr.addKeywords({answerDsc, tagDsc});
+  schemaRdr.saveSchemaImage("unittest_schema.img");
+
+  Parrot::FunctionRegistry registry;
+  registry.addAftParseFunction("answer", std::function(manualIntValidation));
+  registry.setPreParser       ("tag"   , userPreparser);
+
+  Parrot::Reader imageRdr;
+  imageRdr.setVerbose(false);
+  imageRdr.setDiagnosticSink(std::make_shared<Parrot::BufferedDiagnosticSink>());
+  imageRdr.loadSchemaImage("unittest_schema.img", registry);
+  std::ofstream("unittest_schemaUse.ini") << "N_photons = 0\ntag = x\n[optics]\nmode = circular\n";
+  std::cout << imageRdr.size() << " keywords, "
+            << "same content: " << (imageRdr("unittest_schemaUse.ini").to_string() == schemaRdr("unittest_schemaUse.ini").to_string() ? "yes" : "no") << ", "
+            << "tag: " << imageRdr("unittest_schemaUse.ini").get_String("TAG") << ", ";
+  try {
+    Parrot::Reader().loadSchemaImage("unittest_schema.img");
+  } catch (const Parrot::InvalidFunctionError & e) {
+    std::cout << "missing functions rejected, ";
+  }
+
+  auto corruptImage = [] (uint8_t valueType, uint64_t listSize) {             // one keyword "a" with a string list of listSize elements, but no data
+    std::ofstream hFile("unittest_corrupt.img", std::ios::binary);
+    auto pod = [&hFile] (const auto & x) {hFile.write(reinterpret_cast<const char *>(&x), sizeof(x));};
+    hFile << "PARROT SCHEMA IMAGE 1\n";
+    pod(uint32_t(0x01020304)); pod(uint64_t(1));
+    pod(uint64_t(1)); hFile << "a"; pod(uint64_t(0));
+    pod(valueType); pod(uint8_t(1)); pod(listSize);
+  };
+  for (auto [valueType, listSize] : {std::pair<uint8_t, uint64_t>{5, 1ull << 40}, {200, 0}}) {
+    corruptImage(valueType, listSize);
+    try {
+      Parrot::Reader().loadSchemaImage("unittest_corrupt.img");
+      std::cout << "corrupt image accepted ";
+    } catch (const std::runtime_error & e) {
+      std::cout << "corrupt image rejected ";
+    }
+  }
+  std::cout << std::endl;
+  std::remove("unittest_corrupt.img");
+
+
+  std::cout << "~~~ code generator ... " << std::flush;
+  Parrot::CodeGenerator generator(Parrot::Schema::load("unittest_schema.ini"));
+  generator.setNamespace("app::config");
+  auto generatedHeader = generator.header();
+  auto generatedSource = generator.source("Settings.hpp");
+  std::cout << "members:";
+  for (const auto & member : generator.getMemberNames()) {std::cout << " " << member;}
+  std::cout << ", namespace: " << (generatedHeader.find("namespace app::config {") != std::string::npos ? "yes" : "no")
+            << ", range check: " << (generatedSource.find("if ( value < 1.0 ) {") != std::string::npos ? "yes" : "no")
+            << ", allowed list: " << (generatedSource.find("!(value == \"LINEAR\" || value == \"CIRCULAR\")") != std::string::npos ? "yes" : "no") << ", ";
+  try {
+    Parrot::CodeGenerator(Parrot::Schema({answerDsc}));
+  } catch (const Parrot::InvalidFunctionError & e) {
+    std::cout << "user functions rejected" << std::endl;
+  }
+
+  std::remove("unittest_schema.ini");
+  std::remove("unittest_schemaUse.ini");
+  std::remove("unittest_schema.img");
+}
+
+// .......................................................................... //
+void unittest_Reader_sections () {
+  BCG::writeBoxed("Testing the Reader class with sections", {BCG::ConsoleColors::FORE_YELLOW});
+
+  Parrot::Reader     rdr;
+  Parrot::Descriptor dsc;
+  rdr.setVerbose(false);
+
+  rdr.addKeyword("name", Parrot::ValueTypeID::String);
+
+  for (const auto & [section, key, type] : std::vector<std::tuple<std::string, std::string, Parrot::ValueTypeID>>{
+        {"network" , "host"   , Parrot::ValueTypeID::String },
+        {"network" , "port"   , Parrot::ValueTypeID::Integer},
+        {"network" , "timeout", Parrot::ValueTypeID::Real   },
+        {"graphics", "width"  , Parrot::ValueTypeID::Integer},
+        {"graphics", "height" , Parrot::ValueTypeID::Integer}
+      }) {
+    dsc = Parrot::Descriptor(key, type);
+    dsc.setSection(section);
+    rdr.addKeyword(dsc);
+  }
+
+  std::cout << "[0] section index:" << std::endl;
+  auto index = rdr.indexSections("unittest_sections.ini");
+  for (const auto & [section, spans] : index) {
+    std::cout << "'" << section << "':";
+    for (const auto & span : spans) {std::cout << " (offset " << span.offset << ", line " << span.firstLine + 1 << ", " << span.lineCount << " lines)";}
+    std::cout << std::endl;
+  }
+  std::cout << std::endl;
+
+  std::cout << "[1] full parse:" << std::endl;
+  std::cout << rdr("unittest_sections.ini").to_string() << std::endl;
+
+  std::cout << "[2] network section only:" << std::endl;
+  std::cout << rdr("unittest_sections.ini", {"network"}, index).to_string() << std::endl;
+
+  std::cout << "[3] lazy access:" << std::endl;
+  auto lazy = rdr.parseLazy("unittest_sections.ini", "unittest_sections.ini.pidx");
+  std::cout << "indexed keywords: " << lazy.getIndex().size() << std::endl;
+  PARROT_TYPE(Parrot::ValueTypeID::Integer) port = lazy["network.port"];
+  std::cout << "network.port = " << port << std::endl;
+  std::cout << "network.port parsed  : " << lazy.isParsed("network.port"  ) << std::endl;
+  std::cout << "graphics.width parsed: " << lazy.isParsed("graphics.width") << std::endl;
+
+  std::cout << "~~~ reopen with saved index ... " << std::flush;
+  auto reopened = rdr.parseLazy("unittest_sections.ini", "unittest_sections.ini.pidx");
+  std::cout << (reopened.getIndex().isCurrent("unittest_sections.ini", lazy.getIndex().getSignature()) ? "current" : "stale") << std::endl;
+  std::cout << reopened.materialize().to_string() << std::endl;
+  std::remove("unittest_sections.ini.pidx");
+
+  std::cout << "[4] continued lines and CRLF:" << std::endl;
+  std::ofstream("unittest_sections_continued.ini", std::ios::binary) << "[network]\r\nhost = local \\\r\n  [graphics]\r\nport = 8080\r\ntimeout = 1.5\r\n[graphics]\r\nwidth = 3\r\nheight = 4";
+  index = rdr.indexSections("unittest_sections_continued.ini");
+  for (const auto & [section, spans] : index) {
+    std::cout << "'" << section << "':";
+    for (const auto & span : spans) {std::cout << " (offset " << span.offset << ", line " << span.firstLine + 1 << ", " << span.lineCount << " lines)";}
+    std::cout << std::endl;
+  }
+  auto network = rdr("unittest_sections_continued.ini", {"network"}, index);
+  std::cout << "network.host  : '" << std::any_cast<std::string>(network.getAny("NETWORK.HOST")) << "'" << std::endl;
+  std::cout << "network.port  : " << std::any_cast<long long>(network.getAny("NETWORK.PORT")) << std::endl;
+  auto graphics = rdr("unittest_sections_continued.ini", {"graphics"}, index);
+  std::cout << "graphics.width: " << std::any_cast<long long>(graphics.getAny("GRAPHICS.WIDTH")) << std::endl;
+  auto lazyContinued = rdr.parseLazy("unittest_sections_continued.ini", "");
+  PARROT_TYPE(Parrot::ValueTypeID::Integer) height = lazyContinued["graphics.height"];
+  PARROT_TYPE(Parrot::ValueTypeID::String ) host   = lazyContinued["network.host"];
+  std::cout << "lazy keywords : " << lazyContinued.getIndex().size() << ", graphics.height = " << height << ", network.host = '" << host << "'" << std::endl;
+  std::remove("unittest_sections_continued.ini");
+}
+
+// .......................................................................... //
+void unittest_Reader_parallel () {
+  BCG::writeBoxed("Testing the Reader class with several threads", {BCG::ConsoleColors::FORE_YELLOW});
+
+  // a file large enough to be split into chunks, full of duplicates
+  std::ostringstream text;
+  for (auto & source : {"unittest.ini", "unittest_sections.ini"}) {
+    std::ifstream hFile(source);
+    text << hFile.rdbuf() << "\n";
+  }
+  std::ofstream("unittest_parallel.ini") << [&] () {
+    std::string reVal;
+    for (auto i = 0; i < 1000; ++i) {reVal += text.str();}
+    return reVal;
+  } ();
+
+  Parrot::Reader     rdr;
+  Parrot::Descriptor dsc("port", Parrot::ValueTypeID::Integer);
+  rdr.setVerbose(false);
+  rdr.setUnexpectedKeywordPolicy(Parrot::ParsingErrorPolicy::Ignore);           // a repeated unexpected keyword is an error in itself
+  rdr.addKeyword("name"       , Parrot::ValueTypeID::String     );
+  rdr.addKeyword("integer"    , Parrot::ValueTypeID::Integer    );
+  rdr.addKeyword("realList"   , Parrot::ValueTypeID::RealList   );
+  rdr.addKeyword("booleanList", Parrot::ValueTypeID::BooleanList);
+  rdr.addKeyword("missing"    , "default"s, false);
+  dsc.setSection("network");
+  rdr.addKeyword(dsc);
+
+  auto parse = [&rdr] (size_t threads) {
+    auto sink = std::make_shared<Parrot::BufferedDiagnosticSink>();
+    rdr.setDiagnosticSink(sink);
+    rdr.setThreads(threads);
+
+    std::string reVal = rdr("unittest_parallel.ini").to_string();
+    for (const auto & record : sink->getRecords()) {
+      reVal += Parrot::diagnosticKindName(record.kind) + " " + std::to_string(record.line) + " " + record.keyword + ": " + record.message + "\n";
+    }
+    return reVal;
+  };
+  auto tryParse = [&rdr] (size_t threads) {
+    rdr.setThreads(threads);
+
+    std::string reVal;
+    for (const auto & message : rdr.tryParse("unittest_parallel.ini").getMessages()) {reVal += message + "\n";}
+    return reVal;
+  };
+  auto throwing = [&rdr] (size_t threads) {
+    rdr.setThreads(threads);
+
+    try {rdr("unittest_parallel.ini");}
+    catch (const std::exception & e) {return std::string(e.what());}
+    return "(nothing thrown)"s;
+  };
+
+  std::cout << "[0] content and diagnostics equal to single thread ... " << (parse(1) == parse(4) ? "yes" : "no") << std::endl;
+
+  rdr.setDiagnosticSink(nullptr);
+  rdr.setDuplicateKeywordPolicy (Parrot::ParsingErrorPolicy::Exception);
+  rdr.setConversionErrorPolicy  (Parrot::ParsingErrorPolicy::Exception);
+  std::cout << "[1] tryParse errors equal to single thread ... " << (tryParse(1) == tryParse(4) ? "yes" : "no") << std::endl;
+
+  auto message = throwing(1);
+  std::cout << "[2] first exception equal to single thread ... " << (message == throwing(4) ? "yes" : "no") << std::endl;
+  std::cout << message << std::endl;
+
+  std::remove("unittest_parallel.ini");
+}
+
+// .......................................................................... //
+struct DetachedTask {                                                           // minimal coroutine type for the awaitable test
+  struct promise_type {
+    DetachedTask        get_return_object  () {return {};}
+    std::suspend_never  initial_suspend    () noexcept {return {};}
+    std::suspend_never  final_suspend      () noexcept {return {};}
+    void                return_void        () {}
+    void                unhandled_exception() {std::terminate();}
+  };
+};
+
+DetachedTask awaitParse(const Parrot::Reader & rdr, const std::string & source, std::promise<std::string> & done) {
+  try {
+    auto content = co_await rdr.parseAwaitable(source);
+    done.set_value(content.to_string());
+  } catch (...) {done.set_exception(std::current_exception());}
+}
+
+void unittest_Reader_async () {
+  BCG::writeBoxed("Testing asynchronous parsing", {BCG::ConsoleColors::FORE_YELLOW});
+
+  Parrot::Reader rdr;
+  rdr.setVerbose(false);
+  rdr.setDiagnosticSink(std::make_shared<Parrot::BufferedDiagnosticSink>());    // keep the warnings of unittest.ini off the screen
+  rdr.setUnexpectedKeywordPolicy(Parrot::ParsingErrorPolicy::Ignore);           // a repeated unexpected keyword is an error in itself
+  rdr.addKeyword("integer"    , Parrot::ValueTypeID::Integer    );
+  rdr.addKeyword("booleanList", Parrot::ValueTypeID::BooleanList);
+
+  auto expected = rdr("unittest.ini").to_string();
+
+  std::cout << "[0] future equal to synchronous call ... " << (rdr.parseAsync("unittest.ini").get().to_string() == expected ? "yes" : "no") << std::endl;
+
+  rdr.setExecutor  (std::make_shared<Parrot::ThreadPoolExecutor>(2));
+  rdr.setIOExecutor(std::make_shared<Parrot::ThreadPoolExecutor>(1));
+  std::vector<std::future<Parrot::FileContent>> results;
+  for (auto i = 0; i < 8; ++i) {results.push_back(rdr.parseAsync("unittest.ini"));}
+  auto allEqual = std::all_of(results.begin(), results.end(), [&] (auto & result) {return result.get().to_string() == expected;});
+  std::cout << "[1] separate reading executor, 8 files equal ... " << (allEqual ? "yes" : "no") << std::endl;
+
+  std::promise<std::string> awaited;
+  auto awaitedResult = awaited.get_future();
+  awaitParse(rdr, "unittest.ini", awaited);
+  std::cout << "[2] coroutine equal to synchronous call ... " << (awaitedResult.get() == expected ? "yes" : "no") << std::endl;
+
+  // occupy the only thread so that the second parse cannot start before it is cancelled
+  auto single = std::make_shared<Parrot::ThreadPoolExecutor>(1);
+  std::promise<void> release;
+  single->submit([gate = release.get_future().share()] () {gate.wait();});
+  rdr.setExecutor  (single);
+  rdr.setIOExecutor(nullptr);
+
+  Parrot::CancellationToken token;
+  auto cancelled = rdr.parseAsync("unittest.ini", token);
+  token.cancel();
+  release.set_value();
+  std::cout << "[3] cancelled before start ... ";
+  try {
+    cancelled.get();
+    std::cout << "(nothing thrown)" << std::endl;
+  } catch (const Parrot::ParseCancelledError &) {
+    std::cout << "ParseCancelledError" << std::endl;
+  }
+
+  std::cout << "[4] errors delivered through the future ... ";
+  try {
+    rdr.parseAsync("unittest_nonexistent.ini").get();
+    std::cout << "(nothing thrown)" << std::endl;
+  } catch (const std::exception &) {
+    std::cout << "yes" << std::endl;
+  }
+}
+
+// .......................................................................... //
+struct ScratchDirectory : std::filesystem::path {                              // removed with all its contents when going out of scope
+  explicit ScratchDirectory(std::filesystem::path path) : std::filesystem::path(std::move(path)) {
+    std::filesystem::remove_all        (*this);
+    std::filesystem::create_directories(*this);
+  }
+  ~ScratchDirectory() {std::error_code error; std::filesystem::remove_all(*this, error);}
+
+  ScratchDirectory(const ScratchDirectory &)             = delete;
+  ScratchDirectory & operator=(const ScratchDirectory &) = delete;
+};
+
+ScratchDirectory unittestDirectory(const std::string & name) {                  // an empty directory for test files, on a tmpfs if there is one
+  return ScratchDirectory(std::filesystem::path(std::filesystem::exists("/dev/shm") ? "/dev/shm" : ".") / name);
+}
+
+void unittest_Reader_batch () {
+  BCG::writeBoxed("Testing batch parsing", {BCG::ConsoleColors::FORE_YELLOW});
+
+  // many small files
+  auto directory = unittestDirectory("unittest_batch");
+
+  std::vector<std::string> sources;
+  for (auto i = 0; i < 300; ++i) {
+    sources.push_back( (directory / ("file" + std::to_string(i) + ".ini")).string() );
+    std::ofstream(sources.back()) << "# file " << i << "\n"
+                                  << "name    = file" << i << "\n"
+                                  << "integer = " << i << "\n"
+                                  << "real    = " << i / 8. << "\n";
+  }
+  sources.push_back( (directory / "missing.ini").string() );
+
+  Parrot::Reader rdr;
+  rdr.setVerbose(false);
+  rdr.addKeyword("name"   , Parrot::ValueTypeID::String );
+  rdr.addKeyword("integer", Parrot::ValueTypeID::Integer);
+  rdr.addKeyword("real"   , Parrot::ValueTypeID::Real   );
+  rdr.setExecutor(std::make_shared<Parrot::ThreadPoolExecutor>(4));
+
+  auto check = [&] (const std::shared_ptr<Parrot::FileLoader> & loader) {
+    rdr.setFileLoader(loader);
+    auto results = rdr.parseBatch(sources);
+
+    auto equal = true;
+    for (auto i = 0u; i + 1 < sources.size(); ++i) {equal = equal && results[i].get().to_string() == rdr(sources[i]).to_string();}
+
+    auto missingReported = false;
+    try                               {results.back().get();}
+    catch (const std::runtime_error &) {missingReported = true;}
+
+    return (equal ? "equal"s : "different"s) + ", missing file " + (missingReported ? "reported" : "not reported");
+  };
+
+  std::cout << "[0] pread loader ... " << check(std::make_shared<Parrot::PreadFileLoader>(4)) << std::endl;
+  std::cout << "[1] io_uring loader ... ";
+  if (Parrot::IoUringFileLoader::isAvailable()) {std::cout << check(std::make_shared<Parrot::IoUringFileLoader>(16)) << std::endl;}
+  else                                          {std::cout << "(not available on this system)" << std::endl;}
+  std::cout << "[2] default loader ... " << check(nullptr) << std::endl;
+
+  std::cout << "[3] file of unknown size ... ";                                // reports size 0, but is not empty
+  if (std::filesystem::exists("/proc/self/cmdline")) {
+    auto read = [] (Parrot::FileLoader && loader) {
+      std::string reVal;
+      loader.load({"/proc/self/cmdline"}, [&reVal] (size_t, std::string && text, std::exception_ptr) {reVal = std::move(text);});
+      return reVal;
+    };
+    auto pread = read(Parrot::PreadFileLoader());
+    std::cout << "pread " << (pread.empty() ? "empty" : "read");
+    if (Parrot::IoUringFileLoader::isAvailable()) {std::cout << ", io_uring " << (read(Parrot::IoUringFileLoader()) == pread ? "same" : "different");}
+    std::cout << std::endl;
+  } else {
+    std::cout << "(no /proc on this system)" << std::endl;
+  }
+
+  std::cout << "[4] one buffered sink shared by concurrent parses ... ";
+  std::vector<std::string> noisy;
+  for (auto i = 0; i < 50; ++i) {
+    noisy.push_back( (directory / ("noisy" + std::to_string(i) + ".ini")).string() );
+    std::ofstream hFile(noisy.back());
+    hFile << "name = noisy\ninteger = " << i << "\nreal = 0\n";
+    for (auto j = 0; j < 200; ++j) {hFile << "unexpected" << j << " = " << j << "\n";}
+  }
+
+  auto received = std::make_shared<Parrot::BufferedDiagnosticSink>();          // records forwarded outside of a parse are kept in order
+  rdr.setDiagnosticSink(std::make_shared<Parrot::BufferedDiagnosticSink>(received));
+  rdr.setFileLoader(nullptr);
+  for (auto & result : rdr.parseBatch(noisy)) {result.get();}
+  rdr.setDiagnosticSink(nullptr);
+
+  auto records = received->getRecords();
+  auto blocks  = std::unique(records.begin(), records.end(), [] (const auto & a, const auto & b) {return a.file == b.file;}) - records.begin();
+  std::cout << records.size() << " records in " << blocks << " blocks" << std::endl;
+}
+
+// .......................................................................... //
+void unittest_Reader_directory () {
+  BCG::writeBoxed("Testing directory parsing", {BCG::ConsoleColors::FORE_YELLOW});
+
+  auto root = unittestDirectory("unittest_directory");
+  for (auto directory : {"run1/sub", "run2", "notes"}) {std::filesystem::create_directories(root / directory);}
+
+  std::ofstream(root / "run1"     / "config.ini") << "integer = 1\nreal = 0.5\n";
+  std::ofstream(root / "run1/sub" / "config.ini") << "integer = 2\n";
+  std::ofstream(root / "run2"     / "config.ini") << "integer = three\n";
+  std::ofstream(root / "run2"     / "extra.ini" ) << "integer = 4\nreal = 1.5\n";
+  std::ofstream(root / "notes"    / "readme.txt") << "integer = 5\n";
+
+  Parrot::Reader rdr;
+  rdr.setVerbose(false);
+  rdr.setConversionErrorPolicy(Parrot::ParsingErrorPolicy::Exception);
+  rdr.addKeyword("integer", Parrot::ValueTypeID::Integer);
+  rdr.addKeyword("real"   , 0.0, false);
+
+  auto names = [&root] (const Parrot::DirectoryParseResult & result) {
+    std::string reVal;
+    for (const auto & [path, file] : result.getFiles()) {reVal += std::filesystem::path(path).lexically_relative(root).generic_string() + " ";}
+    return reVal;
+  };
+
+  auto all = rdr.parseDirectory(root.string());
+  std::cout << "[0] *.ini: " << names(all) << std::endl;
+  std::cout << "    failed: ";
+  for (const auto & path : all.getFailedFiles()) {std::cout << std::filesystem::path(path).lexically_relative(root).generic_string() << " ";}
+  std::cout << std::endl;
+  std::cout << "    run1/sub/config.ini integer = " << all[(root / "run1/sub/config.ini").string()].value().get_Integer("INTEGER") << std::endl;
+
+  auto missingReal = std::count_if(all.getDiagnostics().begin(), all.getDiagnostics().end(), [] (const auto & record) {
+    return record.kind == Parrot::DiagnosticKind::MissingKeyword && record.keyword == "REAL";
+  });
+  std::cout << "    missing keyword messages for 'real': " << missingReal << std::endl;
+
+  std::cout << "[1] run?/*.ini: "    << names(rdr.parseDirectory(root.string(), "run?/*.ini"   )) << std::endl;
+  std::cout << "[2] **/config.ini: " << names(rdr.parseDirectory(root.string(), "**/config.ini")) << std::endl;
+  std::cout << "[3] [!c]*.*: "       << names(rdr.parseDirectory(root.string(), "[!c]*.*"      )) << std::endl;
+
+  std::cout << "[4] not a directory ... ";
+  try {
+    rdr.parseDirectory((root / "notes/readme.txt").string());
+    std::cout << "(nothing thrown)" << std::endl;
+  } catch (const std::runtime_error &) {
+    std::cout << "rejected" << std::endl;
+  }
+
+  std::cout << "[5] from a task of a single thread pool ... " << std::flush;
+  auto pool = std::make_shared<Parrot::ThreadPoolExecutor>(1);
+  rdr.setExecutor(pool);
+  std::promise<size_t> nested;
+  pool->submit([&] () {nested.set_value( rdr.parseDirectory(root.string()).getFiles().size() );});
+  auto nestedCount = nested.get_future();
+  if (nestedCount.wait_for(std::chrono::seconds(10)) == std::future_status::ready) {std::cout << nestedCount.get() << " files" << std::endl;}
+  else                                                                            {std::cout << "deadlocked" << std::endl; std::abort();}
+}
+
+// -------------------------------------------------------------------------- //
+void unittest_Reader_include () {
+  BCG::writeBoxed("Testing include directives", {BCG::ConsoleColors::FORE_YELLOW});
+
+  auto root = unittestDirectory("unittest_include");
+  std::filesystem::create_directories(root / "more");
+
+  std::ofstream(root / "base.ini"      ) << "real = 0.5\ninclude = more/name.ini\n";
+  std::ofstream(root / "more/name.ini" ) << "# shared name\nname = shared\n";
+  std::ofstream(root / "solver.ini"    ) << "tolerance = 1E-6\n";
+  std::ofstream(root / "broken.ini"    ) << "\n\nundeclared = 1\nreal = 0.5\n";
+  std::ofstream(root / "bad.ini"       ) << "include = broken.ini\ninteger = 1\nreal = 0.9\n";
+  std::ofstream(root / "cycle_a.ini"   ) << "integer = 1\ninclude = cycle_b.ini\n";
+  std::ofstream(root / "cycle_b.ini"   ) << "include = cycle_a.ini\n";
+  std::ofstream(root / "missing.ini"   ) << "integer = 1\ninclude = nowhere.ini\n";
+  for (auto i = 0; i < 10; ++i) {
+    std::ofstream(root / ("run" + std::to_string(i) + ".ini"))
+      << "integer = " << i << "\ninclude = base.ini\n[solver]\ninclude = \"more/../solver.ini\"\n";
+  }
+
+  auto sink = std::make_shared<Parrot::BufferedDiagnosticSink>();
+  Parrot::Reader rdr;
+  rdr.setVerbose(false);
+  rdr.setDiagnosticSink(sink);
+  rdr.setIncludeKeyword("include");
+  rdr.addKeyword("integer", Parrot::ValueTypeID::Integer);
+  rdr.addKeyword("real"   , 0.0, false);
+  rdr.addKeyword("name"   , "none"s, false);
+  Parrot::Descriptor tolerance("tolerance", 0.0, false);
+  tolerance.setSection("solver");
+  rdr.addKeyword(tolerance);
+
+  bool equal = true;
+  for (auto i = 0; i < 10; ++i) {
+    auto content = rdr((root / ("run" + std::to_string(i) + ".ini")).string());
+    equal &= content.get_Integer("INTEGER") == i && content.get_Real("REAL") == 0.5 &&
+             content.get_String("NAME") == "SHARED" && content.get_Real("SOLVER.TOLERANCE") == 1E-6;
+  }
+  std::cout << "[0] 10 files spliced " << (equal ? "equal" : "DIFFERENT")
+            << ", fragments cached: " << rdr.getFragmentCache().size() << std::endl;
+
+  sink->clear();
+  rdr((root / "bad.ini").string());
+  std::cout << "[1] messages name the included file:" << std::endl;
+  for (const auto & record : sink->getRecords()) {
+    std::cout << "    " << Parrot::diagnosticKindName(record.kind) << " in "
+              << std::filesystem::path(record.file).filename().string() << ", line " << record.line << std::endl;
+  }
+
+  std::filesystem::last_write_time(root / "base.ini", std::filesystem::last_write_time(root / "base.ini") - std::chrono::seconds(10));
+  std::ofstream(root / "base.ini") << "real = 0.25\n";
+  std::filesystem::last_write_time(root / "base.ini", std::filesystem::last_write_time(root / "base.ini") + std::chrono::seconds(10));
+  auto modified = rdr((root / "run0.ini").string());
+  std::cout << "[2] modified base file: real = " << modified.get_Real("REAL") << ", name = " << modified.get_String("NAME") << std::endl;
+
+  std::cout << "[3] include cycle ... ";
+  try {
+    rdr((root / "cycle_a.ini").string());
+    std::cout << "(nothing thrown)" << std::endl;
+  } catch (const Parrot::IncludeError &) {
+    std::cout << "IncludeError" << std::endl;
+  }
+  for (auto file : {"cycle_a.ini", "missing.ini"}) {
+    auto result = rdr.tryParse((root / file).string());
+    for (const auto & error : result.getErrors()) {
+      std::cout << "    " << file << ": " << Parrot::diagnosticKindName(error.kind) << " in "
+                << std::filesystem::path(error.file).filename().string() << ", line " << error.line << std::endl;
+    }
+  }
+}
+
+// -------------------------------------------------------------------------- //
+void unittest_FileContent_layered () {
+  BCG::writeBoxed("Testing layered file contents", {BCG::ConsoleColors::FORE_YELLOW});
+
+  auto root = unittestDirectory("unittest_layered");
+
+  std::ofstream(root / "system.ini") << "integer = 1\nreal = 0.5\nname = system\n";
+  std::ofstream(root / "site.ini"  ) << "# site\nname = site\n";
+  std::ofstream(root / "job.ini"   ) << "real = 2.5\n\ninteger = 3\n";
+
+  Parrot::Reader rdr;
+  rdr.setVerbose(false);
+  rdr.addKeyword("integer", 0ll, false);
+  rdr.addKeyword("real"   , 0.0, false);
+  rdr.addKeyword("name"   , "none"s, false);
+
+  Parrot::FileContent overrides("command line");
+  overrides.setElement("REAL", 7.5, true);
+
+  Parrot::LayeredFileContent settings;
+  for (auto file : {"system.ini", "site.ini", "job.ini"}) {settings.addLayer( rdr((root / file).string()) );}
+  settings.addLayer( std::move(overrides) );
+
+  std::cout << "[0] " << settings.getLayerCount() << " layers, " << settings.size() << " keywords: "
+            << "integer = " << settings.getValue<long long>("INTEGER")
+            << ", real = "  << static_cast<double>(settings["REAL"])
+            << ", name = "  << settings.getValue<std::string>("NAME") << std::endl;
+
+  std::cout << "[1] provenance:" << std::endl;
+  for (const auto & key : settings.getKeywords()) {
+    auto origin = settings.getProvenance(key);
+    std::cout << "    " << key << ": layer " << origin.layer << " ("
+              << std::filesystem::path(origin.source).filename().string() << "), line " << origin.line << std::endl;
+  }
+
+  auto flat = settings.flatten();
+  std::cout << "[2] flattened: " << flat.size() << " keywords, real = " << flat.get_Real("REAL")
+            << ", integer from line " << flat.getLine("INTEGER")
+            << ", same keyword table: " << (flat.getKeywordTable() == nullptr ? "no" : "yes") << std::endl;
+
+  std::cout << "[3] unknown keyword ... ";
+  try {
+    settings.get("MISSING");
+    std::cout << "(nothing thrown)" << std::endl;
+  } catch (const Parrot::ValueAccessError &) {
+    std::cout << "ValueAccessError" << std::endl;
+  }
+}
+
+// -------------------------------------------------------------------------- //
+void unittest_Reader_handles () {
+  BCG::writeBoxed("Testing typed key handles", {BCG::ConsoleColors::FORE_YELLOW});
+
+  auto root = unittestDirectory("unittest_handles");
+
+  std::ofstream(root / "run.ini") << "epsilon_convergence = 1E-6\nsteps = 250\n";
+
+  Parrot::Reader rdr;
+  rdr.setVerbose(false);
+  rdr.addKeyword("epsilon_convergence", 1E-3, false);
+  rdr.addKeyword("steps"              , 10ll, false);
+
+  auto epsilon = rdr.handle<PARROT_TYPE(Parrot::ValueTypeID::Real   )>("epsilon_convergence");
+  auto steps   = rdr.handle<PARROT_TYPE(Parrot::ValueTypeID::Integer)>("STEPS");
+
+  rdr.addKeyword("label", "none"s, false);                                      // handles survive later keywords
+  auto label   = rdr.handle<PARROT_TYPE(Parrot::ValueTypeID::String )>("label");
+
+  auto content = rdr((root / "run.ini").string());
+  std::cout << "[0] epsilon = " << content.get(epsilon) << " (" << content.get_Real("EPSILON_CONVERGENCE") << ")"
+            << ", steps = "     << content.get(steps  ) << " (" << content.get_Integer("STEPS") << ")"
+            << ", label = "     << content.get(label  ) << std::endl;
+
+  double sum = 0;
+  for (auto i = 0ll; i < content.get(steps); ++i) {sum += content.get(epsilon);}
+  std::cout << "[1] sum over steps: " << sum << ", same object on each access: "
+            << (&content.get(epsilon) == &content.get(epsilon) ? "yes" : "no") << std::endl;
+
+  std::cout << "[2] wrong type ... ";
+  try {
+    rdr.handle<PARROT_TYPE(Parrot::ValueTypeID::Float32)>("epsilon_convergence");
+    std::cout << "(nothing thrown)" << std::endl;
+  } catch (const Parrot::ValueTypeError &) {
+    std::cout << "ValueTypeError" << std::endl;
+  }
+
+  std::cout << "[3] unknown keyword ... ";
+  try {
+    rdr.handle<PARROT_TYPE(Parrot::ValueTypeID::Real)>("tolerance");
+    std::cout << "(nothing thrown)" << std::endl;
+  } catch (const Parrot::ValueAccessError &) {
+    std::cout << "ValueAccessError" << std::endl;
+  }
+
+  std::cout << "[4] keyword not in content ... ";
+  try {
+    Parrot::FileContent empty;
+    empty.get(epsilon);
+    std::cout << "(nothing thrown)" << std::endl;
+  } catch (const Parrot::ValueAccessError &) {
+    std::cout << "ValueAccessError" << std::endl;
+  }
+
+  Parrot::Reader other;                                                         // same keywords, other IDs
+  other.setVerbose(false);
+  other.addKeyword("steps"              , 10ll, false);
+  other.addKeyword("epsilon_convergence", 1E-3, false);
+  auto otherContent = other((root / "run.ini").string());
+
+  rdr.resetKeywords();
+  rdr.addKeyword("steps"              , 20ll, false);
+  rdr.addKeyword("epsilon_convergence", 1E-2, false);
+  auto resetContent = rdr((root / "run.ini").string());
+
+  std::cout << "[5] handle on contents of other keyword tables:";
+  for (const auto * target : {&otherContent, &resetContent}) {
+    try {
+      target->get(epsilon);
+      std::cout << " (nothing thrown)";
+    } catch (const Parrot::ValueAccessError &) {
+      std::cout << " ValueAccessError";
+    }
+  }
+  std::cout << std::endl;
 }
 
 // ========================================================================== //
@@ -532,6 +1414,14 @@ int main () {
 //   unittest_Descriptor_make();
 //   unittest_FileContent();
   unittest_Reader();
+  unittest_Reader_sections();
+  unittest_Reader_parallel();
+  unittest_Reader_async();
+  unittest_Reader_batch();
+  unittest_Reader_directory();
+  unittest_Reader_include();
+  unittest_FileContent_layered();
+  unittest_Reader_handles();
 
   std::cout << std::endl;
   BCG::writeBoxed("ALL DONE -- HAVE A NICE DAY!", {BCG::ConsoleColors::FORE_GREEN}, 80, '=', '#', '#');
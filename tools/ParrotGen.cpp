@@ -0,0 +1,44 @@
+// ========================================================================== //
+// ParrotGen -- writes a settings struct and parser for a schema file
+//
+// usage: ParrotGen <schema file> <output basename> [struct name] [namespace]
+//
+// writes <output basename>.hpp and <output basename>.cpp; see
+// Parrot::CodeGenerator for details.
+
+// ========================================================================== //
+// dependencies
+
+// STL
+#include <iostream>
+#include <exception>
+
+#include <string>
+using namespace std::string_literals;
+
+// own
+#include "BCG.hpp"
+#include "Parrot.hpp"
+
+// ========================================================================== //
+
+int main(int argc, char ** argv) {
+  if (argc < 3 || argc > 5) {
+    std::cerr << "usage: " << argv[0] << " <schema file> <output basename> [struct name] [namespace]" << std::endl;
+    return 1;
+  }
+
+  try {
+    Parrot::CodeGenerator generator(Parrot::Schema::load(argv[1]), argc > 3 ? argv[3] : "Settings");
+    if (argc > 4) {generator.setNamespace(argv[4]);}
+    generator.write(argv[2]);
+
+    std::cout << "wrote " << argv[2] << ".hpp and " << argv[2] << ".cpp"
+              << " (" << generator.getMemberNames().size() << " keywords)" << std::endl;
+  } catch (const std::exception & e) {
+    std::cerr << e.what() << std::endl;
+    return 1;
+  }
+
+  return 0;
+}